@@ -208,6 +208,17 @@ struct PageHeader {
   7: optional DictionaryPageHeader dictionary_page_header;
 }
 
+/**
+ * Statistics per column chunk. min/max are PLAIN encoded (without length
+ * prefix) and absent if all values are null.
+ */
+struct Statistics {
+   1: optional binary max;
+   2: optional binary min;
+   3: optional i64 null_count;
+   4: optional i64 distinct_count;
+}
+
 /** 
  * Wrapper struct to store key values
  */
@@ -253,6 +264,9 @@ struct ColumnMetaData {
 
   /** Byte offset from the beginning of file to first (only) dictionary page **/
   11: optional i64 dictionary_page_offset
+
+  /** optional statistics for this column chunk */
+  12: optional Statistics statistics;
 }
 
 struct ColumnChunk {
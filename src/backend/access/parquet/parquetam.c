@@ -22,6 +22,10 @@
 #include "catalog/catquery.h"
 #include "utils/lsyscache.h"
 #include "utils/builtins.h"
+#include "access/nbtree.h"
+#include "catalog/pg_am.h"
+#include "commands/defrem.h"
+#include "nodes/primnodes.h"
 #include "catalog/pg_statistic.h"
 #include "cdb/cdbparquetfooterbuffer.h"
 #include "cdb/cdbparquetfooterserializer.h"
@@ -29,6 +33,8 @@
 /**For read*/
 static void initscan(ParquetScanDesc scan);
 
+static void initScanKeys(ParquetScanDesc scan, List *qual);
+
 /*get next segment file for read*/
 static bool SetNextFileSegForRead(ParquetScanDesc scan);
 
@@ -98,13 +104,18 @@ static void initscan(ParquetScanDesc scan)
 
 /**
  *begin scanning of a parquet relation
+ *
+ * `qual` is the implicitly-ANDed qual list of the scan, NIL if none. Row
+ * groups which can't satisfy it according to column statistics are skipped,
+ * the caller is still responsible for evaluating `qual` on each tuple.
  */
 ParquetScanDesc
 parquet_beginscan(
 		Relation relation,
 		Snapshot parquetMetaDataSnapshot,
 		TupleDesc relationTupleDesc,
-		bool *proj)
+		bool *proj,
+		List *qual)
 {
 	ParquetScanDesc 			scan;
 	AppendOnlyEntry				*aoEntry;
@@ -169,11 +180,96 @@ parquet_beginscan(
 
 	scan->hawqAttrToParquetColChunks = (int*)palloc0(scan->pqs_tupDesc->natts * sizeof(int));
 
+	initScanKeys(scan, qual);
+
 	initscan(scan);
 
 	return scan ;
 }
 
+/*
+ * Build scan keys for quals of the form `column op const` or `const op column`,
+ * where op is a member of the default btree operator class of column's type.
+ * Other quals can't be checked with min/max statistics and are ignored.
+ */
+static void
+initScanKeys(ParquetScanDesc scan, List *qual)
+{
+	TupleDesc	tupDesc = scan->pqs_tupDesc;
+	ListCell	*lc;
+
+	scan->pqs_scanKeys = NULL;
+	scan->pqs_numScanKeys = 0;
+
+	if (qual == NIL)
+		return;
+
+	scan->pqs_scanKeys = (ScanKey) palloc0(list_length(qual) * sizeof(ScanKeyData));
+
+	foreach(lc, qual)
+	{
+		OpExpr		*opexpr = (OpExpr *) lfirst(lc);
+		Node		*leftop;
+		Node		*rightop;
+		Var			*var;
+		Const		*con;
+		Oid			opno;
+		Oid			opclass;
+		int			strategy;
+		Oid			subtype;
+		bool		recheck;
+		RegProcedure cmpproc;
+
+		if (!IsA(opexpr, OpExpr) || list_length(opexpr->args) != 2)
+			continue;
+
+		opno = opexpr->opno;
+		leftop = (Node *) linitial(opexpr->args);
+		rightop = (Node *) lsecond(opexpr->args);
+
+		if (IsA(leftop, Var) && IsA(rightop, Const))
+		{
+			var = (Var *) leftop;
+			con = (Const *) rightop;
+		}
+		else if (IsA(leftop, Const) && IsA(rightop, Var))
+		{
+			var = (Var *) rightop;
+			con = (Const *) leftop;
+			opno = get_commutator(opno);
+			if (!OidIsValid(opno))
+				continue;
+		}
+		else
+			continue;
+
+		if (var->varlevelsup != 0 ||
+			var->varattno <= 0 ||
+			var->varattno > tupDesc->natts ||
+			var->vartype != tupDesc->attrs[var->varattno - 1]->atttypid ||
+			con->constisnull)
+			continue;
+
+		opclass = GetDefaultOpClass(var->vartype, BTREE_AM_OID);
+		if (!OidIsValid(opclass) || !op_in_opclass(opno, opclass))
+			continue;
+
+		get_op_opclass_properties(opno, opclass, &strategy, &subtype, &recheck);
+		cmpproc = get_opclass_proc(opclass, subtype, BTORDER_PROC);
+		if (!RegProcedureIsValid(cmpproc))
+			continue;
+
+		ScanKeyEntryInitialize(&scan->pqs_scanKeys[scan->pqs_numScanKeys],
+							   0,
+							   var->varattno,
+							   strategy,
+							   subtype,
+							   cmpproc,
+							   con->constvalue);
+		scan->pqs_numScanKeys++;
+	}
+}
+
 void parquet_rescan(ParquetScanDesc scan) {
 	CloseScannedFileSeg(scan);
 	scan->initedStorageRoutines = false;
@@ -208,10 +304,27 @@ void parquet_endscan(ParquetScanDesc scan) {
 				pfree(reader->pageBuffer);
 			}
 
+			if (reader->dictionaryBuffer != NULL)
+			{
+				pfree(reader->dictionaryBuffer);
+			}
+
+			if (reader->dictionary != NULL)
+			{
+				pfree(reader->dictionary);
+			}
+
 			if (reader->geoval != NULL)
 			{
 				pfree(reader->geoval);
 			}
+
+			if (reader->batchValues != NULL)
+			{
+				pfree(reader->batchValues);
+				pfree(reader->batchNulls);
+				pfree(reader->levelBuffer);
+			}
 			if (reader->columnMetadata != NULL) {
 				pfree(reader->columnMetadata);
 			}
@@ -219,10 +332,33 @@ void parquet_endscan(ParquetScanDesc scan) {
 		pfree(rowGroupReader.columnReaders);
 	}
 
+	if (rowGroupReader.keyAttrs != NULL)
+	{
+		pfree(rowGroupReader.keyAttrs);
+	}
+
+	if (rowGroupReader.coalesceBuffers != NULL)
+	{
+		for (int i = 0; i < rowGroupReader.columnReaderCount; ++i)
+		{
+			if (rowGroupReader.coalesceBuffers[i] != NULL)
+			{
+				pfree(rowGroupReader.coalesceBuffers[i]);
+			}
+		}
+		pfree(rowGroupReader.coalesceBuffers);
+		pfree(rowGroupReader.coalesceBufferLens);
+	}
+
 	if(scan->hawqAttrToParquetColChunks != NULL){
 		pfree(scan->hawqAttrToParquetColChunks);
 	}
 
+	if (scan->pqs_scanKeys != NULL)
+	{
+		pfree(scan->pqs_scanKeys);
+	}
+
 	if(scan->aoEntry != NULL){
 		pfree(scan->aoEntry);
 	}
@@ -265,6 +401,8 @@ void parquet_getnext(ParquetScanDesc scan, ScanDirection direction,
 												&scan->rowGroupReader,
 												scan->hawqAttrToParquetColChunks,
 												scan->proj,
+												scan->pqs_scanKeys,
+												scan->pqs_numScanKeys,
 												slot);
 
 		if(tupleExist)
@@ -313,6 +451,8 @@ static bool getNextRowGroup(ParquetScanDesc scan)
 												scan->proj,
 												scan->pqs_tupDesc,
 												scan->hawqAttrToParquetColChunks,
+												scan->pqs_scanKeys,
+												scan->pqs_numScanKeys,
 												scan->toCloseFile)) {
 		ParquetRowGroupReader_GetContents(&scan->rowGroupReader);
 	}
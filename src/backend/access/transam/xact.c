@@ -50,6 +50,7 @@
 #include "utils/resscheduler.h"
 #include "access/clog.h"
 
+#include "cdb/cdbcopy.h"
 #include "cdb/cdbgang.h"
 #include "cdb/cdbvars.h" /* Gp_role, Gp_is_writer, interconnect_setup_timeout */
 
@@ -2759,6 +2760,9 @@ AbortTransaction(void)
 	AtAbort_Memory();
 	AtAbort_ResourceOwner();
 
+	/* No COPY data may still be going out while the gangs are torn down */
+	AtAbort_CdbCopy();
+
 	AtAbort_ActiveQueryResource();
 	/*
 	 * Release any LW locks we might be holding as quickly as possible.
@@ -4846,6 +4850,7 @@ AbortSubTransaction(void)
 	AtSubAbort_Memory();
 	AtSubAbort_ResourceOwner();
 	AtAbort_AppendOnly(true);
+	AtAbort_CdbCopy();
 	AtSubAbort_ActiveQueryResource();
 
 	/*
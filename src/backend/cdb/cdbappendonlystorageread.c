@@ -114,9 +114,13 @@ void AppendOnlyStorageRead_Init(
 									storageRead->storageAttributes.checksum);
 
 	/*
-	 * Initialize BufferedRead.
+	 * Initialize BufferedRead.  Each large read covers two maximum blocks
+	 * and gp_appendonly_read_ahead_blocks more.  Longer reads mean fewer
+	 * round trips on hdfs, but the buffer of every scan grows with them, so
+	 * that is left to be asked for.
 	 */
-	storageRead->largeReadLen = 2 * storageRead->maxBufferLen;
+	storageRead->largeReadLen =
+		(2 + gp_appendonly_read_ahead_blocks) * storageRead->maxBufferLen;
 
 	memoryLen =
 		BufferedReadMemoryLen(
@@ -15,6 +15,9 @@
 
 static void BufferedReadIo(
     BufferedRead        *bufferedRead);
+static void BufferedReadPrefetch(
+    BufferedRead        *bufferedRead,
+    int64               inEffectFileLen);
 static uint8 *BufferedReadUseBeforeBuffer(
     BufferedRead       *bufferedRead,
     int32              maxReadAheadLen,
@@ -149,6 +152,7 @@ void BufferedReadSetFile(
 		else
 			bufferedRead->largeReadLen = (int32)real_fileLen;
 		BufferedReadIo(bufferedRead);
+		BufferedReadPrefetch(bufferedRead, fileLen);
 	}
 }
 
@@ -233,6 +237,30 @@ static void BufferedReadIo(
 	}
 }
 
+/*
+ * Ask for the large read after the current one to be read in the
+ * background, while the current one is being used.  Only sequential
+ * reads do this; the temporary ranges of random reads do not.
+ */
+static void BufferedReadPrefetch(
+    BufferedRead        *bufferedRead,
+    int64               inEffectFileLen)
+{
+	int64 nextPosition;
+	int64 remainingFileLen;
+
+	nextPosition = bufferedRead->largeReadPosition + bufferedRead->largeReadLen;
+	remainingFileLen = inEffectFileLen - nextPosition;
+	if (remainingFileLen <= 0)
+		return;
+
+	if (remainingFileLen > bufferedRead->maxLargeReadLen)
+		remainingFileLen = bufferedRead->maxLargeReadLen;
+
+	/* just a hint, a failure shows up in the read itself */
+	(void) FilePrefetch(bufferedRead->file, nextPosition, (int)remainingFileLen);
+}
+
 static uint8 *BufferedReadUseBeforeBuffer(
     BufferedRead       *bufferedRead,
     int32              maxReadAheadLen,
@@ -315,6 +343,8 @@ static uint8 *BufferedReadUseBeforeBuffer(
 	}
 	
 	BufferedReadIo(bufferedRead);
+	if (!bufferedRead->haveTemporaryLimitInEffect)
+		BufferedReadPrefetch(bufferedRead, inEffectFileLen);
 
 	extraLen = maxReadAheadLen - beforeLen;
 	Assert(extraLen > 0);
@@ -552,6 +582,8 @@ uint8 *BufferedReadGetNextBuffer(
 		}
 
 		BufferedReadIo(bufferedRead);
+		if (!bufferedRead->haveTemporaryLimitInEffect)
+			BufferedReadPrefetch(bufferedRead, inEffectFileLen);
 
 		if (maxReadAheadLen > bufferedRead->largeReadLen)
 			bufferedRead->bufferLen = bufferedRead->largeReadLen;
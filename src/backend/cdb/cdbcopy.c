@@ -25,6 +25,7 @@
 #include "cdb/cdbfts.h"
 #include "cdb/cdbgang.h"
 #include "cdb/dispatcher.h"
+#include "cdb/workermgr.h"
 #include "utils/memutils.h"
 #include "cdb/cdbsrlz.h"
 #include "commands/copy.h"
@@ -33,6 +34,34 @@
 #include "utils/faultinjector.h"
 
 extern int	pq_putmessage(char msgtype, const char *s, size_t len);
+
+/*
+ * A batch of COPY FROM rows for one segment, sent by a worker thread. The
+ * thread can't elog or palloc, so it leaves the outcome here for the QD.
+ */
+typedef struct CdbCopySendTask
+{
+	PGconn	   *conn;
+	int			target_seg;
+	StringInfoData buf;
+	int			result;			/* as returned by PQputCopyData */
+	char		errmsg[256];
+} CdbCopySendTask;
+
+/*
+ * The CdbCopy whose batch a worker thread is sending, if any.  An error can
+ * take us out of COPY at any point, so the abort of the transaction waits
+ * for the thread before the buffer and the connection go away.
+ */
+static CdbCopy *cdbCopySending = NULL;
+
+static void cdbCopyReportSendError(CdbCopy *c, int target_seg, int result,
+								   const char *errmsg);
+static void cdbCopySendTaskRun(Task task, struct WorkerMgrState *state);
+static void cdbCopySendBatch(CdbCopy *c, int target_seg);
+static void cdbCopyWaitBatch(CdbCopy *c);
+static void cdbCopyFlushData(CdbCopy *c);
+
 /*
  * Create a cdbCopy object that includes all the cdb
  * information and state needed by the backend COPY.
@@ -57,6 +86,10 @@ makeCdbCopy(bool is_copy_in, QueryResource *resource)
 	initStringInfo(&(c->err_msg));
 	initStringInfo(&(c->err_context));
 	initStringInfo(&(c->copy_out_buf));	
+	c->send_bufs = NULL;
+	c->send_task = NULL;
+	c->send_state = NULL;
+	c->send_pending = false;
 
 	/* init gangs */
 	c->aotupcounts = NULL;
@@ -232,6 +265,9 @@ cdbCopyStart(CdbCopy *c, char *copyCmd, Oid relid, Oid relerror, List *err_aoseg
 /*
  * sends data to a copy command on a specific segment (usually
  * the hash result of the data value).
+ *
+ * With gp_copy_dispatch_batch_size set the data is only batched here, and
+ * I/O errors of a batch show up in a later call, or in cdbCopyEnd().
  */
 void
 cdbCopySendData(CdbCopy *c, int target_seg, const char *buffer,
@@ -249,25 +285,200 @@ cdbCopySendData(CdbCopy *c, int target_seg, const char *buffer,
 		 * in the code above. I didn't do it because it's broken right now
 		 */
 
+	if (c->send_bufs == NULL && gp_copy_dispatch_batch_size > 0)
+	{
+		MemoryContext oldcontext;
+
+		/* the batches live as long as the CdbCopy, not the current row */
+		oldcontext = MemoryContextSwitchTo(GetMemoryChunkContext(c));
+		c->send_bufs = palloc0(list_length(c->executors.segment_conns) *
+							   sizeof(StringInfoData));
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	if (c->send_bufs != NULL)
+	{
+		StringInfo	batch = &c->send_bufs[target_seg];
+
+		if (batch->data == NULL)
+		{
+			MemoryContext oldcontext;
+
+			oldcontext = MemoryContextSwitchTo(GetMemoryChunkContext(c));
+			initStringInfo(batch);
+			MemoryContextSwitchTo(oldcontext);
+		}
+
+		appendBinaryStringInfo(batch, buffer, nbytes);
+		if (batch->len >= gp_copy_dispatch_batch_size * 1024L)
+			cdbCopySendBatch(c, target_seg);
+		return;
+	}
+
 	q = list_nth(c->executors.segment_conns, target_seg);
 		
 	/* transmit the COPY data */
 	result = PQputCopyData(q->conn, buffer, nbytes);
 
 	if (result != 1)
+		cdbCopyReportSendError(c, target_seg, result, PQerrorMessage(q->conn));
+}
+
+static void
+cdbCopyReportSendError(CdbCopy *c, int target_seg, int result,
+					   const char *errmsg)
+{
+	if (result == 0)
+		appendStringInfo(&(c->err_msg),
+						 "Failed to send data to segment %d, attempt blocked\n",
+						 target_seg);
+
+	if (result == -1)
+		appendStringInfo(&(c->err_msg),
+						 "Failed to send data to segment %d: %s\n",
+						 target_seg, errmsg);
+
+	c->io_errors = true;
+}
+
+/*
+ * Worker thread body: put a batch on the connection of its segment.
+ */
+static void
+cdbCopySendTaskRun(Task task, struct WorkerMgrState *state)
+{
+	CdbCopySendTask *t = (CdbCopySendTask *) task;
+
+	t->result = PQputCopyData(t->conn, t->buf.data, t->buf.len);
+
+	/* push out what libpq kept buffered, so the QD thread never has to */
+	if (t->result == 1 && PQflush(t->conn) != 0)
+		t->result = -1;
+
+	if (t->result == -1)
+		strlcpy(t->errmsg, PQerrorMessage(t->conn), sizeof(t->errmsg));
+}
+
+/*
+ * Hand the batch of a segment to the worker thread, once the previous batch
+ * has been sent. The buffers are swapped so that the one just sent is
+ * refilled next.
+ */
+static void
+cdbCopySendBatch(CdbCopy *c, int target_seg)
+{
+	SegmentDatabaseDescriptor *q;
+	CdbCopySendTask *t;
+	StringInfoData sent;
+	List	   *tasks;
+
+	cdbCopyWaitBatch(c);
+
+	if (c->send_task == NULL)
 	{
-		if (result == 0)
-			appendStringInfo(&(c->err_msg),
-							 "Failed to send data to segment %d, attempt blocked\n",
-							 target_seg);
+		MemoryContext oldcontext;
 
-		if (result == -1)
-			appendStringInfo(&(c->err_msg),
-							 "Failed to send data to segment %d: %s\n",
-							 target_seg, PQerrorMessage(q->conn));
+		oldcontext = MemoryContextSwitchTo(GetMemoryChunkContext(c));
+		c->send_task = palloc0(sizeof(CdbCopySendTask));
+		initStringInfo(&c->send_task->buf);
+		MemoryContextSwitchTo(oldcontext);
+	}
+	if (c->send_state == NULL)
+	{
+		MemoryContext oldcontext;
 
-		c->io_errors = true;
+		oldcontext = MemoryContextSwitchTo(GetMemoryChunkContext(c));
+		c->send_state = workermgr_create_workermgr_state(1);
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	q = list_nth(c->executors.segment_conns, target_seg);
+	t = c->send_task;
+	sent = t->buf;
+	t->buf = c->send_bufs[target_seg];
+	c->send_bufs[target_seg] = sent;
+	resetStringInfo(&c->send_bufs[target_seg]);
+
+	t->conn = q->conn;
+	t->target_seg = target_seg;
+	t->result = 1;
+	t->errmsg[0] = '\0';
+
+	tasks = list_make1(t);
+	if (workermgr_submit_job(c->send_state, tasks, cdbCopySendTaskRun))
+	{
+		c->send_pending = true;
+		cdbCopySending = c;
+	}
+	else
+	{
+		/* no thread to be had, send it ourselves */
+		cdbCopySendTaskRun(t, c->send_state);
+		if (t->result != 1)
+			cdbCopyReportSendError(c, target_seg, t->result, t->errmsg);
+	}
+	list_free(tasks);
+}
+
+/*
+ * Wait for the batch in flight, if any, and report how it went.
+ */
+static void
+cdbCopyWaitBatch(CdbCopy *c)
+{
+	CdbCopySendTask *t = c->send_task;
+
+	if (!c->send_pending)
+		return;
+
+	workermgr_wait_job(c->send_state);
+	c->send_pending = false;
+	cdbCopySending = NULL;
+
+	if (t->result != 1)
+		cdbCopyReportSendError(c, t->target_seg, t->result, t->errmsg);
+}
+
+/*
+ * AtAbort_CdbCopy
+ *		wait for a batch still being sent when the transaction aborts
+ *
+ * Called before the gangs are torn down and the memory of the CdbCopy is
+ * released.  Errors of the send don't matter any more.
+ */
+void
+AtAbort_CdbCopy(void)
+{
+	CdbCopy    *c = cdbCopySending;
+
+	if (c == NULL)
+		return;
+
+	cdbCopySending = NULL;
+	workermgr_wait_job(c->send_state);
+	c->send_pending = false;
+	workermgr_free_workermgr_state(c->send_state);
+	c->send_state = NULL;
+}
+
+/*
+ * Send all the rows still batched, and wait until they are on the wire.
+ * Must be done before anything else is written to the connections.
+ */
+static void
+cdbCopyFlushData(CdbCopy *c)
+{
+	int			seg;
+
+	if (c->send_bufs == NULL)
+		return;
+
+	for (seg = 0; seg < list_length(c->executors.segment_conns); seg++)
+	{
+		if (c->send_bufs[seg].len > 0)
+			cdbCopySendBatch(c, seg);
 	}
+	cdbCopyWaitBatch(c);
 }
 
 /*
@@ -669,6 +880,14 @@ cdbCopyEnd(CdbCopy *c)
 	c->err_msg.data[0] = '\0';
 	c->err_msg.cursor = 0;
 
+	/* the rows still batched go out before the end of the COPY */
+	cdbCopyFlushData(c);
+	if (c->send_state != NULL)
+	{
+		workermgr_free_workermgr_state(c->send_state);
+		c->send_state = NULL;
+	}
+
 	/* allocate a failed segment database pointer array */
 	failedSegDBs = (SegmentDatabaseDescriptor **) palloc(c->partition_num * 2 * sizeof(SegmentDatabaseDescriptor *));
 
@@ -12,15 +12,13 @@
 static void writeIntLittleEndianOnOneByte	(CapacityByteWriter *out, uint32_t value);
 static void writeIntLittleEndianOnTwoBytes	(CapacityByteWriter *out, uint32_t value);
 
-static int readIntLittleEndianOnOneByte(uint8_t *in);
-static int readIntLittleEndianOnTwoBytes(uint8_t *in);
-
-#ifdef NOT_USED
 static void writeIntLittleEndianOnThreeBytes(CapacityByteWriter *out, uint32_t value);
 static void writeIntLittleEndianOnFourBytes	(CapacityByteWriter *out, uint32_t value);
+
+static int readIntLittleEndianOnOneByte(uint8_t *in);
+static int readIntLittleEndianOnTwoBytes(uint8_t *in);
 static int readIntLittleEndianOnThreeBytes(uint8_t *in);
 static int readIntLittleEndianOnFourBytes(uint8_t *in);
-#endif
 
 static int paddedByteCountFromBits(int bitLength);
 
@@ -120,14 +118,12 @@ writeIntLittleEndianPaddedOnBitWidth(CapacityByteWriter *writer, int value, int
 	case 2:
 		writeIntLittleEndianOnTwoBytes(writer, value);
 		break;
-#ifdef NOT_USED
 	case 3:
 		writeIntLittleEndianOnThreeBytes(writer, value);
 		break;
 	case 4:
 		writeIntLittleEndianOnFourBytes(writer, value);
 		break;
-#endif
 	default:
 		/*ereport error*/
 		break;
@@ -146,14 +142,12 @@ readIntLittleEndianPaddedOnBitWidth(int bitWidth, uint8_t *in, int *val)
 	case 2:
 		*val = readIntLittleEndianOnTwoBytes(in);
 		break;
-#ifdef NOT_USED
 	case 3:
 		*val = readIntLittleEndianOnThreeBytes(in);
 		break;
 	case 4:
 		*val = readIntLittleEndianOnFourBytes(in);
 		break;
-#endif
 	default:
 		/* TODO raise error */
 		return -1;
@@ -189,7 +183,6 @@ readIntLittleEndianOnTwoBytes(uint8_t *in)
 	return ((ch2 << 8) + (ch1 << 0));
 }
 
-#ifdef NOT_USED
 void
 writeIntLittleEndianOnThreeBytes(CapacityByteWriter *out, uint32_t value)
 {
@@ -225,4 +218,3 @@ readIntLittleEndianOnFourBytes(uint8_t *in)
 	int ch4 = (int) in[3];
 	return ((ch4 << 24) + (ch3 << 16) + (ch2 << 8) + (ch1 << 0));
 }
-#endif
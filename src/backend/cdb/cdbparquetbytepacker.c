@@ -30,6 +30,10 @@ static void unpack8Values7Bits(uint8_t *in, int inPos, int32_t *out, int outPos)
 static void unpack8Values8Bits(uint8_t *in, int inPos, int32_t *out, int outPos);
 #endif
 
+/* generic packer for bit width 3 ~ 32, used by dictionary indices */
+static void pack8ValuesNBits(int bitWidth, int32_t *in, int inPos, uint8_t* out, int outPos);
+static void unpack8ValuesNBits(int bitWidth, uint8_t *in, int inPos, int32_t *out, int outPos);
+
 static int paddedByteCountFromBits(int numBits);
 static void pack(ByteBasedBitPackingEncoder *encoder);
 
@@ -221,7 +225,8 @@ pack8Values(int bitWidth, int32_t *in, int inPos, uint8_t* out, int outPos)
 		break;
 #endif
 	default:
-		/*ereport error*/
+		Assert(bitWidth > 2 && bitWidth <= 32);
+		pack8ValuesNBits(bitWidth, in, inPos, out, outPos);
 		break;
 	}
 }
@@ -305,11 +310,57 @@ unpack8Values(int bitWidth, uint8_t *in, int inPos, int32_t *out, int outPos)
 		break;
 #endif
 	default:
-		/*ereport error*/
+		Assert(bitWidth > 2 && bitWidth <= 32);
+		unpack8ValuesNBits(bitWidth, in, inPos, out, outPos);
 		break;
 	}
 }
 
+/*
+ * Pack 8 values of `bitWidth` bits into `bitWidth` bytes, from the
+ * Least Significant Bit first, same layout as the specialized packers.
+ */
+void
+pack8ValuesNBits(int bitWidth, int32_t *in, int inPos, uint8_t* out, int outPos)
+{
+	uint64	mask = (bitWidth == 32) ? 0xFFFFFFFF : ((((uint64) 1) << bitWidth) - 1);
+	uint64	acc = 0;
+	int		bits = 0;
+
+	for (int i = 0; i < 8; ++i)
+	{
+		acc |= (((uint64) (uint32) in[i + inPos]) & mask) << bits;
+		bits += bitWidth;
+		while (bits >= 8)
+		{
+			out[outPos++] = (uint8_t) (acc & 255);
+			acc >>= 8;
+			bits -= 8;
+		}
+	}
+	Assert(bits == 0);
+}
+
+void
+unpack8ValuesNBits(int bitWidth, uint8_t *in, int inPos, int32_t *out, int outPos)
+{
+	uint64	mask = (bitWidth == 32) ? 0xFFFFFFFF : ((((uint64) 1) << bitWidth) - 1);
+	uint64	acc = 0;
+	int		bits = 0;
+
+	for (int i = 0; i < 8; ++i)
+	{
+		while (bits < bitWidth)
+		{
+			acc |= ((uint64) in[inPos++]) << bits;
+			bits += 8;
+		}
+		out[i + outPos] = (int32_t) (acc & mask);
+		acc >>= bitWidth;
+		bits -= bitWidth;
+	}
+}
+
 void
 pack8Values1Bits(int32_t *in, int inPos, uint8_t* out, int outPos)
 {
@@ -19,8 +19,15 @@
 #define BUFFER_SIZE_LIMIT_BEFORE_SCALED ((Size) ((MaxAllocSize) * 1.0 / (BUFFER_SCALE_FACTOR))) 
 
 static void consume(ParquetColumnReader *columnReader);
+static bool readNextPage(ParquetColumnReader *columnReader);
+static void decodeBatch(ParquetColumnReader *columnReader,
+						Datum *values, bool *nulls, int count, int hawqTypeID);
 static void readRepetitionAndDefinitionLevels(ParquetColumnReader *columnReader);
 static void decodeCurrentPage(ParquetColumnReader *columnReader);
+static void decompressPage(ParquetColumnReader *columnReader,
+						   ParquetDataPage page,
+						   uint8_t *buf);
+static void decodeDictionaryPage(ParquetColumnReader *columnReader, int hawqTypeID);
 
 static bool decodePlain(Datum *value, uint8_t **buffer, int hawqTypeID);
 
@@ -30,12 +37,65 @@ static inline int get_path_size(int npts) { return offsetof(PATH, p[0]) + sizeof
 /* return size of POLYGON struct given number of points in it */
 static inline int get_polygon_size(int npts) { return offsetof(POLYGON, p[0]) + sizeof(Point) * npts; }
 
+/*
+ * File offset where the column chunk starts. Dictionary page, if any, is
+ * written before all the data pages.
+ */
+int64
+ParquetColumnChunkOffset(struct ColumnChunkMetadata_4C *columnChunkMetadata)
+{
+	return columnChunkMetadata->dictionaryPageOffset > 0 ?
+		   columnChunkMetadata->dictionaryPageOffset :
+		   columnChunkMetadata->firstDataPage;
+}
+
+/*
+ * Read `length` bytes at `offset` of the file into `buffer`. The range
+ * starts with column chunk of `colName`, used in error message.
+ */
 void
-ParquetExecutorReadColumn(ParquetColumnReader *columnReader, File file)
+ParquetExecutorReadFileRange(File file, int64 offset, char *buffer,
+							 int64 length, const char *colName)
+{
+	int64 actualReadSize = 0;
+
+	/*seek to the beginning of the range*/
+	int64 seekResult = FileSeek(file, offset, SEEK_SET);
+	if (seekResult != offset)
+	{
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("file seek error to position " INT64_FORMAT ": %s", offset, strerror(errno)),
+				 errdetail("%s", HdfsGetLastError())));
+	}
+
+	/*recursively read, until get the total range out*/
+	while(actualReadSize < length)
+	{
+		int readLen = FileRead(file, buffer + actualReadSize, length - actualReadSize);
+		if (readLen < 0) {
+			ereport(ERROR,
+					(errcode_for_file_access(),
+							errmsg("parquet storage read error on reading column %s ", colName),
+							errdetail("%s", HdfsGetLastError())));
+		}
+		actualReadSize += readLen;
+	}
+}
+
+/*
+ * Load the column chunk and split it into pages. Chunk content is read
+ * from `file` into the reader's own buffer, unless `chunkData` is not NULL:
+ * the chunk was already read as part of a coalesced range, and its pages
+ * are left where they are, so `chunkData` must outlive the row group.
+ */
+void
+ParquetExecutorReadColumn(ParquetColumnReader *columnReader, File file,
+						  char *chunkData)
 {
 	struct ColumnChunkMetadata_4C* columnChunkMetadata = columnReader->columnMetadata;
 
-	int64 firstPageOffset = columnChunkMetadata->firstDataPage;
+	int64 firstPageOffset = ParquetColumnChunkOffset(columnChunkMetadata);
 
 	int64 columnChunkSize = columnChunkMetadata->totalSize;
 
@@ -47,12 +107,20 @@ ParquetExecutorReadColumn(ParquetColumnReader *columnReader, File file)
                          columnChunkMetadata->colName, columnChunkSize)));
     }
 
-	int64 actualReadSize = 0;
-
 	MemoryContext oldContext = MemoryContextSwitchTo(columnReader->memoryContext);
 
 	/*reuse the column reader data buffer to avoid memory re-allocation*/
-	if(columnReader->dataLen == 0)
+	if (chunkData != NULL)
+	{
+		/* a chunk of a coalesced range needs no buffer of its own */
+		if (columnReader->dataLen != 0)
+		{
+			pfree(columnReader->dataBuffer);
+			columnReader->dataBuffer = NULL;
+			columnReader->dataLen = 0;
+		}
+	}
+	else if(columnReader->dataLen == 0)
 	{
 		columnReader->dataLen = columnChunkSize < BUFFER_SIZE_LIMIT_BEFORE_SCALED ?
 								columnChunkSize * BUFFER_SCALE_FACTOR :
@@ -70,34 +138,17 @@ ParquetExecutorReadColumn(ParquetColumnReader *columnReader, File file)
 		memset(columnReader->dataBuffer, 0, columnReader->dataLen);
 	}
 
-	char *buffer = columnReader->dataBuffer;
+	char *chunkStart = chunkData != NULL ? chunkData : columnReader->dataBuffer;
+	char *buffer = chunkStart;
 
 	int64 numValuesInColumnChunk = columnChunkMetadata->valueCount;
 
 	int64 numValuesProcessed = 0;
 
-	/*seek to the beginning of the column chunk*/
-	int64 seekResult = FileSeek(file, firstPageOffset, SEEK_SET);
-	if (seekResult != firstPageOffset)
-	{
-		ereport(ERROR,
-				(errcode_for_file_access(),
-				 errmsg("file seek error to position " INT64_FORMAT ": %s", firstPageOffset, strerror(errno)),
-				 errdetail("%s", HdfsGetLastError())));
-	}
-
-	/*recursively read, until get the total column chunk data out*/
-	while(actualReadSize < columnChunkSize)
+	if (chunkData == NULL)
 	{
-		/*read out all the buffer of the column chunk*/
-		int columnChunkLen = FileRead(file, buffer + actualReadSize, columnChunkSize - actualReadSize);
-		if (columnChunkLen < 0) {
-			ereport(ERROR,
-					(errcode_for_file_access(),
-							errmsg("parquet storage read error on reading column %s ", columnChunkMetadata->colName),
-							errdetail("%s", HdfsGetLastError())));
-		}
-		actualReadSize += columnChunkLen;
+		ParquetExecutorReadFileRange(file, firstPageOffset, buffer,
+									 columnChunkSize, columnChunkMetadata->colName);
 	}
 
 	/*only if first column reader set, just need palloc the data pages*/
@@ -115,7 +166,7 @@ ParquetExecutorReadColumn(ParquetColumnReader *columnReader, File file)
 		ParquetPageHeader pageHeader;
 		ParquetDataPage dataPage;
 
-		uint32_t header_size = (char *) columnReader->dataBuffer + columnChunkSize - buffer;
+		uint32_t header_size = chunkStart + columnChunkSize - buffer;
 		if (readPageMetadata((uint8_t*) buffer, &header_size, /*compact*/1, &pageHeader) < 0)
 		{
 			ereport(ERROR, (errcode(ERRCODE_GP_INTERNAL_ERROR),
@@ -125,6 +176,16 @@ ParquetExecutorReadColumn(ParquetColumnReader *columnReader, File file)
 
 		buffer += header_size;
 
+		/* dictionary page is decoded on reading the first dictionary encoded value */
+		if (pageHeader->page_type == DICTIONARY_PAGE)
+		{
+			Assert(columnReader->dictionaryPage.header == NULL);
+			columnReader->dictionaryPage.header = pageHeader;
+			columnReader->dictionaryPage.data = (uint8_t *) buffer;
+			buffer += pageHeader->compressed_page_size;
+			continue;
+		}
+
 		/*just process data page now*/
 		if(pageHeader->page_type != DATA_PAGE){
 			buffer += pageHeader->compressed_page_size;
@@ -174,24 +235,35 @@ consume(ParquetColumnReader *columnReader)
 	/* make sure we have values to read in current page */
 	if (columnReader->currentPageValueRemained == 0)
 	{
-		if (columnReader->dataPageProcessed >= columnReader->dataPageNum)
+		if (!readNextPage(columnReader))
 		{
 			/* next r must be 0 when reached chunk end */
 			columnReader->repetitionLevel = 0;
 			return;
 		}
-
-		/* read next page */
-		columnReader->currentPage = &columnReader->dataPages[columnReader->dataPageProcessed];
-		decodeCurrentPage(columnReader);
-
-		columnReader->currentPageValueRemained = columnReader->currentPage->header->num_values;
-		columnReader->dataPageProcessed++;
 	}
 
 	readRepetitionAndDefinitionLevels(columnReader);
 }
 
+/*
+ * Move to next data page and decode it, return false if no page left.
+ */
+static bool
+readNextPage(ParquetColumnReader *columnReader)
+{
+	if (columnReader->dataPageProcessed >= columnReader->dataPageNum)
+		return false;
+
+	columnReader->currentPage = &columnReader->dataPages[columnReader->dataPageProcessed];
+	decodeCurrentPage(columnReader);
+
+	columnReader->currentPageValueRemained = columnReader->currentPage->header->num_values;
+	columnReader->dataPageProcessed++;
+
+	return true;
+}
+
 static void
 readRepetitionAndDefinitionLevels(ParquetColumnReader *reader)
 {
@@ -221,6 +293,7 @@ decodeCurrentPage(ParquetColumnReader *columnReader)
 	ParquetDataPage page;
 	ParquetPageHeader header;
 	uint8_t			*buf;	/* store uncompressed or decompressed page data */
+	uint8_t			*pageEnd;
 	MemoryContext	oldContext;
 
 	chunkmd	= columnReader->columnMetadata;
@@ -264,91 +337,11 @@ decodeCurrentPage(ParquetColumnReader *columnReader)
 			buf = (uint8_t *) columnReader->pageBuffer;
 		}
 
-		/*
-		 * call corresponding decompress routine
-		 */
-		switch (chunkmd->codec)
-		{
-			case SNAPPY:
-			{
-				size_t uncompressedLen;
-				if (snappy_uncompressed_length((char *) page->data,
-											   header->compressed_page_size,
-											   &uncompressedLen) != SNAPPY_OK)
-				{
-					ereport(ERROR,
-							(errcode(ERRCODE_GP_INTERNAL_ERROR),
-							 errmsg("invalid snappy compressed data for column %s, page number %d",
-									chunkmd->colName, columnReader->dataPageProcessed)));
-				}
-
-				Insist(uncompressedLen == header->uncompressed_page_size);
-
-				if (snappy_uncompress((char *) page->data,		header->compressed_page_size,
-									  (char *) buf,				&uncompressedLen) != SNAPPY_OK)
-				{
-					ereport(ERROR,
-							(errcode(ERRCODE_GP_INTERNAL_ERROR),
-							 errmsg("failed to decompress snappy data for column %s, page number %d, "
-									"uncompressed size %d, compressed size %d",
-									chunkmd->colName, columnReader->dataPageProcessed,
-									header->uncompressed_page_size, header->compressed_page_size)));
-				}
-				
-				page->data = buf;
-				break;
-			}
-			case GZIP:
-			{
-				int ret;
-				/* 15(default windowBits for deflate) + 16(ouput GZIP header/tailer) */
-				const int windowbits = 31;
-
-				z_stream stream;
-				stream.zalloc	= Z_NULL;
-				stream.zfree	= Z_NULL;
-				stream.opaque	= Z_NULL;
-				stream.avail_in	= header->compressed_page_size;
-				stream.next_in	= (Bytef *) page->data;
-				
-				ret = inflateInit2(&stream, windowbits);
-				if (ret != Z_OK)
-				{
-					ereport(ERROR,
-							(errcode(ERRCODE_GP_INTERNAL_ERROR),
-							 errmsg("zlib inflateInit2 failed: %s", stream.msg)));
-				}
-
-				size_t uncompressedLen = header->uncompressed_page_size;
-
-				stream.avail_out = uncompressedLen;
-				stream.next_out  = (Bytef *) buf;
-				ret = inflate(&stream, Z_FINISH);
-				if (ret != Z_STREAM_END)
-				{
-					ereport(ERROR,
-							(errcode(ERRCODE_GP_INTERNAL_ERROR),
-							 errmsg("zlib inflate failed: %s", stream.msg)));
-				
-				}
-				/* should fill all uncompressed_page_size bytes */
-				Assert(stream.avail_out == 0);
-
-				inflateEnd(&stream);
-
-				page->data = buf;
-				break;
-			}
-			case LZO:
-				/* TODO */
-				Insist(false);
-				break;
-			default:
-				Insist(false);
-				break;
-		}
+		decompressPage(columnReader, page, buf);
 	}
 
+	pageEnd = buf + header->uncompressed_page_size;
+
 	/*----------------------------------------------------------------
 	 * get r/d/value part
 	 *----------------------------------------------------------------*/
@@ -386,6 +379,23 @@ decodeCurrentPage(ParquetColumnReader *columnReader)
 				palloc0(sizeof(ByteBasedBitPackingDecoder));
 		BitPack_InitDecoder(page->bool_values_reader, buf, /*bitwidth=*/1);
 	}
+	else if (header->encoding == PLAIN_DICTIONARY)
+	{
+		/* <1-byte bit width> + <rle/bitpack encoded dictionary indices> */
+		int bitWidth = *buf;
+		buf += 1;
+
+		if (columnReader->dictionaryPage.header == NULL)
+		{
+			ereport(ERROR,
+					(errcode(ERRCODE_GP_INTERNAL_ERROR),
+					 errmsg("missing dictionary page for column %s, page number %d",
+							chunkmd->colName, columnReader->dataPageProcessed)));
+		}
+
+		page->dict_indices_reader = (RLEDecoder *) palloc0(sizeof(RLEDecoder));
+		RLEDecoder_Init(page->dict_indices_reader, bitWidth, buf, pageEnd - buf);
+	}
 	else
 	{
 		page->values_buffer = buf;
@@ -394,6 +404,100 @@ decodeCurrentPage(ParquetColumnReader *columnReader)
 	MemoryContextSwitchTo(oldContext);
 }
 
+/*
+ * Decompress raw data of `page` into `buf`, which should be large enough
+ * for uncompressed data. After this, page->data points to `buf`.
+ */
+static void
+decompressPage(ParquetColumnReader *columnReader,
+			   ParquetDataPage page,
+			   uint8_t *buf)
+{
+	ColumnChunkMetadata_4C *chunkmd = columnReader->columnMetadata;
+	ParquetPageHeader header = page->header;
+
+	switch (chunkmd->codec)
+	{
+		case SNAPPY:
+		{
+			size_t uncompressedLen;
+			if (snappy_uncompressed_length((char *) page->data,
+										   header->compressed_page_size,
+										   &uncompressedLen) != SNAPPY_OK)
+			{
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 errmsg("invalid snappy compressed data for column %s, page number %d",
+								chunkmd->colName, columnReader->dataPageProcessed)));
+			}
+
+			Insist(uncompressedLen == header->uncompressed_page_size);
+
+			if (snappy_uncompress((char *) page->data,		header->compressed_page_size,
+								  (char *) buf,				&uncompressedLen) != SNAPPY_OK)
+			{
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 errmsg("failed to decompress snappy data for column %s, page number %d, "
+								"uncompressed size %d, compressed size %d",
+								chunkmd->colName, columnReader->dataPageProcessed,
+								header->uncompressed_page_size, header->compressed_page_size)));
+			}
+			
+			page->data = buf;
+			break;
+		}
+		case GZIP:
+		{
+			int ret;
+			/* 15(default windowBits for deflate) + 16(ouput GZIP header/tailer) */
+			const int windowbits = 31;
+
+			z_stream stream;
+			stream.zalloc	= Z_NULL;
+			stream.zfree	= Z_NULL;
+			stream.opaque	= Z_NULL;
+			stream.avail_in	= header->compressed_page_size;
+			stream.next_in	= (Bytef *) page->data;
+			
+			ret = inflateInit2(&stream, windowbits);
+			if (ret != Z_OK)
+			{
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 errmsg("zlib inflateInit2 failed: %s", stream.msg)));
+			}
+
+			size_t uncompressedLen = header->uncompressed_page_size;
+
+			stream.avail_out = uncompressedLen;
+			stream.next_out  = (Bytef *) buf;
+			ret = inflate(&stream, Z_FINISH);
+			if (ret != Z_STREAM_END)
+			{
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 errmsg("zlib inflate failed: %s", stream.msg)));
+			
+			}
+			/* should fill all uncompressed_page_size bytes */
+			Assert(stream.avail_out == 0);
+
+			inflateEnd(&stream);
+
+			page->data = buf;
+			break;
+		}
+		case LZO:
+			/* TODO */
+			Insist(false);
+			break;
+		default:
+			Insist(false);
+			break;
+	}
+}
+
 /**
  * Read the value from a certain columnReader, the value will be embedded in value,
  * and if the value is null, the null field should be true
@@ -430,6 +534,27 @@ ParquetColumnReader_readValue(
 		{
 			*value = BoolGetDatum((bool) BitPack_ReadInt(columnReader->currentPage->bool_values_reader));
 		}
+		else if (columnReader->currentPage->dict_indices_reader != NULL)
+		{
+			int index;
+
+			if (columnReader->dictionarySize == 0)
+			{
+				decodeDictionaryPage(columnReader, hawqTypeID);
+			}
+
+			index = RLEDecoder_ReadInt(columnReader->currentPage->dict_indices_reader);
+			if (index < 0 || index >= columnReader->dictionarySize)
+			{
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 errmsg("invalid dictionary index %d for column %s, dictionary size %d",
+								index, columnReader->columnMetadata->colName,
+								columnReader->dictionarySize)));
+			}
+
+			*value = columnReader->dictionary[index];
+		}
 		else
 		{
 			decodePlain(value, &(columnReader->currentPage->values_buffer), hawqTypeID);
@@ -445,6 +570,332 @@ ParquetColumnReader_readValue(
 	}
 }
 
+/*
+ * Decode all the entries of the dictionary page into columnReader->dictionary,
+ * decompress page data if needed.
+ */
+static void
+decodeDictionaryPage(ParquetColumnReader *columnReader, int hawqTypeID)
+{
+	ColumnChunkMetadata_4C *chunkmd = columnReader->columnMetadata;
+	ParquetDataPage page = &columnReader->dictionaryPage;
+	ParquetPageHeader header = page->header;
+	uint8_t			*buf;
+	MemoryContext	oldContext;
+
+	Assert(header != NULL);
+
+	oldContext = MemoryContextSwitchTo(columnReader->memoryContext);
+
+	if (chunkmd->codec == UNCOMPRESSED)
+	{
+		buf = page->data;
+	}
+	else
+	{
+		/* dictionary entries must be kept until the column chunk is finished */
+		if (columnReader->dictionaryBuffer == NULL)
+		{
+			columnReader->dictionaryBufferLen = header->uncompressed_page_size * BUFFER_SCALE_FACTOR;
+			columnReader->dictionaryBuffer = palloc0(columnReader->dictionaryBufferLen);
+		}
+		else if (columnReader->dictionaryBufferLen < header->uncompressed_page_size)
+		{
+			columnReader->dictionaryBufferLen = header->uncompressed_page_size * BUFFER_SCALE_FACTOR;
+			columnReader->dictionaryBuffer = repalloc(columnReader->dictionaryBuffer,
+													  columnReader->dictionaryBufferLen);
+		}
+		buf = (uint8_t *) columnReader->dictionaryBuffer;
+
+		decompressPage(columnReader, page, buf);
+	}
+
+	if (columnReader->dictionaryCapacity < header->num_values)
+	{
+		if (columnReader->dictionary != NULL)
+		{
+			pfree(columnReader->dictionary);
+		}
+		columnReader->dictionaryCapacity = header->num_values;
+		columnReader->dictionary = palloc(columnReader->dictionaryCapacity * sizeof(Datum));
+	}
+
+	for (int i = 0; i < header->num_values; i++)
+	{
+		decodePlain(&columnReader->dictionary[i], &buf, hawqTypeID);
+	}
+	columnReader->dictionarySize = header->num_values;
+
+	MemoryContextSwitchTo(oldContext);
+}
+
+/*
+ * Whether values of the column can be read by ParquetColumnReader_readBatch:
+ * non-repeated column of pass-by-value fixed length type.
+ */
+bool
+ParquetColumnReader_canReadBatch(ParquetColumnReader *columnReader, int hawqTypeID)
+{
+	if (columnReader->columnMetadata->r != 0)
+		return false;
+
+	switch (hawqTypeID)
+	{
+		case HAWQ_TYPE_BOOL:
+		case HAWQ_TYPE_INT2:
+		case HAWQ_TYPE_INT4:
+		case HAWQ_TYPE_DATE:
+		case HAWQ_TYPE_FLOAT4:
+		case HAWQ_TYPE_INT8:
+		case HAWQ_TYPE_TIME:
+		case HAWQ_TYPE_TIMESTAMPTZ:
+		case HAWQ_TYPE_TIMESTAMP:
+		case HAWQ_TYPE_FLOAT8:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/*
+ * Read up to `count` values (at most PARQUET_READ_BATCH_SIZE) of the column
+ * into `values` and `nulls`. The column must satisfy
+ * ParquetColumnReader_canReadBatch.
+ *
+ * Return number of values read, which is less than `count` only if the
+ * column chunk is exhausted.
+ */
+int
+ParquetColumnReader_readBatch(
+		ParquetColumnReader *columnReader,
+		Datum *values,
+		bool *nulls,
+		int count,
+		int hawqTypeID)
+{
+	int numRead = 0;
+
+	Assert(columnReader->columnMetadata->r == 0);
+	Assert(count <= PARQUET_READ_BATCH_SIZE);
+
+	while (numRead < count)
+	{
+		int n;
+
+		if (columnReader->currentPageValueRemained == 0 &&
+			!readNextPage(columnReader))
+			break;
+
+		n = Min(count - numRead, columnReader->currentPageValueRemained);
+		decodeBatch(columnReader, values + numRead, nulls + numRead, n, hawqTypeID);
+
+		columnReader->currentPageValueRemained -= n;
+		numRead += n;
+	}
+
+	return numRead;
+}
+
+/*
+ * Skip next `count` values of a non-repeated column. Pages all of whose
+ * values are skipped are neither decompressed nor decoded.
+ */
+void
+ParquetColumnReader_skipValues(
+		ParquetColumnReader *columnReader,
+		int count,
+		int hawqTypeID)
+{
+	Assert(columnReader->columnMetadata->r == 0);
+
+	/* values already decoded by readBatch */
+	if (columnReader->batchPos < columnReader->batchCount)
+	{
+		int n = Min(count, columnReader->batchCount - columnReader->batchPos);
+
+		columnReader->batchPos += n;
+		count -= n;
+	}
+
+	while (count > 0)
+	{
+		int n;
+
+		if (columnReader->currentPageValueRemained == 0)
+		{
+			ParquetDataPage nextPage;
+
+			if (columnReader->dataPageProcessed >= columnReader->dataPageNum)
+			{
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 errmsg("column %s of parquet row group has fewer values than rows",
+								columnReader->columnMetadata->colName)));
+			}
+
+			nextPage = &columnReader->dataPages[columnReader->dataPageProcessed];
+			if (nextPage->header->num_values <= count)
+			{
+				count -= nextPage->header->num_values;
+				columnReader->dataPageProcessed++;
+				continue;
+			}
+
+			readNextPage(columnReader);
+		}
+
+		n = Min(count, columnReader->currentPageValueRemained);
+
+		if (columnReader->batchValues != NULL)
+		{
+			/* batch buffer is empty now, use it as scratch space */
+			n = Min(n, PARQUET_READ_BATCH_SIZE);
+			decodeBatch(columnReader, columnReader->batchValues,
+						columnReader->batchNulls, n, hawqTypeID);
+			columnReader->currentPageValueRemained -= n;
+			columnReader->batchCount = 0;
+			columnReader->batchPos = 0;
+		}
+		else
+		{
+			Datum	value;
+			bool	null;
+
+			for (int i = 0; i < n; i++)
+				ParquetColumnReader_readValue(columnReader, &value, &null, hawqTypeID);
+		}
+
+		count -= n;
+	}
+}
+
+/*
+ * Decode `count` values from current page, which must have that many
+ * values remained.
+ */
+static void
+decodeBatch(
+		ParquetColumnReader *columnReader,
+		Datum *values,
+		bool *nulls,
+		int count,
+		int hawqTypeID)
+{
+	ParquetDataPage page = columnReader->currentPage;
+	bool	hasNull = false;
+
+	/*----------------------------------------------------------------
+	 * null flags from definition levels
+	 *----------------------------------------------------------------*/
+	if (page->definition_level_reader != NULL)
+	{
+		int maxLevel = columnReader->columnMetadata->d;
+		int *levels = columnReader->levelBuffer;
+
+		RLEDecoder_ReadInts(page->definition_level_reader, levels, count);
+		for (int i = 0; i < count; i++)
+		{
+			nulls[i] = (levels[i] < maxLevel);
+			hasNull |= nulls[i];
+		}
+	}
+	else
+	{
+		memset(nulls, 0, count * sizeof(bool));
+	}
+
+	/*----------------------------------------------------------------
+	 * values, specialized by encoding and physical width
+	 *----------------------------------------------------------------*/
+#define DECODE_BATCH(getValue) \
+	do { \
+		if (!hasNull) \
+		{ \
+			for (int i = 0; i < count; i++) \
+				values[i] = getValue; \
+		} \
+		else \
+		{ \
+			for (int i = 0; i < count; i++) \
+				values[i] = nulls[i] ? (Datum) 0 : getValue; \
+		} \
+	} while (0)
+
+	if (hawqTypeID == HAWQ_TYPE_BOOL)
+	{
+		ByteBasedBitPackingDecoder *reader = page->bool_values_reader;
+
+		DECODE_BATCH(BoolGetDatum((bool) BitPack_ReadInt(reader)));
+	}
+	else if (page->dict_indices_reader != NULL)
+	{
+		RLEDecoder *reader = page->dict_indices_reader;
+
+		if (columnReader->dictionarySize == 0)
+		{
+			decodeDictionaryPage(columnReader, hawqTypeID);
+		}
+
+		for (int i = 0; i < count; i++)
+		{
+			int index;
+
+			if (nulls[i])
+			{
+				values[i] = (Datum) 0;
+				continue;
+			}
+
+			index = RLEDecoder_ReadInt(reader);
+			if (index < 0 || index >= columnReader->dictionarySize)
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 errmsg("invalid dictionary index %d for column %s, dictionary size %d",
+								index, columnReader->columnMetadata->colName,
+								columnReader->dictionarySize)));
+			values[i] = columnReader->dictionary[index];
+		}
+	}
+	else
+	{
+		uint8_t *buf = page->values_buffer;
+
+		/*
+		 * Same representation as decodePlain. Values may be unaligned in
+		 * the page, memcpy lets the compiler emit plain unaligned loads.
+		 */
+		switch (hawqTypeID)
+		{
+			case HAWQ_TYPE_INT2:
+			case HAWQ_TYPE_INT4:
+			case HAWQ_TYPE_DATE:
+			case HAWQ_TYPE_FLOAT4:
+			{
+				int32_t val;
+				DECODE_BATCH((memcpy(&val, buf, sizeof(val)), buf += sizeof(val), (Datum) val));
+				break;
+			}
+			case HAWQ_TYPE_INT8:
+			case HAWQ_TYPE_TIME:
+			case HAWQ_TYPE_TIMESTAMPTZ:
+			case HAWQ_TYPE_TIMESTAMP:
+			case HAWQ_TYPE_FLOAT8:
+			{
+				int64_t val;
+				DECODE_BATCH((memcpy(&val, buf, sizeof(val)), buf += sizeof(val), (Datum) val));
+				break;
+			}
+			default:
+				Insist(false);
+				break;
+		}
+
+		page->values_buffer = buf;
+	}
+
+#undef DECODE_BATCH
+}
+
 static bool
 decodePlain(Datum *value, uint8_t **buffer, int hawqTypeID)
 {
@@ -609,6 +1060,11 @@ ParquetColumnReader_FinishedScanColumn(
 			pfree(page->bool_values_reader);
 		}
 
+		if (page->dict_indices_reader != NULL)
+		{
+			pfree(page->dict_indices_reader);
+		}
+
 		/*
 		 * compressed repeatable column keeps each page's decompressed
 		 * content in page->data, which should be freed.
@@ -637,10 +1093,20 @@ ParquetColumnReader_FinishedScanColumn(
 		columnReader->geoval = NULL;
 	}
 
+	if (columnReader->dictionaryPage.header != NULL)
+	{
+		pfree(columnReader->dictionaryPage.header);
+		memset(&columnReader->dictionaryPage, 0, sizeof(struct ParquetDataPage_S));
+	}
+	columnReader->dictionarySize = 0;
+
 	MemoryContextSwitchTo(oldContext);
 
 	columnReader->dataPageProcessed = 0;
 	columnReader->currentPageValueRemained = 0;
+	columnReader->batchCount = 0;
+	columnReader->batchPos = 0;
+	columnReader->skipCount = 0;
 }
 
 /*----------------------------------------------------------------
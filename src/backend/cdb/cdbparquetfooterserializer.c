@@ -63,6 +63,11 @@ readColumnMetadata(
 		CompactProtocol *prot,
 		struct ColumnChunkMetadata_4C *colChunk);
 
+static int
+readStatistics(
+		CompactProtocol *prot,
+		struct ColumnChunkMetadata_4C *colChunk);
+
 static void
 assignRDFromFieldToColumnChunk(
 		struct ColumnChunkMetadata_4C* columns,
@@ -80,6 +85,11 @@ static void
 freeField(struct FileField_4C *field);
 
 /** The serialize part functions*/
+static int
+writeStatistics(
+		struct ColumnChunkMetadata_4C *columnInfo,
+		CompactProtocol *prot);
+
 static int
 writeColumnMetadata(
 		struct ColumnChunkMetadata_4C *columnInfo,
@@ -754,7 +764,16 @@ readColumnMetadata(
 			break;
 		case 11:
 			if (ftype == T_I64) {
-				xfer += skipType(prot, ftype);
+				int64_t dictionaryPageOffset;
+				xfer += readI64(prot, &dictionaryPageOffset);
+				/* writers not supporting dictionary may set it to -1 */
+				colChunk->dictionaryPageOffset =
+						dictionaryPageOffset > 0 ? dictionaryPageOffset : 0;
+			}
+			break;
+		case 12:
+			if (ftype == T_STRUCT) {
+				xfer += readStatistics(prot, colChunk);
 			}
 			break;
 		default:
@@ -790,6 +809,59 @@ readColumnMetadata(
 	return xfer;
 }
 
+/**
+ * Read column chunk statistics: max, min and null_count. distinct_count
+ * is not used.
+ */
+int
+readStatistics(
+		CompactProtocol *prot,
+		struct ColumnChunkMetadata_4C *colChunk)
+{
+	uint32_t xfer = 0;
+	TType ftype;
+	int16_t fid;
+	char *value;
+	int32_t len;
+
+	readStructBegin(prot);
+
+	colChunk->hasStatistics = true;
+	colChunk->nullCount = -1;
+
+	while (true) {
+		xfer += readFieldBegin(prot, &ftype, &fid);
+		if (ftype == T_STOP) {
+			break;
+		}
+		if (fid == 1 && ftype == T_STRING) {
+			xfer += readBinary(prot, &value, &len);
+			if (len > 0) {
+				colChunk->maxValue = (uint8_t *) value;
+				colChunk->maxValueLen = len;
+			}
+		} else if (fid == 2 && ftype == T_STRING) {
+			xfer += readBinary(prot, &value, &len);
+			if (len > 0) {
+				colChunk->minValue = (uint8_t *) value;
+				colChunk->minValueLen = len;
+			}
+		} else if (fid == 3 && ftype == T_I64) {
+			xfer += readI64(prot, &(colChunk->nullCount));
+		} else {
+			xfer += skipType(prot, ftype);
+		}
+	}
+
+	readStructEnd(prot);
+
+	/* statistics without null count can't tell whether all values are null */
+	if (colChunk->nullCount < 0)
+		colChunk->hasStatistics = false;
+
+	return xfer;
+}
+
 /**
  * Assign the r and d value of column chunks, from pfields to column chunks
  */
@@ -1014,7 +1086,18 @@ writeColumnMetadata(
 	xfer += writeFieldBegin(prot, T_I64, 9);
 	xfer += writeI64(prot, columnInfo->firstDataPage);
 
-	/*write out index page offset and dictionary page offset. No need to write currently*/
+	/*write out dictionary page offset if the column chunk is dictionary encoded.
+	 *index page offset is not used, no need to write it out*/
+	if (columnInfo->dictionaryPageOffset > 0) {
+		xfer += writeFieldBegin(prot, T_I64, 11);
+		xfer += writeI64(prot, columnInfo->dictionaryPageOffset);
+	}
+
+	/*write out statistics if collected*/
+	if (columnInfo->hasStatistics) {
+		xfer += writeFieldBegin(prot, T_STRUCT, 12);
+		xfer += writeStatistics(columnInfo, prot);
+	}
 
 	/*write out field stop identifier*/
 	xfer += writeFieldStop(prot);
@@ -1023,6 +1106,34 @@ writeColumnMetadata(
 	return xfer;
 }
 
+int
+writeStatistics(
+		struct ColumnChunkMetadata_4C *columnInfo,
+		CompactProtocol *prot)
+{
+	uint32_t xfer = 0;
+	xfer += writeStructBegin(prot);
+
+	/*write out max and min value, absent if all values are null*/
+	if (columnInfo->maxValue != NULL) {
+		xfer += writeFieldBegin(prot, T_STRING, 1);
+		xfer += writeBinary(prot, columnInfo->maxValue, columnInfo->maxValueLen);
+	}
+	if (columnInfo->minValue != NULL) {
+		xfer += writeFieldBegin(prot, T_STRING, 2);
+		xfer += writeBinary(prot, columnInfo->minValue, columnInfo->minValueLen);
+	}
+
+	/*write out null count*/
+	xfer += writeFieldBegin(prot, T_I64, 3);
+	xfer += writeI64(prot, columnInfo->nullCount);
+
+	xfer += writeFieldStop(prot);
+	xfer += writeStructEnd(prot);
+
+	return xfer;
+}
+
 int
 writeColumnChunk(
 		struct ColumnChunkMetadata_4C *columnInfo,
@@ -1349,6 +1460,10 @@ freeRowGroupInfo(struct BlockMetadata_4C *blockMetadata) {
 			pfree(colChunk->pathInSchema);
 		if (colChunk->pEncodings != NULL)
 			pfree(colChunk->pEncodings);
+		if (colChunk->minValue != NULL)
+			pfree(colChunk->minValue);
+		if (colChunk->maxValue != NULL)
+			pfree(colChunk->maxValue);
 	}
 	pfree(blockMetadata->columns);
 	blockMetadata->columns = NULL;
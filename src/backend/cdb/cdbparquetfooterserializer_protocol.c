@@ -218,6 +218,15 @@ uint32_t readI64(CompactProtocol *prot, int64_t *i64) {
 }
 
 uint32_t readString(CompactProtocol *prot, char **str) {
+	int32_t len;
+	return readBinary(prot, str, &len);
+}
+
+/**
+ * Read binary data, which may contain '\0', `len` is set to its length.
+ * The returned buffer is always '\0' terminated as readString.
+ */
+uint32_t readBinary(CompactProtocol *prot, char **str, int32_t *len) {
 	int32_t rsize = 0;
 	int32_t size = 0;
 	uint8_t *tmp = NULL;
@@ -227,6 +236,7 @@ uint32_t readString(CompactProtocol *prot, char **str) {
   int bufRet;
 
 	rsize += readVarint32(prot, &size);
+	*len = size;
 	/* Catch empty string case */
 	if (size == 0) {
 		*str = "";
@@ -244,6 +244,49 @@ RLEDecoder_ReadInt(RLEDecoder *decoder)
 	return result;
 }
 
+void
+RLEDecoder_ReadInts(RLEDecoder *decoder, int *values, int count)
+{
+	while (count > 0)
+	{
+		int n;
+		int i;
+
+		if (decoder->valueCount == 0)
+		{
+			readNextRun(decoder);
+			if (decoder->valueCount == 0)
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 errmsg("parquet RLE data corrupted: %d more values expected", count)));
+		}
+
+		n = Min(count, decoder->valueCount);
+
+		switch (decoder->mode)
+		{
+			case MODE_RLE:
+				for (i = 0; i < n; i++)
+					values[i] = decoder->rleValue;
+				break;
+			case MODE_BITPACK:
+				memcpy(values,
+					   decoder->bitpackBuffer + decoder->bitpackBufferSize - decoder->valueCount,
+					   n * sizeof(int));
+				break;
+			default:
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 errmsg("parquet RLE data corrupted: unknown run mode %d", decoder->mode)));
+				break;
+		}
+
+		decoder->valueCount -= n;
+		values += n;
+		count -= n;
+	}
+}
+
 void 
 readNextRun(RLEDecoder *decoder)
 {
@@ -7,11 +7,47 @@
 
 #include "cdb/cdbparquetrowgroup.h"
 #include "cdb/cdbparquetfooterserializer.h"
+#include "utils/date.h"
+#include "utils/guc.h"
+#include "utils/timestamp.h"
 
 static bool ParquetRowGroupReader_Select(FileSplit split,
                                          ParquetMetadata parquetMetadata,
                                          bool *rowGroupInfoProcessed);
 
+static bool ParquetRowGroupReader_Skip(BlockMetadata_4C *rowGroupMetadata,
+                                       TupleDesc hawqTupleDesc,
+                                       int *hawqAttrToParquetColChunks,
+                                       ScanKey scanKeys,
+                                       int numScanKeys);
+
+static bool decodeStatisticsValue(int hawqTypeId, uint8_t *value, int32_t len,
+                                  Datum *result);
+
+static void ParquetRowGroupReader_InitKeyAttrs(ParquetRowGroupReader *rowGroupReader,
+                                               bool *projs,
+                                               TupleDesc hawqTupleDesc,
+                                               int *hawqAttrToParquetColChunks,
+                                               ScanKey scanKeys,
+                                               int numScanKeys);
+
+static void ParquetRowGroupReader_FillBatch(ParquetRowGroupReader *rowGroupReader,
+                                            ParquetColumnReader *columnReader,
+                                            int hawqTypeID);
+
+static void ParquetRowGroupReader_ReadAttr(ParquetRowGroupReader *rowGroupReader,
+                                           ParquetColumnReader *columnReader,
+                                           int numColumnReaders,
+                                           int hawqTypeID,
+                                           Datum *value,
+                                           bool *null);
+
+static bool ParquetRowGroupReader_MatchKeys(bool *keyAttrs,
+                                            ScanKey scanKeys,
+                                            int numScanKeys,
+                                            Datum *values,
+                                            bool *nulls);
+
 /*
  * Initialize the ExecutorReadGroup once.  Assumed to be zeroed out before the call.
  */
@@ -36,7 +72,10 @@ ParquetRowGroupReader_Init(
 }
 
 /**
- * Get the information of row group, including column chunk information
+ * Get the information of row group, including column chunk information.
+ *
+ * Row groups whose column chunk statistics show that no row can satisfy
+ * `scanKeys` are skipped without reading their data.
  */
 bool
 ParquetRowGroupReader_GetRowGroupInfo(
@@ -46,6 +85,8 @@ ParquetRowGroupReader_GetRowGroupInfo(
 	bool 					*projs,
 	TupleDesc 				hawqTupleDesc,
 	int 					*hawqAttrToParquetColChunks,
+	ScanKey					scanKeys,
+	int						numScanKeys,
 	bool                    toCloseFile)
 {
 	ParquetMetadata parquetMetadata;
@@ -74,7 +115,17 @@ ParquetRowGroupReader_GetRowGroupInfo(
 		storageRead->preRead = false;
 
 		if (ParquetRowGroupReader_Select(split, parquetMetadata, &rowGroupInfoProcessed))
-			break;
+		{
+			if (!ParquetRowGroupReader_Skip(parquetMetadata->currentBlockMD,
+											hawqTupleDesc,
+											hawqAttrToParquetColChunks,
+											scanKeys,
+											numScanKeys))
+				break;
+
+			elog(DEBUG1, "parquet row group %d of %s skipped by statistics",
+				 rowGroupIndex, storageRead->segmentFileName);
+		}
 
 		/* done with current split and pre-read the next rowgroup info */
 		if (rowGroupInfoProcessed) {
@@ -157,11 +208,65 @@ ParquetRowGroupReader_GetRowGroupInfo(
 		parquetColIndex += parquetColChunkNum;
 	}
 
+	if (!rowGroupReader->keyAttrsInited)
+	{
+		ParquetRowGroupReader_InitKeyAttrs(rowGroupReader, projs, hawqTupleDesc,
+										   hawqAttrToParquetColChunks,
+										   scanKeys, numScanKeys);
+		rowGroupReader->keyAttrsInited = true;
+	}
+
 	MemoryContextSwitchTo(oldcontext);
 
 	return true;
 }
 
+/*
+ * Decide the attributes to evaluate scan keys on for late materialization,
+ * see ParquetRowGroupReader_ScanNextTuple(). Only keys on fixed length
+ * attributes are used, whose comparison is cheap and allocates no memory.
+ * rowGroupReader->keyAttrs is left NULL if no key is usable.
+ */
+static void
+ParquetRowGroupReader_InitKeyAttrs(
+	ParquetRowGroupReader	*rowGroupReader,
+	bool					*projs,
+	TupleDesc				hawqTupleDesc,
+	int						*hawqAttrToParquetColChunks,
+	ScanKey					scanKeys,
+	int						numScanKeys)
+{
+	bool *keyAttrs = NULL;
+
+	if (!gp_parquet_late_materialization)
+		return;
+
+	for (int i = 0; i < numScanKeys; i++)
+	{
+		int attno = scanKeys[i].sk_attno - 1;
+		int colIndex = 0;
+
+		if (!projs[attno] || hawqAttrToParquetColChunks[attno] != 1)
+			continue;
+
+		for (int j = 0; j < attno; j++)
+		{
+			if (projs[j])
+				colIndex += hawqAttrToParquetColChunks[j];
+		}
+
+		if (!ParquetColumnReader_canReadBatch(&rowGroupReader->columnReaders[colIndex],
+											  hawqTupleDesc->attrs[attno]->atttypid))
+			continue;
+
+		if (keyAttrs == NULL)
+			keyAttrs = (bool *) palloc0(hawqTupleDesc->natts * sizeof(bool));
+		keyAttrs[attno] = true;
+	}
+
+	rowGroupReader->keyAttrs = keyAttrs;
+}
+
 void
 ParquetRowGroupReader_GetContents(
 	ParquetRowGroupReader *rowGroupReader)
@@ -169,9 +274,100 @@ ParquetRowGroupReader_GetContents(
 	/*scan the file to get next row group data*/
 	ParquetColumnReader *columnReaders = rowGroupReader->columnReaders;
 	File file = rowGroupReader->storageRead->file;
-	for(int i = 0; i < rowGroupReader->columnReaderCount; i++){
-		ParquetExecutorReadColumn(&(columnReaders[i]), file);
+	int rangeNum = 0;
+	int i = 0;
+
+	if (rowGroupReader->coalesceBuffers == NULL)
+	{
+		rowGroupReader->coalesceBuffers = (char **)
+			MemoryContextAllocZero(rowGroupReader->memoryContext,
+					rowGroupReader->columnReaderCount * sizeof(char *));
+		rowGroupReader->coalesceBufferLens = (int64 *)
+			MemoryContextAllocZero(rowGroupReader->memoryContext,
+					rowGroupReader->columnReaderCount * sizeof(int64));
+	}
+
+	/*
+	 * Column chunks are laid out in column order, group the projected ones
+	 * that are close to each other into ranges, so that each range costs
+	 * one seek and one sequential read instead of one per chunk.
+	 */
+	while (i < rowGroupReader->columnReaderCount)
+	{
+		struct ColumnChunkMetadata_4C *first = columnReaders[i].columnMetadata;
+		int64 rangeStart = ParquetColumnChunkOffset(first);
+		int64 rangeEnd = rangeStart + first->totalSize;
+		int j = i + 1;
+
+		while (j < rowGroupReader->columnReaderCount)
+		{
+			struct ColumnChunkMetadata_4C *next = columnReaders[j].columnMetadata;
+			int64 nextStart = ParquetColumnChunkOffset(next);
+			int64 nextEnd = nextStart + next->totalSize;
+
+			if (nextStart < rangeEnd ||
+				nextStart - rangeEnd > PARQUET_COALESCE_MAX_GAP ||
+				nextEnd - rangeStart > PARQUET_COALESCE_MAX_SIZE)
+				break;
+
+			rangeEnd = nextEnd;
+			j++;
+		}
+
+		if (j == i + 1)
+		{
+			ParquetExecutorReadColumn(&(columnReaders[i]), file, NULL);
+		}
+		else
+		{
+			/*
+			 * The columns keep pointing into the buffer of their range until
+			 * the next row group, so each range has a buffer of its own.
+			 */
+			int64 rangeLen = rangeEnd - rangeStart;
+			char *rangeBuffer;
+
+			if (rowGroupReader->coalesceBufferLens[rangeNum] < rangeLen)
+			{
+				if (rowGroupReader->coalesceBuffers[rangeNum] != NULL)
+				{
+					pfree(rowGroupReader->coalesceBuffers[rangeNum]);
+					rowGroupReader->coalesceBuffers[rangeNum] = NULL;
+					rowGroupReader->coalesceBufferLens[rangeNum] = 0;
+				}
+				rowGroupReader->coalesceBuffers[rangeNum] = (char *)
+					MemoryContextAlloc(rowGroupReader->memoryContext, rangeLen);
+				rowGroupReader->coalesceBufferLens[rangeNum] = rangeLen;
+			}
+			rangeBuffer = rowGroupReader->coalesceBuffers[rangeNum];
+			rangeNum++;
+
+			ParquetExecutorReadFileRange(file, rangeStart, rangeBuffer,
+										 rangeLen, first->colName);
+
+			for (int k = i; k < j; k++)
+			{
+				int64 offset = ParquetColumnChunkOffset(columnReaders[k].columnMetadata);
+
+				ParquetExecutorReadColumn(&(columnReaders[k]), file,
+						rangeBuffer + (offset - rangeStart));
+			}
+		}
+
+		i = j;
+	}
+
+	/* don't hold on to the buffers of ranges this row group doesn't have */
+	for (; rangeNum < rowGroupReader->columnReaderCount; rangeNum++)
+	{
+		if (rowGroupReader->coalesceBuffers[rangeNum] != NULL)
+		{
+			pfree(rowGroupReader->coalesceBuffers[rangeNum]);
+			rowGroupReader->coalesceBuffers[rangeNum] = NULL;
+			rowGroupReader->coalesceBufferLens[rangeNum] = 0;
+		}
 	}
+
 	rowGroupReader->storageRead->rowGroupProcessedCount++;
 
 }
@@ -179,6 +375,11 @@ ParquetRowGroupReader_GetContents(
 /*
  * Get next tuple from current row group into slot.
  *
+ * With late materialization (rowGroupReader->keyAttrs is set), columns
+ * referenced by scan keys are read first, and other projected columns of
+ * rows rejected by the keys are skipped without decoding. Pages none of
+ * whose rows are selected are never decompressed.
+ *
  * Return false if current row group has no tuple left, true otherwise.
  */
 bool
@@ -187,28 +388,85 @@ ParquetRowGroupReader_ScanNextTuple(
 	ParquetRowGroupReader	*rowGroupReader,
 	int						*hawqAttrToParquetColNum,
 	bool 					*projs,
+	ScanKey					scanKeys,
+	int						numScanKeys,
 	TupleTableSlot 			*slot)
 {
 	Assert(slot);
 
-	if (rowGroupReader->rowRead >= rowGroupReader->rowCount)
-	{
-		ParquetRowGroupReader_FinishedScanRowGroup(rowGroupReader);
-		return false;
-	}
-
-	/*
-	 * get the next item (tuple) from the row group
-	 */
-	rowGroupReader->rowRead++;
-
 	int natts = slot->tts_tupleDescriptor->natts;
 	Assert(natts <=	tupDesc->natts);
 
 	Datum *values = slot_get_values(slot);
 	bool *nulls = slot_get_isnull(slot);
+	bool *keyAttrs = rowGroupReader->keyAttrs;
+
+	int colReaderIndex;
+
+	for (;;)
+	{
+		if (rowGroupReader->rowRead >= rowGroupReader->rowCount)
+		{
+			ParquetRowGroupReader_FinishedScanRowGroup(rowGroupReader);
+			return false;
+		}
+
+		/*
+		 * get the next item (tuple) from the row group
+		 */
+		rowGroupReader->rowRead++;
 
-	int colReaderIndex = 0;
+		if (keyAttrs == NULL)
+			break;
+
+		colReaderIndex = 0;
+		for(int i = 0; i < natts; i++)
+		{
+			if(projs[i] == false)
+				continue;
+
+			if (keyAttrs[i])
+			{
+				ParquetRowGroupReader_ReadAttr(rowGroupReader,
+						&rowGroupReader->columnReaders[colReaderIndex],
+						hawqAttrToParquetColNum[i], tupDesc->attrs[i]->atttypid,
+						&values[i], &nulls[i]);
+			}
+			colReaderIndex += hawqAttrToParquetColNum[i];
+		}
+
+		if (ParquetRowGroupReader_MatchKeys(keyAttrs, scanKeys, numScanKeys, values, nulls))
+			break;
+
+		/* row rejected, skip it in other columns */
+		colReaderIndex = 0;
+		for(int i = 0; i < natts; i++)
+		{
+			if(projs[i] == false)
+				continue;
+
+			ParquetColumnReader *nextReader =
+				&rowGroupReader->columnReaders[colReaderIndex];
+
+			if (keyAttrs[i])
+			{
+				/* already read */
+			}
+			else if (hawqAttrToParquetColNum[i] == 1 && nextReader->columnMetadata->r == 0)
+			{
+				nextReader->skipCount++;
+			}
+			else
+			{
+				ParquetRowGroupReader_ReadAttr(rowGroupReader, nextReader,
+						hawqAttrToParquetColNum[i], tupDesc->attrs[i]->atttypid,
+						&values[i], &nulls[i]);
+			}
+			colReaderIndex += hawqAttrToParquetColNum[i];
+		}
+	}
+
+	colReaderIndex = 0;
 	for(int i = 0; i < natts; i++)
 	{
 		if(projs[i] == false)
@@ -217,50 +475,21 @@ ParquetRowGroupReader_ScanNextTuple(
 			continue;
 		}
 
-		ParquetColumnReader *nextReader =
-			&rowGroupReader->columnReaders[colReaderIndex];
-		int hawqTypeID = tupDesc->attrs[i]->atttypid;
-
-		if(hawqAttrToParquetColNum[i] == 1)
-		{
-			ParquetColumnReader_readValue(nextReader, &values[i], &nulls[i], hawqTypeID);
-		}
-		else
+		if (keyAttrs == NULL || !keyAttrs[i])
 		{
-			/*
-			 * Because there are some memory reused inside the whole column reader, so need
-			 * to switch the context from PerTupleContext to rowgroup->context
-			 */
-			MemoryContext oldContext = MemoryContextSwitchTo(rowGroupReader->memoryContext);
+			ParquetColumnReader *nextReader =
+				&rowGroupReader->columnReaders[colReaderIndex];
+			int hawqTypeID = tupDesc->attrs[i]->atttypid;
 
-			switch(hawqTypeID)
+			if (nextReader->skipCount > 0)
 			{
-				case HAWQ_TYPE_POINT:
-					ParquetColumnReader_readPoint(nextReader, &values[i], &nulls[i]);
-					break;
-				case HAWQ_TYPE_PATH:
-					ParquetColumnReader_readPATH(nextReader, &values[i], &nulls[i]);
-					break;
-				case HAWQ_TYPE_LSEG:
-					ParquetColumnReader_readLSEG(nextReader, &values[i], &nulls[i]);
-					break;
-				case HAWQ_TYPE_BOX:
-					ParquetColumnReader_readBOX(nextReader, &values[i], &nulls[i]);
-					break;
-				case HAWQ_TYPE_CIRCLE:
-					ParquetColumnReader_readCIRCLE(nextReader, &values[i], &nulls[i]);
-					break;
-				case HAWQ_TYPE_POLYGON:
-					ParquetColumnReader_readPOLYGON(nextReader, &values[i], &nulls[i]);
-					break;
-				default:
-					/* TODO array type */
-					/* TODO UDT */
-					Insist(false);
-					break;
+				ParquetColumnReader_skipValues(nextReader, nextReader->skipCount, hawqTypeID);
+				nextReader->skipCount = 0;
 			}
 
-			MemoryContextSwitchTo(oldContext);
+			ParquetRowGroupReader_ReadAttr(rowGroupReader, nextReader,
+					hawqAttrToParquetColNum[i], hawqTypeID,
+					&values[i], &nulls[i]);
 		}
 
 		colReaderIndex += hawqAttrToParquetColNum[i];
@@ -271,6 +500,135 @@ ParquetRowGroupReader_ScanNextTuple(
 	return true;
 }
 
+/*
+ * Read value of current row of a hawq attribute, which is stored in
+ * `numColumnReaders` column readers starting from `columnReader`.
+ */
+static void
+ParquetRowGroupReader_ReadAttr(
+	ParquetRowGroupReader	*rowGroupReader,
+	ParquetColumnReader		*columnReader,
+	int						numColumnReaders,
+	int						hawqTypeID,
+	Datum					*value,
+	bool					*null)
+{
+	if(numColumnReaders == 1 &&
+	   ParquetColumnReader_canReadBatch(columnReader, hawqTypeID))
+	{
+		/*
+		 * Fixed length columns are decoded a batch at a time, which
+		 * avoids the per value dispatch in ParquetColumnReader_readValue.
+		 */
+		if (columnReader->batchPos >= columnReader->batchCount)
+		{
+			ParquetRowGroupReader_FillBatch(rowGroupReader, columnReader, hawqTypeID);
+		}
+
+		*value = columnReader->batchValues[columnReader->batchPos];
+		*null = columnReader->batchNulls[columnReader->batchPos];
+		columnReader->batchPos++;
+	}
+	else if(numColumnReaders == 1)
+	{
+		ParquetColumnReader_readValue(columnReader, value, null, hawqTypeID);
+	}
+	else
+	{
+		/*
+		 * Because there are some memory reused inside the whole column reader, so need
+		 * to switch the context from PerTupleContext to rowgroup->context
+		 */
+		MemoryContext oldContext = MemoryContextSwitchTo(rowGroupReader->memoryContext);
+
+		switch(hawqTypeID)
+		{
+			case HAWQ_TYPE_POINT:
+				ParquetColumnReader_readPoint(columnReader, value, null);
+				break;
+			case HAWQ_TYPE_PATH:
+				ParquetColumnReader_readPATH(columnReader, value, null);
+				break;
+			case HAWQ_TYPE_LSEG:
+				ParquetColumnReader_readLSEG(columnReader, value, null);
+				break;
+			case HAWQ_TYPE_BOX:
+				ParquetColumnReader_readBOX(columnReader, value, null);
+				break;
+			case HAWQ_TYPE_CIRCLE:
+				ParquetColumnReader_readCIRCLE(columnReader, value, null);
+				break;
+			case HAWQ_TYPE_POLYGON:
+				ParquetColumnReader_readPOLYGON(columnReader, value, null);
+				break;
+			default:
+				/* TODO array type */
+				/* TODO UDT */
+				Insist(false);
+				break;
+		}
+
+		MemoryContextSwitchTo(oldContext);
+	}
+}
+
+/*
+ * Evaluate the scan keys on attributes flagged in `keyAttrs`, return false
+ * if current row can't satisfy all of them.
+ */
+static bool
+ParquetRowGroupReader_MatchKeys(
+	bool					*keyAttrs,
+	ScanKey					scanKeys,
+	int						numScanKeys,
+	Datum					*values,
+	bool					*nulls)
+{
+	for (int i = 0; i < numScanKeys; i++)
+	{
+		ScanKey key = &scanKeys[i];
+		int attno = key->sk_attno - 1;
+		int32 cmp;
+
+		if (!keyAttrs[attno])
+			continue;
+
+		/* btree operators are strict */
+		if (nulls[attno])
+			return false;
+
+		cmp = DatumGetInt32(FunctionCall2(&key->sk_func, values[attno], key->sk_argument));
+
+		switch (key->sk_strategy)
+		{
+			case BTLessStrategyNumber:
+				if (cmp >= 0)
+					return false;
+				break;
+			case BTLessEqualStrategyNumber:
+				if (cmp > 0)
+					return false;
+				break;
+			case BTEqualStrategyNumber:
+				if (cmp != 0)
+					return false;
+				break;
+			case BTGreaterEqualStrategyNumber:
+				if (cmp < 0)
+					return false;
+				break;
+			case BTGreaterStrategyNumber:
+				if (cmp <= 0)
+					return false;
+				break;
+			default:
+				break;
+		}
+	}
+
+	return true;
+}
+
 /**
  * finish scanning row group, but keeping the structure palloced
  */
@@ -288,6 +646,46 @@ ParquetRowGroupReader_FinishedScanRowGroup(
 	}
 }
 
+/*
+ * Decode next batch of values of a fixed length column, starting from the
+ * value of current tuple. Never decodes beyond the rows of the row group.
+ */
+static void
+ParquetRowGroupReader_FillBatch(
+	ParquetRowGroupReader	*rowGroupReader,
+	ParquetColumnReader		*columnReader,
+	int						hawqTypeID)
+{
+	int count;
+
+	if (columnReader->batchValues == NULL)
+	{
+		MemoryContext oldContext = MemoryContextSwitchTo(columnReader->memoryContext);
+
+		columnReader->batchValues = (Datum *) palloc(PARQUET_READ_BATCH_SIZE * sizeof(Datum));
+		columnReader->batchNulls = (bool *) palloc(PARQUET_READ_BATCH_SIZE * sizeof(bool));
+		columnReader->levelBuffer = (int *) palloc(PARQUET_READ_BATCH_SIZE * sizeof(int));
+
+		MemoryContextSwitchTo(oldContext);
+	}
+
+	/* rowRead already counts current tuple */
+	count = Min(PARQUET_READ_BATCH_SIZE,
+				rowGroupReader->rowCount - rowGroupReader->rowRead + 1);
+
+	columnReader->batchCount = ParquetColumnReader_readBatch(columnReader,
+			columnReader->batchValues, columnReader->batchNulls, count, hawqTypeID);
+	columnReader->batchPos = 0;
+
+	if (columnReader->batchCount == 0)
+	{
+		ereport(ERROR,
+				(errcode(ERRCODE_GP_INTERNAL_ERROR),
+				 errmsg("column %s of parquet row group has fewer values than rows",
+						columnReader->columnMetadata->colName)));
+	}
+}
+
 static bool ParquetRowGroupReader_Select(FileSplit split,
                                          ParquetMetadata parquetMetadata,
                                          bool *rowGroupInfoProcessed) {
@@ -314,3 +712,166 @@ static bool ParquetRowGroupReader_Select(FileSplit split,
 
   return false;
 }
+
+/*
+ * Check the scan keys against column chunk statistics of the row group.
+ *
+ * Return true if no row of the row group can satisfy all the scan keys.
+ * Each scan key is `attr <strategy> sk_argument` with a btree comparison
+ * function in sk_func, see parquet_beginscan().
+ */
+static bool
+ParquetRowGroupReader_Skip(BlockMetadata_4C *rowGroupMetadata,
+                           TupleDesc hawqTupleDesc,
+                           int *hawqAttrToParquetColChunks,
+                           ScanKey scanKeys,
+                           int numScanKeys)
+{
+	for (int i = 0; i < numScanKeys; i++)
+	{
+		ScanKey key = &scanKeys[i];
+		int attno = key->sk_attno - 1;
+		int colIndex = 0;
+		struct ColumnChunkMetadata_4C *chunk;
+		Datum minValue;
+		Datum maxValue;
+		int32 cmpMin;
+		int32 cmpMax;
+
+		/* statistics of nested types are not useful */
+		if (hawqAttrToParquetColChunks[attno] != 1)
+			continue;
+
+		for (int j = 0; j < attno; j++)
+			colIndex += hawqAttrToParquetColChunks[j];
+
+		chunk = &rowGroupMetadata->columns[colIndex];
+		if (!chunk->hasStatistics)
+			continue;
+
+		/* btree operators are strict, nulls never satisfy the key */
+		if (chunk->nullCount == chunk->valueCount)
+			return true;
+
+		if (!decodeStatisticsValue(hawqTupleDesc->attrs[attno]->atttypid,
+								   chunk->minValue, chunk->minValueLen, &minValue) ||
+			!decodeStatisticsValue(hawqTupleDesc->attrs[attno]->atttypid,
+								   chunk->maxValue, chunk->maxValueLen, &maxValue))
+			continue;
+
+		cmpMin = DatumGetInt32(FunctionCall2(&key->sk_func, minValue, key->sk_argument));
+		cmpMax = DatumGetInt32(FunctionCall2(&key->sk_func, maxValue, key->sk_argument));
+
+		switch (key->sk_strategy)
+		{
+			case BTLessStrategyNumber:
+				if (cmpMin >= 0)
+					return true;
+				break;
+			case BTLessEqualStrategyNumber:
+				if (cmpMin > 0)
+					return true;
+				break;
+			case BTEqualStrategyNumber:
+				if (cmpMin > 0 || cmpMax < 0)
+					return true;
+				break;
+			case BTGreaterEqualStrategyNumber:
+				if (cmpMax < 0)
+					return true;
+				break;
+			case BTGreaterStrategyNumber:
+				if (cmpMax <= 0)
+					return true;
+				break;
+			default:
+				break;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Convert PLAIN encoded min/max value in column chunk statistics to Datum.
+ *
+ * Return false if the value is absent or of unexpected length.
+ */
+static bool
+decodeStatisticsValue(int hawqTypeId, uint8_t *value, int32_t len, Datum *result)
+{
+	if (value == NULL)
+		return false;
+
+	switch (hawqTypeId)
+	{
+		case HAWQ_TYPE_INT2:
+		case HAWQ_TYPE_INT4:
+		case HAWQ_TYPE_DATE:
+		case HAWQ_TYPE_FLOAT4:
+		{
+			int32 val;
+
+			if (len != 4)
+				return false;
+			memcpy(&val, value, len);
+
+			if (hawqTypeId == HAWQ_TYPE_INT2)
+				*result = Int16GetDatum((int16) val);
+			else if (hawqTypeId == HAWQ_TYPE_INT4)
+				*result = Int32GetDatum(val);
+			else if (hawqTypeId == HAWQ_TYPE_DATE)
+				*result = DateADTGetDatum((DateADT) val);
+			else
+			{
+				float4 fval;
+				memcpy(&fval, value, len);
+				*result = Float4GetDatum(fval);
+			}
+			return true;
+		}
+		case HAWQ_TYPE_INT8:
+		{
+			int64 val;
+
+			if (len != 8)
+				return false;
+			memcpy(&val, value, len);
+			*result = Int64GetDatum(val);
+			return true;
+		}
+		case HAWQ_TYPE_TIME:
+		{
+			TimeADT val;
+
+			if (len != 8)
+				return false;
+			memcpy(&val, value, len);
+			*result = TimeADTGetDatum(val);
+			return true;
+		}
+		case HAWQ_TYPE_TIMESTAMP:
+		case HAWQ_TYPE_TIMESTAMPTZ:
+		{
+			Timestamp val;
+
+			if (len != 8)
+				return false;
+			memcpy(&val, value, len);
+			*result = TimestampGetDatum(val);
+			return true;
+		}
+		case HAWQ_TYPE_FLOAT8:
+		{
+			float8 val;
+
+			if (len != 8)
+				return false;
+			memcpy(&val, value, len);
+			*result = Float8GetDatum(val);
+			return true;
+		}
+		default:
+			return false;
+	}
+}
@@ -8,6 +8,9 @@
 
 #include "postgres.h"
 
+#include <math.h>
+
+#include "access/hash.h"
 #include "catalog/catquery.h"
 #include "cdb/cdbparquetstoragewrite.h"
 #include "cdb/cdbparquetfooterserializer.h"
@@ -18,6 +21,7 @@
 #include "utils/numeric.h"
 #include "utils/xml.h"
 #include "utils/inet.h"
+#include "utils/guc.h"
 
 #include "snappy-c.h"
 #include "zlib.h"
@@ -36,6 +40,45 @@ static void flushDataPage(
 		ParquetColumnChunk chunk,
 		int page_number);
 
+static void flushPage(
+		ParquetDataPage page);
+
+static void initValuesBuffer(
+		ParquetColumnChunk chunk);
+
+static void compressAndSerializePage(
+		ParquetColumnChunk chunk,
+		ParquetDataPage page,
+		StringInfo buf);
+
+/* dictionary encoding */
+static void addDictionary(
+		ParquetColumnChunk chunk);
+
+static int lookupDictionary(
+		ParquetColumnChunk chunk,
+		Datum value,
+		int *index);
+
+static void growDictionaryHash(
+		ParquetColumnChunk chunk);
+
+static void appendDictionaryIndex(
+		ParquetDataPage page,
+		int index);
+
+static void encodeDictionaryPage(
+		ParquetColumnChunk chunk);
+
+static void freeDictionary(
+		ParquetColumnChunk chunk);
+
+static int dictionaryIndexBitWidth(int32_t maxIndex);
+
+static int statisticsValueLength(int hawqTypeId);
+static void updateStatistics(ColumnChunkMetadata chunkmd, Datum value);
+static int compareStatisticsValue(int hawqTypeId, uint8_t *a, uint8_t *b);
+
 static void initGroupType(
 		FileField_4C *field,
 		char *name,
@@ -180,6 +223,10 @@ static bool ensureBufferCapacity(ParquetDataPage page,
 #define ENCODE_INVALID_VALUE	-1
 #define ENCODE_OUTOF_PAGE		-2
 
+#define DICTIONARY_HASH_INIT_SIZE		1024	/* must be power of 2 */
+#define DICTIONARY_INDICES_INIT_CAPACITY	1024
+#define DICTIONARY_BUFFER_INIT_SIZE		1024
+
 /**
  * generate hawq schema in to string. for example:
  *
@@ -915,6 +962,14 @@ flushRowGroup(ParquetRowGroup rowgroup,
 
 		bytes_added += encodeCurrentPage(chunk);
 
+		/* dictionary page is needed only if some value has been encoded with it */
+		bool hasDictionary = (chunk->dictionaryPage != NULL &&
+							  chunk->dictionaryPage->header->num_values > 0);
+		if (hasDictionary)
+		{
+			encodeDictionaryPage(chunk);
+		}
+
 		/*----------------------------------------------------------------
 		 * recompute estimate chunk size based on uncompressed size (excludes header)
 		 *----------------------------------------------------------------*/
@@ -925,6 +980,26 @@ flushRowGroup(ParquetRowGroup rowgroup,
 		}
 		parquetmd->estimateChunkSizes[i] = (int) (parquetmd->estimateChunkSizes[i] * 1.05);
 
+		/*----------------------------------------------------------------
+		 * write out dictionary page before all the data pages
+		 *----------------------------------------------------------------*/
+		if (hasDictionary)
+		{
+			chunkmd->dictionaryPageOffset = FileNonVirtualTell(rowgroup->parquetFile);
+			if (chunkmd->dictionaryPageOffset < 0)
+			{
+				ereport(ERROR,
+						(errcode_for_file_access(),
+						 errmsg("file tell position error for segment file: %s", strerror(errno)),
+						 errdetail("%s", HdfsGetLastError())));
+			}
+			flushPage(chunk->dictionaryPage);
+
+			chunkmd->pEncodings = repalloc(chunkmd->pEncodings,
+										   (chunkmd->EncodingCount + 1) * sizeof(enum Encoding));
+			chunkmd->pEncodings[chunkmd->EncodingCount++] = PLAIN_DICTIONARY;
+		}
+
 		/*----------------------------------------------------------------
 		 * write out pages one by one
 		 *----------------------------------------------------------------*/
@@ -1004,6 +1079,11 @@ freeRowGroup(ParquetRowGroup rowgroup)
 	{
 		pfree(rowgroup->columnChunks[i].pages);
 
+		if (rowgroup->columnChunks[i].dictionaryPage != NULL)
+		{
+			freeDictionary(&rowgroup->columnChunks[i]);
+		}
+
 		/* chunk metadata should be kept util parquet_insert_finish */
 		rowgroup->columnChunks[i].columnChunkMetadata = NULL;
 	}
@@ -1054,10 +1134,24 @@ addSingleColumn(AppendOnlyEntry *catalog,
 		chunkmd->pEncodings[2] 			= PLAIN; /*set data encoding as PLAIN*/
 		chunkmd->file_offset 			= 0;
 		chunkmd->firstDataPage 			= 0;
+		chunkmd->dictionaryPageOffset	= 0;
 		chunkmd->totalSize 				= 0;
 		chunkmd->totalUncompressedSize 	= 0;
 		chunkmd->valueCount 			= 0;
 
+		/* min/max buffers are allocated here, filled by the first non-null value */
+		chunkmd->hasStatistics			= true;
+		chunkmd->nullCount				= 0;
+		chunkmd->minValueLen			= 0;
+		chunkmd->maxValueLen			= 0;
+		chunkmd->minValue				= NULL;
+		chunkmd->maxValue				= NULL;
+		if (statisticsValueLength(field->hawqTypeId) > 0)
+		{
+			chunkmd->minValue = palloc0(statisticsValueLength(field->hawqTypeId));
+			chunkmd->maxValue = palloc0(statisticsValueLength(field->hawqTypeId));
+		}
+
 		if (catalog->compresstype == NULL)
 		{
 			chunkmd->codec = UNCOMPRESSED;
@@ -1110,6 +1204,17 @@ addSingleColumn(AppendOnlyEntry *catalog,
 		chunk->compresslevel				= catalog->compresslevel;
 		chunk->parquetFile					= parquetFile;
 
+		/*
+		 * Dictionary encoding for top level columns, nested columns of geometric
+		 * types are mostly distinct float8 values which don't benefit from it.
+		 */
+		if (gp_parquet_dictionary_encoding &&
+			field->type != BOOLEAN &&
+			field->depth == 1)
+		{
+			addDictionary(chunk);
+		}
+
 		*colIndex = *colIndex + 1;
 	}
 }
@@ -1120,7 +1225,15 @@ addSingleColumn(AppendOnlyEntry *catalog,
 static void
 flushDataPage(ParquetColumnChunk chunk, int page_number)
 {
-	ParquetDataPage page = &chunk->pages[page_number];
+	flushPage(&chunk->pages[page_number]);
+}
+
+/*
+ * Write out a finalized page, data page or dictionary page
+ */
+static void
+flushPage(ParquetDataPage page)
+{
 	Assert(page != NULL);
 	Assert(page->finalized);
 	Assert(page->header_buffer != NULL);
@@ -1612,6 +1725,33 @@ encodeCurrentPage(ParquetColumnChunk chunk)
 		bytes_added += BitPack_Flush(current_page->bool_values);
 	}
 
+	/*
+	 * For dictionary encoded page, values are the dictionary indices:
+	 * <1-byte bit width> + <rle/bitpack encoded indices>
+	 *
+	 * A page containing only nulls has no index at all, write it as PLAIN
+	 * since there may be no dictionary page for the chunk.
+	 */
+	RLEEncoder *dict_indices_encoder = NULL;
+	if (current_page->dict_indices != NULL)
+	{
+		if (current_page->dict_indices_count == 0)
+		{
+			header->encoding = PLAIN;
+		}
+		else
+		{
+			dict_indices_encoder = palloc0(sizeof(RLEEncoder));
+			RLEEncoder_Init(dict_indices_encoder,
+							dictionaryIndexBitWidth(current_page->dict_max_index));
+			for (int i = 0; i < current_page->dict_indices_count; i++)
+			{
+				RLEEncoder_WriteInt(dict_indices_encoder, current_page->dict_indices[i]);
+			}
+			bytes_added += 1 + RLEEncoder_Flush(dict_indices_encoder);
+		}
+	}
+
 	header->uncompressed_page_size += bytes_added;
 
 	/* we must make sure there is no empty page, since some compression algorithm
@@ -1661,6 +1801,24 @@ encodeCurrentPage(ParquetColumnChunk chunk)
 		pfree(current_page->bool_values->buffer);
 		pfree(current_page->bool_values);
 	}
+	else if (current_page->dict_indices != NULL)
+	{
+		if (dict_indices_encoder != NULL)
+		{
+			uint8_t bitWidth = (uint8_t) dict_indices_encoder->bitWidth;
+			appendBinaryStringInfo(&buf, &bitWidth, 1);
+			appendBinaryStringInfo(&buf,
+								   RLEEncoder_Data(dict_indices_encoder),
+								   RLEEncoder_Size(dict_indices_encoder));
+
+			pfree(dict_indices_encoder->writer.buffer);
+			pfree(dict_indices_encoder->packBuffer);
+			pfree(dict_indices_encoder);
+		}
+
+		pfree(current_page->dict_indices);
+		current_page->dict_indices = NULL;
+	}
 	else
 	{
 		appendBinaryStringInfo(&buf,
@@ -1670,6 +1828,25 @@ encodeCurrentPage(ParquetColumnChunk chunk)
 		pfree(current_page->values_buffer);
 	}
 
+	compressAndSerializePage(chunk, current_page, &buf);
+
+	return bytes_added;
+}
+
+/*
+ * Compress page content in `buf` if needed and save it to page->data, then
+ * serialize the page header and account the page into its column chunk.
+ *
+ * `buf` is consumed by this routine.
+ */
+static void
+compressAndSerializePage(ParquetColumnChunk chunk,
+						 ParquetDataPage current_page,
+						 StringInfo buf)
+{
+	ParquetPageHeader header = current_page->header;
+	ColumnChunkMetadata chunkmd = chunk->columnChunkMetadata;
+
 	/*----------------------------------------------------------------
 	 * Compress page data if needed, saved it to current_page->data.
 	 *----------------------------------------------------------------*/
@@ -1677,7 +1854,7 @@ encodeCurrentPage(ParquetColumnChunk chunk)
 	{
 		case UNCOMPRESSED:
 		{
-			current_page->data = (uint8_t*) buf.data;
+			current_page->data = (uint8_t*) buf->data;
 			header->compressed_page_size = header->uncompressed_page_size;
 			break;
 		}
@@ -1687,10 +1864,10 @@ encodeCurrentPage(ParquetColumnChunk chunk)
 			size_t compressedLen = snappy_max_compressed_length(header->uncompressed_page_size);
 			current_page->data = (uint8_t *) palloc(compressedLen);
 
-			if (snappy_compress(buf.data, header->uncompressed_page_size,
+			if (snappy_compress(buf->data, header->uncompressed_page_size,
 								(char *)current_page->data, &compressedLen) == SNAPPY_OK)
 			{
-				pfree(buf.data);
+				pfree(buf->data);
 				header->compressed_page_size = compressedLen;
 			}
 			else
@@ -1713,7 +1890,7 @@ encodeCurrentPage(ParquetColumnChunk chunk)
 			stream.zfree	= Z_NULL;
 			stream.opaque	= Z_NULL;
 			stream.avail_in	= header->uncompressed_page_size;
-			stream.next_in	= (Bytef *) buf.data;
+			stream.next_in	= (Bytef *) buf->data;
 
 			ret = deflateInit2(&stream, chunk->compresslevel, Z_DEFLATED,
 							   windowbits, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY);
@@ -1760,7 +1937,7 @@ encodeCurrentPage(ParquetColumnChunk chunk)
 			compressedLen = stream.total_out;
 			deflateEnd(&stream);
 
-			pfree(buf.data);
+			pfree(buf->data);
 			header->compressed_page_size = compressedLen;
 			break;
 		}
@@ -1795,8 +1972,6 @@ encodeCurrentPage(ParquetColumnChunk chunk)
 	chunkmd->totalSize				+= current_page->header_len + header->compressed_page_size;
 	
 	current_page->finalized = true;
-
-	return bytes_added;
 }
 
 static void
@@ -1840,29 +2015,45 @@ addDataPage(ParquetColumnChunk chunk)
 		chunk->currentPage->bool_values = palloc0(sizeof(ByteBasedBitPackingEncoder));
 		BitPack_InitEncoder(chunk->currentPage->bool_values, /*bitWidth=*/1);
 	}
+	else if (chunk->dictionaryPage != NULL && !chunk->dictionaryFallback)
+	{
+		chunk->currentPage->header->encoding = PLAIN_DICTIONARY;
+		chunk->currentPage->dict_indices_capacity = DICTIONARY_INDICES_INIT_CAPACITY;
+		chunk->currentPage->dict_indices =
+				palloc(chunk->currentPage->dict_indices_capacity * sizeof(int32_t));
+	}
 	else
 	{
-		int max_buffer_size = chunk->pageSizeLimit;
-		int min_buffer_size = 512;
-		if (chunk->estimateChunkSizeRemained > max_buffer_size)
-		{
-			chunk->currentPage->values_buffer_capacity = max_buffer_size;
-			chunk->estimateChunkSizeRemained -= max_buffer_size;
-		}
-		else if (chunk->estimateChunkSizeRemained < min_buffer_size)
-		{
-			chunk->currentPage->values_buffer_capacity = min_buffer_size;
-		}
-		else
-		{
-			chunk->currentPage->values_buffer_capacity = chunk->estimateChunkSizeRemained;
-		}
-		chunk->currentPage->values_buffer = palloc0(chunk->currentPage->values_buffer_capacity);
+		initValuesBuffer(chunk);
 	}
 
 	chunk->pageNumber++;
 }
 
+/*
+ * Allocate values_buffer for current PLAIN encoded page of `chunk`.
+ */
+static void
+initValuesBuffer(ParquetColumnChunk chunk)
+{
+	int max_buffer_size = chunk->pageSizeLimit;
+	int min_buffer_size = 512;
+	if (chunk->estimateChunkSizeRemained > max_buffer_size)
+	{
+		chunk->currentPage->values_buffer_capacity = max_buffer_size;
+		chunk->estimateChunkSizeRemained -= max_buffer_size;
+	}
+	else if (chunk->estimateChunkSizeRemained < min_buffer_size)
+	{
+		chunk->currentPage->values_buffer_capacity = min_buffer_size;
+	}
+	else
+	{
+		chunk->currentPage->values_buffer_capacity = chunk->estimateChunkSizeRemained;
+	}
+	chunk->currentPage->values_buffer = palloc0(chunk->currentPage->values_buffer_capacity);
+}
+
 int
 appendParquetColumnNull(ParquetColumnChunk columnChunk)
 {
@@ -1889,6 +2080,7 @@ appendParquetColumnNull(ParquetColumnChunk columnChunk)
 
 	columnChunk->currentPage->header->num_values++;
 	columnChunk->columnChunkMetadata->valueCount++;
+	columnChunk->columnChunkMetadata->nullCount++;
 	return bytes_added;
 }
 
@@ -1935,6 +2127,43 @@ appendParquetColumnValue(ParquetColumnChunk chunk,
 		addDataPage(chunk);
 	}
 
+	if (chunk->currentPage->header->encoding == PLAIN_DICTIONARY)
+	{
+		int index;
+
+		/* If page size exceeds limit, finalize current data page and add a new one*/
+		if (approximatePageSize(chunk->currentPage) >= chunk->pageSizeLimit)
+		{
+			bytes_added += finalizeCurrentAndNewPage(chunk);
+		}
+
+		encoded_len = lookupDictionary(chunk, value, &index);
+		if (encoded_len >= 0)
+		{
+			/* value bytes (if any) go to dictionary page, only index is in data page */
+			appendDictionaryIndex(chunk->currentPage, index);
+			bytes_added += encoded_len;
+			goto append_levels;
+		}
+
+		/*
+		 * Dictionary is full, the rest of the chunk falls back to PLAIN.
+		 * Current page keeps the dictionary encoding if it has any index.
+		 */
+		chunk->dictionaryFallback = true;
+		if (chunk->currentPage->dict_indices_count == 0)
+		{
+			pfree(chunk->currentPage->dict_indices);
+			chunk->currentPage->dict_indices = NULL;
+			chunk->currentPage->header->encoding = PLAIN;
+			initValuesBuffer(chunk);
+		}
+		else
+		{
+			bytes_added += finalizeCurrentAndNewPage(chunk);
+		}
+	}
+
 	encoded_len = encodePlain(value,
 							  chunk->currentPage,
 							  chunk->columnChunkMetadata->hawqTypeId,
@@ -1959,7 +2188,9 @@ appendParquetColumnValue(ParquetColumnChunk chunk,
 	}
 
 	bytes_added += encoded_len;
+	chunk->currentPage->header->uncompressed_page_size += encoded_len;
 
+append_levels:
 	if (chunk->currentPage->repetition_level != NULL)
 	{
 		RLEEncoder_WriteInt(chunk->currentPage->repetition_level, r);
@@ -1970,10 +2201,14 @@ appendParquetColumnValue(ParquetColumnChunk chunk,
 	}
 
 	chunk->currentPage->header->num_values++;
-	chunk->currentPage->header->uncompressed_page_size += encoded_len;
 
 	chunk->columnChunkMetadata->valueCount++;
 
+	if (chunk->columnChunkMetadata->minValue != NULL)
+	{
+		updateStatistics(chunk->columnChunkMetadata, value);
+	}
+
 	return bytes_added;
 }
 
@@ -2333,5 +2568,377 @@ approximatePageSize(ParquetDataPage page)
 	if (page->definition_level != NULL)
 		size += RLEEncoder_Size(page->definition_level);
 
+	if (page->dict_indices != NULL)
+		size += 1 + (page->dict_indices_count *
+					 dictionaryIndexBitWidth(page->dict_max_index) + 7) / 8;
+
 	return size;
 }
+
+/*----------------------------------------------------------------
+ * dictionary encoding
+ *
+ * Dictionary of a column chunk is kept as a dictionary page, whose
+ * values_buffer contains PLAIN encoded distinct values of the chunk.
+ * Data pages store RLE/bitpack encoded indices of the entries instead
+ * of the values themselves. Since entries are compared by their PLAIN
+ * encoded bytes, all the types supported by encodePlain() work.
+ *----------------------------------------------------------------*/
+
+/*
+ * Create an empty dictionary for `chunk`.
+ */
+static void
+addDictionary(ParquetColumnChunk chunk)
+{
+	ParquetDataPage dictionaryPage;
+
+	dictionaryPage = palloc0(sizeof(struct ParquetDataPage_S));
+	dictionaryPage->header = (ParquetPageHeader) palloc0(sizeof(PageMetadata_4C));
+	dictionaryPage->header->page_type = DICTIONARY_PAGE;
+	dictionaryPage->header->encoding = PLAIN_DICTIONARY;
+	dictionaryPage->parquetFile = chunk->parquetFile;
+	dictionaryPage->values_buffer_capacity = Min(DICTIONARY_BUFFER_INIT_SIZE,
+												 chunk->pageSizeLimit);
+	dictionaryPage->values_buffer = palloc0(dictionaryPage->values_buffer_capacity);
+
+	chunk->dictionaryPage		= dictionaryPage;
+	chunk->dictionaryHashSize	= DICTIONARY_HASH_INIT_SIZE;
+	chunk->dictionaryHash		= palloc0(chunk->dictionaryHashSize * sizeof(int));
+	chunk->dictionaryOffsets	= palloc(chunk->dictionaryHashSize / 2 * sizeof(int));
+	chunk->dictionaryFallback	= false;
+}
+
+/*
+ * Look up `value` in the dictionary of `chunk`, add it as a new entry if
+ * not found. The entry index is returned in `index`.
+ *
+ * Return number of bytes added to the dictionary page, or ENCODE_OUTOF_PAGE /
+ * ENCODE_INVALID_VALUE if the dictionary page cannot hold the new value.
+ */
+static int
+lookupDictionary(ParquetColumnChunk chunk, Datum value, int *index)
+{
+	ParquetDataPage dictionaryPage = chunk->dictionaryPage;
+	ParquetPageHeader header = dictionaryPage->header;
+	uint8_t		*entry;
+	uint32		hash;
+	int			mask;
+	int			slot;
+	int			len;
+
+	/* encode the value at the end of the dictionary, not accounted yet */
+	len = encodePlain(value, dictionaryPage,
+					  chunk->columnChunkMetadata->hawqTypeId,
+					  chunk->pageSizeLimit);
+	if (len < 0)
+		return len;
+
+	entry = dictionaryPage->values_buffer + header->uncompressed_page_size;
+	hash = DatumGetUInt32(hash_any((unsigned char *) entry, len));
+
+	mask = chunk->dictionaryHashSize - 1;
+	for (slot = hash & mask; chunk->dictionaryHash[slot] != 0; slot = (slot + 1) & mask)
+	{
+		int i = chunk->dictionaryHash[slot] - 1;
+		int start = chunk->dictionaryOffsets[i];
+		int end = (i + 1 == header->num_values) ?
+				header->uncompressed_page_size : chunk->dictionaryOffsets[i + 1];
+
+		if (end - start == len &&
+			memcmp(dictionaryPage->values_buffer + start, entry, len) == 0)
+		{
+			*index = i;
+			return 0;
+		}
+	}
+
+	/* not found, keep the encoded value as a new entry */
+	*index = header->num_values;
+	chunk->dictionaryOffsets[*index] = header->uncompressed_page_size;
+	chunk->dictionaryHash[slot] = *index + 1;
+	header->num_values++;
+	header->uncompressed_page_size += len;
+
+	/* keep load factor of the hash table under 0.5 */
+	if (header->num_values * 2 >= chunk->dictionaryHashSize)
+	{
+		growDictionaryHash(chunk);
+	}
+
+	return len;
+}
+
+/*
+ * Double the hash table of dictionary and rehash all the entries.
+ */
+static void
+growDictionaryHash(ParquetColumnChunk chunk)
+{
+	ParquetDataPage dictionaryPage = chunk->dictionaryPage;
+	int		numEntries = dictionaryPage->header->num_values;
+	int		mask;
+
+	pfree(chunk->dictionaryHash);
+	chunk->dictionaryHashSize *= 2;
+	chunk->dictionaryHash = palloc0(chunk->dictionaryHashSize * sizeof(int));
+	chunk->dictionaryOffsets = repalloc(chunk->dictionaryOffsets,
+										chunk->dictionaryHashSize / 2 * sizeof(int));
+
+	mask = chunk->dictionaryHashSize - 1;
+	for (int i = 0; i < numEntries; i++)
+	{
+		int start = chunk->dictionaryOffsets[i];
+		int end = (i + 1 == numEntries) ?
+				dictionaryPage->header->uncompressed_page_size : chunk->dictionaryOffsets[i + 1];
+		uint32 hash = DatumGetUInt32(hash_any(dictionaryPage->values_buffer + start,
+											  end - start));
+		int slot = hash & mask;
+
+		while (chunk->dictionaryHash[slot] != 0)
+			slot = (slot + 1) & mask;
+		chunk->dictionaryHash[slot] = i + 1;
+	}
+}
+
+static void
+appendDictionaryIndex(ParquetDataPage page, int index)
+{
+	if (page->dict_indices_count == page->dict_indices_capacity)
+	{
+		page->dict_indices_capacity *= 2;
+		page->dict_indices = repalloc(page->dict_indices,
+									  page->dict_indices_capacity * sizeof(int32_t));
+	}
+
+	page->dict_indices[page->dict_indices_count++] = index;
+	if (index > page->dict_max_index)
+		page->dict_max_index = index;
+}
+
+/*
+ * Finalize the dictionary page of `chunk`, its content is the PLAIN encoded
+ * entries, compressed the same way as data pages.
+ */
+static void
+encodeDictionaryPage(ParquetColumnChunk chunk)
+{
+	ParquetDataPage dictionaryPage = chunk->dictionaryPage;
+	StringInfoData buf;
+
+	Assert(dictionaryPage->header->num_values > 0);
+	Assert(!dictionaryPage->finalized);
+
+	initStringInfoOfSize(&buf, dictionaryPage->header->uncompressed_page_size + 1);
+	appendBinaryStringInfo(&buf,
+						   dictionaryPage->values_buffer,
+						   dictionaryPage->header->uncompressed_page_size);
+
+	pfree(dictionaryPage->values_buffer);
+	dictionaryPage->values_buffer = NULL;
+
+	compressAndSerializePage(chunk, dictionaryPage, &buf);
+}
+
+/*
+ * Release dictionary of `chunk`. If the dictionary page has been flushed,
+ * its header and data have already been freed by flushPage().
+ */
+static void
+freeDictionary(ParquetColumnChunk chunk)
+{
+	ParquetDataPage dictionaryPage = chunk->dictionaryPage;
+
+	if (!dictionaryPage->finalized)
+	{
+		pfree(dictionaryPage->header);
+		pfree(dictionaryPage->values_buffer);
+	}
+	pfree(dictionaryPage);
+	pfree(chunk->dictionaryHash);
+	pfree(chunk->dictionaryOffsets);
+
+	chunk->dictionaryPage = NULL;
+	chunk->dictionaryHash = NULL;
+	chunk->dictionaryOffsets = NULL;
+}
+
+/*
+ * Bit width used to encode dictionary indices of a data page.
+ */
+static int
+dictionaryIndexBitWidth(int32_t maxIndex)
+{
+	return (maxIndex == 0) ? 1 : widthFromMaxInt(maxIndex);
+}
+
+/*----------------------------------------------------------------
+ * column chunk statistics
+ *
+ * min/max are collected for fixed length types with a natural order,
+ * which are the ones useful for skipping row groups by range quals.
+ * Values are kept PLAIN encoded, the same as in data pages.
+ *----------------------------------------------------------------*/
+
+/*
+ * Return length of PLAIN encoded min/max value of the type, 0 if min/max
+ * is not collected for the type.
+ */
+static int
+statisticsValueLength(int hawqTypeId)
+{
+	switch (hawqTypeId)
+	{
+		case HAWQ_TYPE_INT2:
+		case HAWQ_TYPE_INT4:
+		case HAWQ_TYPE_DATE:
+		case HAWQ_TYPE_FLOAT4:
+			return 4;
+		case HAWQ_TYPE_INT8:
+		case HAWQ_TYPE_TIME:
+		case HAWQ_TYPE_TIMESTAMP:
+		case HAWQ_TYPE_TIMESTAMPTZ:
+		case HAWQ_TYPE_FLOAT8:
+			return 8;
+		default:
+			return 0;
+	}
+}
+
+static void
+updateStatistics(ColumnChunkMetadata chunkmd, Datum value)
+{
+	uint8_t	buf[8];
+	int		len = statisticsValueLength(chunkmd->hawqTypeId);
+
+	switch (chunkmd->hawqTypeId)
+	{
+		case HAWQ_TYPE_INT2:
+		{
+			int32 val = (int32) DatumGetInt16(value);
+			memcpy(buf, &val, len);
+			break;
+		}
+		case HAWQ_TYPE_INT4:
+		{
+			int32 val = DatumGetInt32(value);
+			memcpy(buf, &val, len);
+			break;
+		}
+		case HAWQ_TYPE_DATE:
+		{
+			DateADT val = DatumGetDateADT(value);
+			memcpy(buf, &val, len);
+			break;
+		}
+		case HAWQ_TYPE_FLOAT4:
+		{
+			float4 val = DatumGetFloat4(value);
+			memcpy(buf, &val, len);
+			break;
+		}
+		case HAWQ_TYPE_INT8:
+		{
+			int64 val = DatumGetInt64(value);
+			memcpy(buf, &val, len);
+			break;
+		}
+		case HAWQ_TYPE_TIME:
+		{
+			TimeADT val = DatumGetTimeADT(value);
+			memcpy(buf, &val, len);
+			break;
+		}
+		case HAWQ_TYPE_TIMESTAMP:
+		{
+			Timestamp val = DatumGetTimestamp(value);
+			memcpy(buf, &val, len);
+			break;
+		}
+		case HAWQ_TYPE_TIMESTAMPTZ:
+		{
+			TimestampTz val = DatumGetTimestampTz(value);
+			memcpy(buf, &val, len);
+			break;
+		}
+		case HAWQ_TYPE_FLOAT8:
+		{
+			float8 val = DatumGetFloat8(value);
+			memcpy(buf, &val, len);
+			break;
+		}
+		default:
+			Insist(false);
+			break;
+	}
+
+	if (chunkmd->minValueLen == 0)
+	{
+		memcpy(chunkmd->minValue, buf, len);
+		memcpy(chunkmd->maxValue, buf, len);
+		chunkmd->minValueLen = len;
+		chunkmd->maxValueLen = len;
+	}
+	else if (compareStatisticsValue(chunkmd->hawqTypeId, buf, chunkmd->minValue) < 0)
+	{
+		memcpy(chunkmd->minValue, buf, len);
+	}
+	else if (compareStatisticsValue(chunkmd->hawqTypeId, buf, chunkmd->maxValue) > 0)
+	{
+		memcpy(chunkmd->maxValue, buf, len);
+	}
+}
+
+/*
+ * Compare two PLAIN encoded values, in the same order as the btree
+ * operator class of the type, i.e. NaN is larger than any other float.
+ */
+static int
+compareStatisticsValue(int hawqTypeId, uint8_t *a, uint8_t *b)
+{
+#define COMPARE_SCALAR(type) \
+	do { \
+		type va, vb; \
+		memcpy(&va, a, sizeof(type)); \
+		memcpy(&vb, b, sizeof(type)); \
+		return (va < vb) ? -1 : ((va > vb) ? 1 : 0); \
+	} while (0)
+#define COMPARE_FLOAT(type) \
+	do { \
+		type va, vb; \
+		memcpy(&va, a, sizeof(type)); \
+		memcpy(&vb, b, sizeof(type)); \
+		if (isnan(va)) \
+			return isnan(vb) ? 0 : 1; \
+		if (isnan(vb)) \
+			return -1; \
+		return (va < vb) ? -1 : ((va > vb) ? 1 : 0); \
+	} while (0)
+
+	switch (hawqTypeId)
+	{
+		case HAWQ_TYPE_INT2:
+		case HAWQ_TYPE_INT4:
+			COMPARE_SCALAR(int32);
+		case HAWQ_TYPE_DATE:
+			COMPARE_SCALAR(DateADT);
+		case HAWQ_TYPE_FLOAT4:
+			COMPARE_FLOAT(float4);
+		case HAWQ_TYPE_INT8:
+			COMPARE_SCALAR(int64);
+		case HAWQ_TYPE_TIME:
+			COMPARE_SCALAR(TimeADT);
+		case HAWQ_TYPE_TIMESTAMP:
+			COMPARE_SCALAR(Timestamp);
+		case HAWQ_TYPE_TIMESTAMPTZ:
+			COMPARE_SCALAR(TimestampTz);
+		case HAWQ_TYPE_FLOAT8:
+			COMPARE_FLOAT(float8);
+		default:
+			Insist(false);
+			return 0;
+	}
+
+#undef COMPARE_SCALAR
+#undef COMPARE_FLOAT
+}
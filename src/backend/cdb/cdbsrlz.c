@@ -28,6 +28,8 @@
 #include "catalog/pg_tablespace.h"
 
 #include "utils/inval.h"
+#include "utils/memutils.h"
+#include "utils/pg_crc.h"
 
 #include "cdb/cdbdispatchedtablespaceinfo.h"
 
@@ -42,6 +44,37 @@ int32 WriteBackCatalogLen = 0;
 static char *compress_string(const char *src, int uncompressed_size, int *size);
 static char *uncompress_string(const char *src, int size, int * uncompressed_len);
 
+/*
+ * A serialized plan kept by the dispatcher in one slot of its cache, so that
+ * a repeated plan is neither compressed again nor resent to qExecs that hold
+ * it.  Each store gets a new generation, by which the qExecs' copies of the
+ * slot are told apart.
+ */
+typedef struct SerializedCacheEntry
+{
+	uint64		generation;			/* 0 if the slot is empty */
+	uint64		lastUsed;
+	pg_crc32	crc;				/* of the uncompressed string */
+	char	   *uncompressed;
+	int			uncompressed_size;
+	char	   *compressed;
+	int			compressed_size;
+} SerializedCacheEntry;
+
+/* The copy of a dispatcher cache slot held by a qExec */
+typedef struct ReceivedCacheEntry
+{
+	uint64		generation;
+	char	   *data;
+	int			size;
+} ReceivedCacheEntry;
+
+static MemoryContext SerializedCacheContext = NULL;
+static SerializedCacheEntry serializedCache[SERIALIZED_CACHE_MAX_SLOTS];
+static ReceivedCacheEntry receivedCache[SERIALIZED_CACHE_MAX_SLOTS];
+static uint64 serializedCacheGeneration = 0;
+static uint64 serializedCacheClock = 0;
+
 /*
  * compressBound doesn't exist in older zlibs, so let's use our own
  */
@@ -108,6 +141,174 @@ serializeNode(Node *node, int *size, int *uncompressed_size_out)
 	return sNode;
 }
 
+/*
+ * serializeNodeCached -
+ * Like serializeNode, but the result is kept in a slot of the dispatcher's
+ * plan cache, and is only compressed if that cache doesn't hold it yet.
+ * The returned string starts with a SERIALIZED_CACHE_STORE header, which
+ * makes the qExec keep a copy in the same slot; *ref is set to the header to
+ * send instead to qExecs that already hold it.  Without cache slots
+ * (gp_dispatch_plan_cache_slots = 0) this is serializeNode, and ref->kind is
+ * set to 0.
+ */
+char *
+serializeNodeCached(Node *node, int *size, int *uncompressed_size_out,
+					SerializedCacheHeader *ref)
+{
+	int			nslots = Min(gp_dispatch_plan_cache_slots, SERIALIZED_CACHE_MAX_SLOTS);
+	SerializedCacheEntry *entry = NULL;
+	SerializedCacheHeader header;
+	char	   *pszNode;
+	char	   *sNode;
+	int			uncompressed_size;
+	pg_crc32	crc;
+	int			i;
+
+	Assert(node != NULL);
+	Assert(size != NULL);
+
+	if (nslots <= 0)
+	{
+		ref->kind = 0;
+		return serializeNode(node, size, uncompressed_size_out);
+	}
+
+	if (SerializedCacheContext == NULL)
+		SerializedCacheContext = AllocSetContextCreate(TopMemoryContext,
+													   "SerializedPlanCache",
+													   ALLOCSET_SMALL_MINSIZE,
+													   ALLOCSET_SMALL_INITSIZE,
+													   ALLOCSET_DEFAULT_MAXSIZE);
+
+	START_MEMORY_ACCOUNT(MemoryAccounting_CreateAccount(0, MEMORY_OWNER_TYPE_Serializer));
+	{
+	pszNode = nodeToBinaryStringFast(node, &uncompressed_size);
+	Assert(pszNode != NULL);
+
+	INIT_CRC32(crc);
+	COMP_CRC32(crc, pszNode, uncompressed_size);
+	FIN_CRC32(crc);
+
+	for (i = 0; i < nslots; i++)
+	{
+		SerializedCacheEntry *e = &serializedCache[i];
+
+		if (e->generation != 0 &&
+			EQ_CRC32(e->crc, crc) &&
+			e->uncompressed_size == uncompressed_size &&
+			memcmp(e->uncompressed, pszNode, uncompressed_size) == 0)
+		{
+			entry = e;
+			break;
+		}
+	}
+
+	if (entry == NULL)
+	{
+		/* Not cached: replace an empty or the least recently used slot */
+		entry = &serializedCache[0];
+		for (i = 0; i < nslots && entry->generation != 0; i++)
+		{
+			if (serializedCache[i].generation == 0 ||
+				serializedCache[i].lastUsed < entry->lastUsed)
+				entry = &serializedCache[i];
+		}
+
+		if (entry->generation != 0)
+		{
+			pfree(entry->uncompressed);
+			pfree(entry->compressed);
+			entry->generation = 0;
+		}
+
+		sNode = compress_string(pszNode, uncompressed_size, &entry->compressed_size);
+		entry->compressed = MemoryContextAlloc(SerializedCacheContext, entry->compressed_size);
+		memcpy(entry->compressed, sNode, entry->compressed_size);
+		pfree(sNode);
+
+		entry->uncompressed = MemoryContextAlloc(SerializedCacheContext, uncompressed_size);
+		memcpy(entry->uncompressed, pszNode, uncompressed_size);
+		entry->uncompressed_size = uncompressed_size;
+		entry->crc = crc;
+		entry->generation = ++serializedCacheGeneration;
+	}
+	entry->lastUsed = ++serializedCacheClock;
+	pfree(pszNode);
+
+	header.kind = SERIALIZED_CACHE_STORE;
+	header.slot = entry - serializedCache;
+	header.generation = entry->generation;
+
+	*size = sizeof(header) + entry->compressed_size;
+	sNode = palloc(*size);
+	memcpy(sNode, &header, sizeof(header));
+	memcpy(sNode + sizeof(header), entry->compressed, entry->compressed_size);
+
+	*ref = header;
+	ref->kind = SERIALIZED_CACHE_REF;
+	if (NULL != uncompressed_size_out)
+	{
+		*uncompressed_size_out = uncompressed_size;
+	}
+	}
+	END_MEMORY_ACCOUNT();
+
+	return sNode;
+}
+
+/*
+ * receiveSerializedCached -
+ * This is used on the qExecs to resolve a serialized string received from
+ * the dispatcher that may have a plan cache header; see serializeNodeCached.
+ * A stored string is kept in its slot, a reference is replaced by the string
+ * held in its slot.  Other strings are returned unchanged.
+ */
+const char *
+receiveSerializedCached(const char *strNode, int *size)
+{
+	SerializedCacheHeader header;
+	ReceivedCacheEntry *entry;
+
+	if (strNode == NULL || *size < (int) sizeof(header))
+		return strNode;
+
+	/* A plain serialized string starts with its non-negative length */
+	memcpy(&header, strNode, sizeof(header));
+	if (header.kind != SERIALIZED_CACHE_STORE &&
+		header.kind != SERIALIZED_CACHE_REF)
+		return strNode;
+
+	if (header.slot < 0 || header.slot >= SERIALIZED_CACHE_MAX_SLOTS)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg("invalid dispatched plan cache slot %d", header.slot)));
+	entry = &receivedCache[header.slot];
+
+	if (header.kind == SERIALIZED_CACHE_STORE)
+	{
+		if (SerializedCacheContext == NULL)
+			SerializedCacheContext = AllocSetContextCreate(TopMemoryContext,
+														   "SerializedPlanCache",
+														   ALLOCSET_SMALL_MINSIZE,
+														   ALLOCSET_SMALL_INITSIZE,
+														   ALLOCSET_DEFAULT_MAXSIZE);
+		if (entry->data != NULL)
+			pfree(entry->data);
+		entry->generation = 0;
+		entry->size = *size - sizeof(header);
+		entry->data = MemoryContextAlloc(SerializedCacheContext, Max(entry->size, 1));
+		memcpy(entry->data, strNode + sizeof(header), entry->size);
+		entry->generation = header.generation;
+	}
+	else if (entry->data == NULL || entry->generation != header.generation)
+		ereport(ERROR,
+				(errcode(ERRCODE_INTERNAL_ERROR),
+				 errmsg("dispatched plan not found in plan cache slot %d", header.slot)));
+
+	*size = entry->size;
+	return entry->data;
+}
+
 /*
  * deserializeNode -
  * This is used on the qExecs to deserialize serialized Plan and Query Trees
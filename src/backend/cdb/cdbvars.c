@@ -76,6 +76,12 @@ int			gp_safefswritesize;  /* set for safe AO writes in non-mature fs */
 int			gp_connections_per_thread; /* How many libpq connections are
 										 * handled in each thread */
 
+int			gp_workermgr_idle_threads; /* How many worker manager threads
+										 * are kept between jobs */
+
+int			gp_copy_dispatch_batch_size; /* KB of COPY rows sent to a
+										 * segment at a time */
+
 int			gp_cached_gang_threshold; /*How many gangs to keep around from stmt to stmt.*/
 
 bool		gp_reraise_signal=false;	/* try to dump core when we get SIGABRT & SIGSEGV */
@@ -150,6 +156,14 @@ int			Gp_interconnect_queue_depth=4;	/* max number of messages
 											 * waiting in rx-queue
 											 * before we drop.*/
 int			Gp_interconnect_snd_queue_depth=4;
+int			Gp_interconnect_rx_batch_size=16;	/* max number of packets
+											 * received by one syscall */
+int			Gp_interconnect_tx_batch_size=16;	/* max number of packets
+											 * sent by one syscall */
+int			gp_motion_batch_size=0;	/* tuples per columnar motion
+									 * batch, <= 1 sends row by row */
+int			gp_motion_compress_level=0;	/* zlib level of motion payloads,
+										 * 0 sends them uncompressed */
 int			Gp_interconnect_timer_period=5;
 int			Gp_interconnect_timer_checking_period=20;
 int			Gp_interconnect_default_rtt=20;
@@ -233,6 +247,8 @@ bool		gp_selectivity_damping_sigsort = true;
 
 int			gp_hashjoin_tuples_per_bucket = 5;
 int			gp_hashagg_groups_per_bucket = 5;
+bool		gp_hashagg_open_addressing = false;
+double		gp_hashagg_stream_passthrough_ratio = 0;
 int			gp_hashjoin_metadata_memory_percent = 20;
 
 
@@ -243,6 +259,24 @@ int 		gp_hashagg_spillbatch_max = 0;
 /* hash join to use bloom filter: default to 0, means not used */
 int 	 	gp_hashjoin_bloomfilter = 0;
 
+/* hash join to push a bloom filter of its inner keys down to the outer scan */
+int			gp_hashjoin_runtime_filter = 0;
+
+/* hash join to partition its in-memory table into cache-sized pieces */
+int			gp_hashjoin_radix_partition = 0;
+
+/* number of threads linking the partitions of a hash join table */
+int			gp_hashjoin_build_threads = 0;
+
+/* number of threads sorting an in-memory mk sort */
+int			gp_mksort_threads = 0;
+
+/* compare mk sort keys on normalized 64-bit keys where possible */
+bool		gp_mk_sort_normalized_keys = false;
+
+/* drop LIMIT sort tuples past the bound instead of spilling them */
+bool		gp_mk_sort_bounded_spill = true;
+
 /* Analyzing aid */
 int 		gp_motion_slice_noop = 0;
 #ifdef ENABLE_LTRACE
@@ -255,6 +289,15 @@ bool		gp_enable_alter_table_inherit_cols = false;
 /* During insertion in a table with parquet partitions, require tuples to be sorted by partition key */
 bool		gp_parquet_insert_sort = true;
 
+/* Use dictionary encoding for parquet column chunks when possible */
+bool		gp_parquet_dictionary_encoding = false;
+
+/* Evaluate simple quals before reading other columns in parquet scan */
+bool		gp_parquet_late_materialization = true;
+
+/* Evaluate simple scan quals without the expression interpreter */
+bool		gp_enable_fast_qual = true;
+
 /* The following GUCs is for HAWQ 2.o */
 
 bool optimizer_enforce_hash_dist_policy;
@@ -379,12 +422,16 @@ int gp_segworker_relative_priority = PRIO_MAX;
 /* Max size of dispatched plans; 0 if no limit */
 int			gp_max_plan_size = 0;
 
+/* Number of dispatched plans kept for reuse, on the QD and cached QEs */
+int			gp_dispatch_plan_cache_slots = 8;
+
 /* Disable setting of tuple hints while reading */
 bool		gp_disable_tuple_hints = false;
 int		gp_hashagg_compress_spill_files = 0;
 
 int gp_workfile_compress_algorithm = 0;
 bool gp_workfile_checksumming = false;
+bool gp_workfile_async_io = false;
 bool gp_workfile_caching = false;
 bool gp_metadata_versioning = false;
 int gp_workfile_caching_loglevel = DEBUG1;
@@ -467,6 +467,7 @@ prepare_dispatch_query_desc(DispatchData *data,
 	int 	splan_len,
 			splan_len_uncompressed,
 			sparams_len;
+	SerializedCacheHeader splan_ref;
 
 	SliceTable *sliceTbl;
 	int			rootIdx;
@@ -562,7 +563,7 @@ prepare_dispatch_query_desc(DispatchData *data,
 	 * slice tree (corresponding to an initPlan or the main plan), so the
 	 * parameters are fixed and we can include them in the prefix.
 	 */
-	splan = serializeNode((Node *) queryDesc->plannedstmt, &splan_len, &splan_len_uncompressed);
+	splan = serializeNodeCached((Node *) queryDesc->plannedstmt, &splan_len, &splan_len_uncompressed, &splan_ref);
 
 	/* compute the total uncompressed size of the query plan for all slices */
 	int num_slices = queryDesc->plannedstmt->planTree->nMotionNodes + 1;
@@ -654,6 +655,14 @@ prepare_dispatch_query_desc(DispatchData *data,
 							rootIdx,
 							queryDesc->resource);
 
+	/* qExecs that hold the plan in their cache are sent a reference instead */
+	if (splan_ref.kind == SERIALIZED_CACHE_REF)
+	{
+		data->pQueryParms->serializedPlantreeRef = palloc(sizeof(splan_ref));
+		memcpy(data->pQueryParms->serializedPlantreeRef, &splan_ref, sizeof(splan_ref));
+		data->pQueryParms->serializedPlantreeReflen = sizeof(splan_ref);
+	}
+
 	Assert(sliceTbl);
 	Assert(sliceTbl->slices != NIL);
 
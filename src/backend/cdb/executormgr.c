@@ -60,6 +60,10 @@ typedef struct QueryExecutor {
 	const char	*identity_msg;
 	int			identity_msg_len;
 
+	/* Plan cache slot the QE was sent a plan to keep in, or -1 */
+	int			plan_cache_slot;
+	uint64		plan_cache_generation;
+
 	instr_time	time_dispatch_begin;
 	instr_time	time_dispatch_end;
 	instr_time	time_connect_begin;
@@ -160,6 +164,7 @@ executormgr_create_executor(void)
 {
 	QueryExecutor	*executor = palloc0(sizeof(QueryExecutor));
 
+	executor->plan_cache_slot = -1;
 	INSTR_TIME_SET_ZERO(executor->time_dispatch_begin);
 	INSTR_TIME_SET_ZERO(executor->time_dispatch_end);
 	INSTR_TIME_SET_ZERO(executor->time_connect_begin);
@@ -384,14 +389,41 @@ executormgr_dispatch_and_run(struct DispatchData *data, QueryExecutor *executor)
 	char		*query = NULL;
 	int			query_len;
 	DispatchCommandQueryParms	*parms = dispatcher_get_QueryParms(data);
+	char		*plan = parms->serializedPlantree;
+	int			plan_len = parms->serializedPlantreelen;
 
 	if (!executormgr_is_dispatchable(executor))
 		return false;
 
+	/*
+	 * Send only a reference to a plan the QE already holds in its plan cache.
+	 * Otherwise the QE keeps the plan it is sent in the referenced slot; we
+	 * take note of that only once the QE has run the query without error,
+	 * see executormgr_consume().  Until then the slot is not trusted.
+	 */
+	executor->plan_cache_slot = -1;
+	if (parms->serializedPlantreeRef != NULL)
+	{
+		SerializedCacheHeader	*ref = (SerializedCacheHeader *) parms->serializedPlantreeRef;
+		uint64		*generation = &executor->desc->planCacheGeneration[ref->slot];
+
+		if (*generation == ref->generation)
+		{
+			plan = parms->serializedPlantreeRef;
+			plan_len = parms->serializedPlantreeReflen;
+		}
+		else
+		{
+			*generation = 0;
+			executor->plan_cache_slot = ref->slot;
+			executor->plan_cache_generation = ref->generation;
+		}
+	}
+
 	TIMING_BEGIN(executor->time_dispatch_begin);
 	query = PQbuildGpQueryString(parms->strCommand, parms->strCommandlen,
 								parms->serializedQuerytree, parms->serializedQuerytreelen,
-								parms->serializedPlantree, parms->serializedPlantreelen,
+								plan, plan_len,
 								parms->serializedParams, parms->serializedParamslen,
 								parms->serializedSliceInfo, parms->serializedSliceInfolen,
 								NULL, 0,
@@ -506,8 +538,18 @@ executormgr_consume(QueryExecutor *executor)
 	}
 
 	if (done)
+	{
 		executor->state = QES_STOP;
 
+		/* The QE got the plan it was sent, and kept it. */
+		if (executor->plan_cache_slot >= 0)
+		{
+			executor->desc->planCacheGeneration[executor->plan_cache_slot] =
+				executor->plan_cache_generation;
+			executor->plan_cache_slot = -1;
+		}
+	}
+
   TIMING_END(executor->time_consume_end);
 	return true;
 
@@ -549,6 +591,10 @@ executormgr_catch_error(QueryExecutor *executor)
 	if (executor->refResult->errcode != 0)
 	  errCode = executor->refResult->errcode;
 
+	/* Whatever the error, don't rely on the QE's plan cache any more. */
+	memset(executor->desc->planCacheGeneration, 0,
+		   sizeof(executor->desc->planCacheGeneration));
+
 	msg = PQerrorMessage(conn);
 
 	if (msg && (strcmp("", msg) != 0) && (executor->refResult->errcode == 0)){
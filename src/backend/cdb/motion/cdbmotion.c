@@ -30,6 +30,29 @@
  */
 int			Gp_max_tuple_chunk_size;
 
+/*
+ * A batch is sent when it holds gp_motion_batch_size tuples, or this many
+ * bytes of attribute values, whichever comes first.
+ *
+ * The batches of all routes of a motion node together hold at most
+ * MOTION_BATCHES_MAX_BYTES, and no more than half of the node's memKB; past
+ * that the largest one is sent early.  A batch whose buffers grew past
+ * MOTION_BATCH_KEEP_BYTES gives them up once it is sent.
+ */
+#define MOTION_BATCH_MAX_BYTES		(1024 * 1024)
+#define MOTION_BATCHES_MAX_BYTES	(4 * 1024 * 1024)
+#define MOTION_BATCH_KEEP_BYTES		(64 * 1024)
+
+/*
+ * With gp_motion_compress_level > 0, payloads of at least
+ * MOTION_COMPRESS_MIN_BYTES are compressed.  After every
+ * MOTION_COMPRESS_WINDOW attempts, a motion node gives up compressing if
+ * that saved less than MOTION_COMPRESS_MIN_SAVING of the bytes.
+ */
+#define MOTION_COMPRESS_MIN_BYTES	1024
+#define MOTION_COMPRESS_WINDOW		64
+#define MOTION_COMPRESS_MIN_SAVING	0.1
+
 /*
  * STATIC STATE VARS
  *
@@ -62,8 +85,21 @@ static void processIncomingChunks(MotionLayerState *mlStates,
 
 static inline void reconstructTuple(MotionNodeEntry * pMNEntry, ChunkSorterEntry * pCSEntry);
 
+static SerTupBatch *getSendBatch(MotionLayerState *mlStates,
+								 MotionNodeEntry * pMNEntry,
+								 int16 targetRoute);
+static SendReturnCode sendBatch(MotionLayerState *mlStates,
+								ChunkTransportState *transportStates,
+								MotionNodeEntry * pMNEntry,
+								int16 motNodeID,
+								int16 targetRoute,
+								SerTupBatch *batch);
+static void compressChunks(MotionNodeEntry * pMNEntry, TupleChunkList tcList);
+static int	getSendBatchesMaxBytes(MotionNodeEntry * pMNEntry);
+static int	getSendBatchAllocated(MotionNodeEntry * pMNEntry, SerTupBatch *batch);
+
 /* Stats-function declarations. */
-static void statSendTuple(MotionLayerState *mlStates, MotionNodeEntry * pMNEntry, TupleChunkList tcList);
+static void statSendTuple(MotionLayerState *mlStates, MotionNodeEntry * pMNEntry, TupleChunkList tcList, int numTuples);
 static void statSendEOS(MotionLayerState *mlStates, MotionNodeEntry * pMNEntry);
 static void statChunksProcessed(MotionLayerState *mlStates, MotionNodeEntry * pMNEntry, int chunksProcessed, int chunkBytes, int tupleBytes);
 static void statNewTupleArrived(MotionNodeEntry * pMNEntry, ChunkSorterEntry * pCSEntry);
@@ -82,6 +118,28 @@ static inline void
 reconstructTuple(MotionNodeEntry * pMNEntry, ChunkSorterEntry * pCSEntry)
 {
 	HeapTuple	htup;
+	TupleChunkType tcType;
+
+	GetChunkType(pCSEntry->chunk_list.p_first, &tcType);
+
+	if (tcType == TC_BATCH_WHOLE || tcType == TC_BATCH_START ||
+		tcType == TC_COMPRESSED_WHOLE || tcType == TC_COMPRESSED_START)
+	{
+		int			numTuples;
+
+		/* A batch of tuples, or a compressed payload, all go into the tuple-store. */
+		if (tcType == TC_BATCH_WHOLE || tcType == TC_BATCH_START)
+			numTuples = CvtChunksToHeapTupBatch(&pCSEntry->chunk_list,
+												&pMNEntry->ser_tup_info,
+												pCSEntry->ready_tuples);
+		else
+			numTuples = CvtChunksToHeapTupCompressed(&pCSEntry->chunk_list,
+													 &pMNEntry->ser_tup_info,
+													 pCSEntry->ready_tuples);
+		while (numTuples-- > 0)
+			statNewTupleArrived(pMNEntry, pCSEntry);
+		return;
+	}
 
 	/*
 	 * Convert the list of chunks into a tuple, then stow it away. This frees
@@ -328,6 +386,15 @@ UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserve
 	pEntry->tuple_desc = CreateTupleDescCopy(tupDesc);
 	InitSerTupInfo(pEntry->tuple_desc, &pEntry->ser_tup_info);
 
+	pEntry->send_batches = NULL;
+	pEntry->num_send_batches = 0;
+	pEntry->send_batches_bytes = 0;
+
+	pEntry->compress_window_attempts = 0;
+	pEntry->compress_window_raw_bytes = 0;
+	pEntry->compress_window_bytes = 0;
+	pEntry->compress_disabled = false;
+
 	pEntry->memKB = operatorMemKB;
 
 	if (!preserveOrder)
@@ -347,6 +414,8 @@ UpdateMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool preserve
 	pEntry->stat_total_chunks_sent = 0;
 	pEntry->stat_total_bytes_sent = 0;
 	pEntry->stat_tuple_bytes_sent = 0;
+	pEntry->stat_compress_raw_bytes = 0;
+	pEntry->stat_compress_bytes = 0;
 	pEntry->stat_total_sends = 0;
 	pEntry->stat_total_recvs = 0;
 	pEntry->stat_tuples_available = 0;
@@ -440,7 +509,7 @@ SendTuple(MotionLayerState *mlStates,
 				tcList.serialized_data_length = sent;
 			
 				/* update stats */
-				statSendTuple(mlStates, pMNEntry, &tcList);
+				statSendTuple(mlStates, pMNEntry, &tcList, 1);
 
 				return SEND_COMPLETE;
 			}
@@ -452,6 +521,7 @@ SendTuple(MotionLayerState *mlStates,
 	oldCtxt = MemoryContextSwitchTo(mlStates->motion_layer_mctx);
 
 	SerializeTupleIntoChunks(tuple, &pMNEntry->ser_tup_info, &tcList);
+	compressChunks(pMNEntry, &tcList);
 
 	MemoryContextSwitchTo(oldCtxt);
 
@@ -474,7 +544,211 @@ SendTuple(MotionLayerState *mlStates,
 	else
 	{
 		/* update stats */
-		statSendTuple(mlStates, pMNEntry, &tcList);
+		statSendTuple(mlStates, pMNEntry, &tcList, 1);
+
+		rc = SEND_COMPLETE;
+	}
+
+	/* cleanup */
+	clearTCList(&pMNEntry->ser_tup_info.chunkCache, &tcList);
+
+	return rc;
+}
+
+/*
+ * Function:  SendTupleSlot - Adds a tuple to the batch of its route, and
+ * sends the batch to the AMS layer when it is full.
+ *
+ * The values are copied from the slot column-wise, so the tuple never has
+ * to be formed.  Motion nodes without attributes fall back to SendTuple().
+ */
+SendReturnCode
+SendTupleSlot(MotionLayerState *mlStates,
+			  ChunkTransportState *transportStates,
+			  int16 motNodeID,
+			  TupleTableSlot *slot,
+			  int16 targetRoute)
+{
+	MotionNodeEntry *pMNEntry;
+	SerTupBatch *batch;
+	MemoryContext oldCtxt;
+	int			nbytes;
+	int			i;
+
+	AssertArg(slot != NULL);
+
+	/* see SendTuple() */
+	if (gp_motion_slice_noop != 0 && (gp_motion_slice_noop & (1 << currentSliceId)) != 0)
+		return SEND_COMPLETE;
+
+	pMNEntry = getMotionNodeEntry(mlStates, motNodeID, "SendTupleSlot");
+
+	if (pMNEntry->tuple_desc->natts == 0 ||
+		slot->tts_tupleDescriptor->natts != pMNEntry->tuple_desc->natts)
+		return SendTuple(mlStates, transportStates, motNodeID,
+						 ExecFetchSlotGenericTuple(slot, true), targetRoute);
+
+	batch = getSendBatch(mlStates, pMNEntry, targetRoute);
+
+	slot_getallattrs(slot);
+
+	nbytes = batch->nbytes;
+	oldCtxt = MemoryContextSwitchTo(mlStates->motion_layer_mctx);
+	AddTupleToBatch(&pMNEntry->ser_tup_info, batch,
+					slot_get_values(slot), slot_get_isnull(slot));
+	MemoryContextSwitchTo(oldCtxt);
+	pMNEntry->send_batches_bytes += batch->nbytes - nbytes;
+
+	if (batch->ntuples >= gp_motion_batch_size ||
+		batch->nbytes >= MOTION_BATCH_MAX_BYTES)
+		return sendBatch(mlStates, transportStates, pMNEntry, motNodeID, targetRoute, batch);
+
+	if (pMNEntry->send_batches_bytes < getSendBatchesMaxBytes(pMNEntry))
+		return SEND_COMPLETE;
+
+	/* Too much is waiting in the batches of this node, send the largest. */
+	batch = &pMNEntry->send_batches[0];
+	for (i = 1; i < pMNEntry->num_send_batches; i++)
+	{
+		if (pMNEntry->send_batches[i].nbytes > batch->nbytes)
+			batch = &pMNEntry->send_batches[i];
+	}
+	i = batch - pMNEntry->send_batches;
+
+	return sendBatch(mlStates, transportStates, pMNEntry, motNodeID,
+					 (i == pMNEntry->num_send_batches - 1) ? BROADCAST_SEGIDX : i,
+					 batch);
+}
+
+/*
+ * Bytes of values the batches of a motion node may hold together.
+ */
+static int
+getSendBatchesMaxBytes(MotionNodeEntry * pMNEntry)
+{
+	int64		maxBytes = MOTION_BATCHES_MAX_BYTES;
+
+	if (pMNEntry->memKB > 0)
+		maxBytes = Min(maxBytes, (int64) (pMNEntry->memKB * 1024 / 2));
+
+	return (int) Max(maxBytes, MOTION_BATCH_KEEP_BYTES);
+}
+
+/*
+ * Bytes allocated for the column buffers of a batch.
+ */
+static int
+getSendBatchAllocated(MotionNodeEntry * pMNEntry, SerTupBatch *batch)
+{
+	int			allocated = 0;
+	int			i;
+
+	if (batch->columns == NULL)
+		return 0;
+
+	for (i = 0; i < pMNEntry->tuple_desc->natts; i++)
+	{
+		SerTupBatchColumn *col = &batch->columns[i];
+
+		allocated += col->nulls.maxlen + col->data.maxlen;
+		if (col->offsets.data != NULL)
+			allocated += col->offsets.maxlen;
+	}
+
+	return allocated;
+}
+
+/*
+ * Get the batch of a route, the last one of the array is for broadcasts.
+ */
+static SerTupBatch *
+getSendBatch(MotionLayerState *mlStates, MotionNodeEntry * pMNEntry, int16 targetRoute)
+{
+	MemoryContext oldCtxt;
+	SerTupBatch *batch;
+	int			i;
+
+	if (pMNEntry->send_batches == NULL)
+	{
+		pMNEntry->num_send_batches = GetQEGangNum() + 1;
+		pMNEntry->send_batches = (SerTupBatch *)
+			MemoryContextAllocZero(mlStates->motion_layer_mctx,
+								   pMNEntry->num_send_batches * sizeof(SerTupBatch));
+	}
+
+	if (targetRoute == BROADCAST_SEGIDX)
+		i = pMNEntry->num_send_batches - 1;
+	else
+		i = targetRoute;
+
+	if (i < 0 || i >= pMNEntry->num_send_batches)
+		ereport(ERROR, (errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+						errmsg("Interconnect error: unexpected target route %d"
+							   " for motion node %d.",
+							   targetRoute, pMNEntry->motion_node_id)));
+
+	batch = &pMNEntry->send_batches[i];
+
+	if (batch->columns == NULL)
+	{
+		oldCtxt = MemoryContextSwitchTo(mlStates->motion_layer_mctx);
+		InitSerTupBatch(&pMNEntry->ser_tup_info, batch);
+		MemoryContextSwitchTo(oldCtxt);
+	}
+
+	return batch;
+}
+
+/*
+ * Serialize a batch and send it to the AMS layer, leaving the batch empty.
+ */
+static SendReturnCode
+sendBatch(MotionLayerState *mlStates,
+		  ChunkTransportState *transportStates,
+		  MotionNodeEntry * pMNEntry,
+		  int16 motNodeID,
+		  int16 targetRoute,
+		  SerTupBatch *batch)
+{
+	TupleChunkListData tcList;
+	MemoryContext oldCtxt;
+	SendReturnCode rc;
+	int			numTuples = batch->ntuples;
+
+	pMNEntry->send_batches_bytes -= batch->nbytes;
+
+	oldCtxt = MemoryContextSwitchTo(mlStates->motion_layer_mctx);
+
+	SerializeBatchIntoChunks(batch, &pMNEntry->ser_tup_info, &tcList);
+	compressChunks(pMNEntry, &tcList);
+
+	MemoryContextSwitchTo(oldCtxt);
+
+	/* Don't keep the buffers an unusually large batch grew, see getSendBatch(). */
+	if (getSendBatchAllocated(pMNEntry, batch) > MOTION_BATCH_KEEP_BYTES)
+		CleanupSerTupBatch(&pMNEntry->ser_tup_info, batch);
+
+#ifdef AMS_VERBOSE_LOGGING
+	elog(DEBUG5, "Serialized batch of %d tuples for sending:\n"
+		 "\ttarget-route %d \n"
+		 "\t%d bytes in serial form\n"
+		 "\tbroken into %d chunks",
+		 numTuples,
+		 targetRoute,
+		 tcList.serialized_data_length,
+		 tcList.num_chunks);
+#endif
+
+	/* do the send. */
+	if (!SendTupleChunkToAMS(mlStates, transportStates, motNodeID, targetRoute, tcList.p_first))
+	{
+		pMNEntry->stopped = true;
+		rc = STOP_SENDING;
+	}
+	else
+	{
+		/* update stats */
+		statSendTuple(mlStates, pMNEntry, &tcList, numTuples);
 
 		rc = SEND_COMPLETE;
 	}
@@ -485,6 +759,49 @@ SendTuple(MotionLayerState *mlStates,
 	return rc;
 }
 
+/*
+ * Compress the payload of a chunk list about to be sent, if
+ * gp_motion_compress_level asks for it and it is still paying off for this
+ * motion node.
+ */
+static void
+compressChunks(MotionNodeEntry * pMNEntry, TupleChunkList tcList)
+{
+	int			rawlen = tcList->serialized_data_length;
+
+	if (gp_motion_compress_level <= 0 || pMNEntry->compress_disabled ||
+		rawlen < MOTION_COMPRESS_MIN_BYTES)
+		return;
+
+	if (CompressChunkList(tcList, &pMNEntry->ser_tup_info, gp_motion_compress_level))
+	{
+		pMNEntry->stat_compress_raw_bytes += rawlen;
+		pMNEntry->stat_compress_bytes += tcList->serialized_data_length;
+	}
+
+	pMNEntry->compress_window_raw_bytes += rawlen;
+	pMNEntry->compress_window_bytes += tcList->serialized_data_length;
+
+	if (++pMNEntry->compress_window_attempts < MOTION_COMPRESS_WINDOW)
+		return;
+
+	if (pMNEntry->compress_window_bytes >
+		pMNEntry->compress_window_raw_bytes * (1 - MOTION_COMPRESS_MIN_SAVING))
+	{
+		pMNEntry->compress_disabled = true;
+		elog(DEBUG1, "Motion node %d stops compressing, " UINT64_FORMAT
+			 " bytes compressed to " UINT64_FORMAT " over the last %d sends.",
+			 pMNEntry->motion_node_id,
+			 pMNEntry->compress_window_raw_bytes,
+			 pMNEntry->compress_window_bytes,
+			 pMNEntry->compress_window_attempts);
+	}
+
+	pMNEntry->compress_window_attempts = 0;
+	pMNEntry->compress_window_raw_bytes = 0;
+	pMNEntry->compress_window_bytes = 0;
+}
+
 TupleChunkListItem
 get_eos_tuplechunklist(void)
 {
@@ -509,6 +826,24 @@ SendEndOfStream(MotionLayerState       *mlStates,
 	 */
 	pMNEntry = getMotionNodeEntry(mlStates, motNodeID, "SendEndOfStream");
 
+	/* Send the tuples still waiting in batches ahead of the end-of-stream. */
+	if (pMNEntry->send_batches != NULL)
+	{
+		int			i;
+
+		for (i = 0; i < pMNEntry->num_send_batches && !pMNEntry->stopped; i++)
+		{
+			SerTupBatch *batch = &pMNEntry->send_batches[i];
+
+			if (batch->ntuples == 0)
+				continue;
+
+			sendBatch(mlStates, transportStates, pMNEntry, motNodeID,
+					  (i == pMNEntry->num_send_batches - 1) ? BROADCAST_SEGIDX : i,
+					  batch);
+		}
+	}
+
 	transportStates->SendEos(mlStates, transportStates, motNodeID, s_eos_chunk_data);
 
 	/*
@@ -806,6 +1141,16 @@ EndMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool flushCommLa
 		         pMNEntry->sel_wr_wait
 		        );
         }
+        if (pMNEntry->stat_compress_raw_bytes > 0)
+        {
+            elog(LOG, "Interconnect seg%d slice%d compressed " UINT64_FORMAT
+                 " tuple bytes to " UINT64_FORMAT " bytes%s.",
+                 GetQEIndex(),
+                 currentSliceId,
+                 pMNEntry->stat_compress_raw_bytes,
+                 pMNEntry->stat_compress_bytes,
+                 pMNEntry->compress_disabled ? ", then stopped compressing" : "");
+        }
         if (pMNEntry->stat_total_bytes_recvd > 0 ||
             pMNEntry->sel_rd_wait > 0)
         {
@@ -824,6 +1169,16 @@ EndMotionLayerNode(MotionLayerState *mlStates, int16 motNodeID, bool flushCommLa
         }
     }
 
+	if (pMNEntry->send_batches != NULL)
+	{
+		for (i = 0; i < pMNEntry->num_send_batches; i++)
+			CleanupSerTupBatch(&pMNEntry->ser_tup_info, &pMNEntry->send_batches[i]);
+		pfree(pMNEntry->send_batches);
+		pMNEntry->send_batches = NULL;
+		pMNEntry->num_send_batches = 0;
+		pMNEntry->send_batches_bytes = 0;
+	}
+
 	CleanupSerTupInfo(&pMNEntry->ser_tup_info);
 	FreeTupleDesc(pMNEntry->tuple_desc);
 	if (!pMNEntry->preserve_order)
@@ -1013,6 +1368,8 @@ addChunkToSorter(MotionLayerState *mlStates,
 	{
 		case TC_WHOLE:
 		case TC_EMPTY:
+		case TC_BATCH_WHOLE:
+		case TC_COMPRESSED_WHOLE:
 			/* There shouldn't be any partial tuple data in the list! */
 			if (chunkSorterEntry->chunk_list.num_chunks != 0)
 			{
@@ -1029,6 +1386,8 @@ addChunkToSorter(MotionLayerState *mlStates,
 			break;
 
 		case TC_PARTIAL_START:
+		case TC_BATCH_START:
+		case TC_COMPRESSED_START:
 
 			/* There shouldn't be any partial tuple data in the list! */
 			if (chunkSorterEntry->chunk_list.num_chunks != 0)
@@ -1146,7 +1505,7 @@ addChunkToSorter(MotionLayerState *mlStates,
  * SerializeTupleDirect() only fills those fields out.
  */
 static void
-statSendTuple(MotionLayerState *mlStates, MotionNodeEntry * pMNEntry, TupleChunkList tcList)
+statSendTuple(MotionLayerState *mlStates, MotionNodeEntry * pMNEntry, TupleChunkList tcList, int numTuples)
 {
 	int			headerOverhead;
 
@@ -1155,7 +1514,7 @@ statSendTuple(MotionLayerState *mlStates, MotionNodeEntry * pMNEntry, TupleChunk
 	headerOverhead = TUPLE_CHUNK_HEADER_SIZE * tcList->num_chunks;
 
 	/* per motion-node stats. */
-	pMNEntry->stat_total_sends++;
+	pMNEntry->stat_total_sends += numTuples;
 	pMNEntry->stat_total_chunks_sent += tcList->num_chunks;
 	pMNEntry->stat_total_bytes_sent += tcList->serialized_data_length + headerOverhead;
 	pMNEntry->stat_tuple_bytes_sent += tcList->serialized_data_length;
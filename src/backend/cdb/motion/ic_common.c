@@ -401,6 +401,9 @@ SendTupleChunkToAMS(MotionLayerState *mlStates,
 		}
 	}
 
+	if (transportStates->FlushChunks)
+		transportStates->FlushChunks(transportStates);
+
 	if (recount == 0)
 		return true;
 
@@ -134,6 +134,26 @@ timeoutArray[] =
 /* 1/4 sec in msec */
 #define RX_THREAD_POLL_TIMEOUT (250)
 
+/*
+ * The rx thread receives packets in batches with recvmmsg() where
+ * available. IC_RX_BATCH_MAX caps gp_interconnect_rx_batch_size, since
+ * the per batch arrays live on the small stack of the rx thread.
+ */
+#if defined(__linux__) && defined(MSG_WAITFORONE)
+#define IC_USE_RECVMMSG
+#endif
+#define IC_RX_BATCH_MAX (64)
+
+/*
+ * Likewise data packets are sent in batches with sendmmsg(), up to
+ * gp_interconnect_tx_batch_size packets, see XmitBatch.
+ */
+#if defined(__linux__) && defined(__GLIBC__) && \
+	(__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 14))
+#define IC_USE_SENDMMSG
+#endif
+#define IC_TX_BATCH_MAX (64)
+
 /*
  * Flags definitions for flag-field of UDP-messages
  *
@@ -319,6 +339,12 @@ struct RxBufferPool
 
 	/* The list of free buffers. */
 	char *freeList;
+
+	/*
+	 * The number of buffers borrowed by the rx thread for batched receive,
+	 * they are counted in count but are neither in freeList nor cached.
+	 */
+	int batchHeld;
 };
 
 /*
@@ -327,7 +353,7 @@ struct RxBufferPool
  * maxCount is set to 1 to make sure there is always a buffer
  * for picking packets from OS buffer.
  */
-static RxBufferPool rx_buffer_pool = {1, 0, NULL};
+static RxBufferPool rx_buffer_pool = {1, 0, NULL, 0};
 
 /*
  * SendBufferPool
@@ -656,11 +682,42 @@ typedef struct ICStatistics
 	int32   duplicatedPktNum;
 	int32	recvAckNum;
 	int32	statusQueryMsgNum;
+	int32	recvSyscallNum;
+	int32	sndSyscallNum;
+	uint64	sndBytes;
 } ICStatistics;
 
 /* Statistics for UDP interconnect. */
 static ICStatistics ic_statistics;
 
+#ifdef IC_USE_SENDMMSG
+/*
+ * XmitBatch
+ *
+ * Data packets whose first transmission is deferred, so that packets of
+ * all the connections filled by one send call (e.g. a broadcast motion)
+ * go out with a single sendmmsg().
+ *
+ * Deferring starts when a send call enters SendChunkUDP() or SendEosUDP(),
+ * the batch is flushed when it is full, before waiting for acks, before
+ * stop messages return buffers to the pool, and at the end of the send
+ * call (FlushChunksUDP). Only first transmissions are deferred, a buffer
+ * can't be acked and reused before it is sent. Retransmissions are sent
+ * right away by sendOnce().
+ */
+typedef struct XmitBatch
+{
+	bool		deferring;
+	int			fd;
+	int			count;
+	ICBuffer   *bufs[IC_TX_BATCH_MAX];
+	struct mmsghdr msgs[IC_TX_BATCH_MAX];
+	struct iovec iovs[IC_TX_BATCH_MAX];
+} XmitBatch;
+
+static XmitBatch xmit_batch;
+#endif
+
 /*=========================================================================
  * STATIC FUNCTIONS declarations
  */
@@ -705,6 +762,12 @@ static void sendStatusQueryMessage(MotionConn *conn, int fd, uint32 seq);
 static inline void sendControlMessage(icpkthdr *pkt, int fd, struct sockaddr *addr, socklen_t peerLen);
 
 static void putRxBufferAndSendAck(MotionConn *conn, AckSendParam *param);
+static bool checkRxPacket(icpkthdr *pkt, int read_count);
+static bool dispatchRxPacket(icpkthdr *pkt, struct sockaddr_storage *peer, socklen_t *peerlen, AckSendParam *param);
+#ifdef IC_USE_RECVMMSG
+static bool receiveRxBatch(icpkthdr **firstPkt);
+static icpkthdr *getRxBatchBuffer(RxBufferPool *p);
+#endif
 static inline void putRxBufferToFreeList(RxBufferPool *p, icpkthdr *buf);
 static inline icpkthdr *getRxBufferFromFreeList(RxBufferPool *p);
 static icpkthdr *getRxBuffer(RxBufferPool *p);
@@ -779,6 +842,12 @@ static inline void addCRC(icpkthdr *pkt);
 static inline bool checkCRC(icpkthdr *pkt);
 static void sendBuffers(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEntry, MotionConn *conn);
 static void sendOnce(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEntry, ICBuffer *buf, MotionConn * conn);
+#ifdef IC_USE_SENDMMSG
+static void queueXmit(ChunkTransportStateEntry *pEntry, ICBuffer *buf, MotionConn *conn);
+static void flushXmitBatch(void);
+static void resetXmitBatch(void);
+#endif
+static void FlushChunksUDP(ChunkTransportState *transportStates);
 static inline uint64 computeExpirationPeriod(MotionConn *conn, uint32 retry);
 
 static ICBuffer *getSndBuffer(MotionConn *conn);
@@ -2045,6 +2114,7 @@ initRxBufferPool(RxBufferPool *p)
 	p->count = 0;
 	p->maxCount = 1;
 	p->freeList = NULL;
+	p->batchHeld = 0;
 }
 
 
@@ -2164,6 +2234,39 @@ freeRxBuffer(RxBufferPool *p, icpkthdr *buf)
 	p->count--;
 }
 
+/*
+ * getRxBatchBuffer
+ * 		Borrow an additional receive buffer for batched receive, return
+ * 		NULL if the pool has no buffer to spare.
+ *
+ * Unlike getRxBuffer(), never allocates beyond maxCount. The buffer is
+ * counted in batchHeld until receiveRxBatch() hands it back.
+ *
+ * SHOULD BE CALLED WITH rx_control_info.lock *LOCKED*
+ *
+ * NOTE: In threads, we cannot use palloc/pfree, because it's not thread safe.
+ */
+static icpkthdr *
+getRxBatchBuffer(RxBufferPool *p)
+{
+	icpkthdr *ret = NULL;
+
+	if (p->freeList != NULL)
+		ret = getRxBufferFromFreeList(p);
+	else if (p->count < p->maxCount)
+	{
+		/* malloc is used for thread safty. */
+		ret = (icpkthdr *)malloc(Gp_max_packet_size);
+		if (ret != NULL)
+			p->count++;
+	}
+
+	if (ret != NULL)
+		p->batchHeld++;
+
+	return ret;
+}
+
 /*
  * setSocketBufferSize
  * 		Set socket buffer size.
@@ -3334,8 +3437,13 @@ SetupUDPInterconnect_Internal(EState *estate)
 	estate->interconnect_context->RecvTupleChunkFromAny = RecvTupleChunkFromAnyUDP;
 	estate->interconnect_context->SendEos = SendEosUDP;
 	estate->interconnect_context->SendChunk = SendChunkUDP;
+	estate->interconnect_context->FlushChunks = FlushChunksUDP;
 	estate->interconnect_context->doSendStopMessage = doSendStopMessageUDP;
 
+#ifdef IC_USE_SENDMMSG
+	resetXmitBatch();
+#endif
+
 	mySlice = (Slice *) list_nth(estate->interconnect_context->sliceTable->slices, LocallyExecutingSliceIndex(estate));
 
 	Assert(mySlice &&
@@ -3671,6 +3779,11 @@ TeardownUDPInterconnect_Internal(ChunkTransportState *transportStates,
 			elog_node_display(DEBUG3, "local slice table", transportStates->sliceTable, true);
 	}
 
+#ifdef IC_USE_SENDMMSG
+	/* deferred packets point into the send buffers freed below */
+	resetXmitBatch();
+#endif
+
 	/*
 	 * add lock to protect the hash table, since background thread is still working.
 	 */
@@ -3821,8 +3934,11 @@ TeardownUDPInterconnect_Internal(ChunkTransportState *transportStates,
     	}
 	}
 
-	/* now that we've moved active rx-buffers to the freelist, we can prune the freelist itself */
-	while (rx_buffer_pool.count > rx_buffer_pool.maxCount)
+	/*
+	 * now that we've moved active rx-buffers to the freelist, we can prune the freelist itself.
+	 * Buffers borrowed by the rx thread are pruned by itself after returned.
+	 */
+	while (rx_buffer_pool.count - rx_buffer_pool.batchHeld > rx_buffer_pool.maxCount)
 	{
 		icpkthdr *buf = NULL;
 
@@ -3862,7 +3978,8 @@ TeardownUDPInterconnect_Internal(ChunkTransportState *transportStates,
 			" freebuf_avg %f "
 			"mismatch_pkt_num %d disordered_pkt_num %d duplicated_pkt_num %d"
 			" rtt/dev [" UINT64_FORMAT "/" UINT64_FORMAT ", %f/%f, " UINT64_FORMAT "/" UINT64_FORMAT "] "
-			" cwnd %f status_query_msg_num %d",
+			" cwnd %f status_query_msg_num %d recv_syscall_num %d"
+			" snd_syscall_num %d snd_bytes " UINT64_FORMAT,
 			ic_control_info.isSender, isReceiver,
 			Gp_interconnect_snd_queue_depth, Gp_interconnect_queue_depth, Gp_max_packet_size,
 			UNACK_QUEUE_RING_SLOTS_NUM, TIMER_SPAN, DEFAULT_RTT,
@@ -3875,7 +3992,8 @@ TeardownUDPInterconnect_Internal(ChunkTransportState *transportStates,
 			(double)((double)ic_statistics.totalBuffers)/((double)ic_statistics.bufferCountingTime),
 			ic_statistics.mismatchNum, ic_statistics.disorderedPktNum, ic_statistics.duplicatedPktNum,
 			(minRtt == ~((uint64)0) ? 0 : minRtt), (minDev == ~((uint64)0) ? 0 : minDev), avgRtt, avgDev, maxRtt, maxDev,
-			snd_control_info.cwnd, ic_statistics.statusQueryMsgNum);
+			snd_control_info.cwnd, ic_statistics.statusQueryMsgNum, ic_statistics.recvSyscallNum,
+			ic_statistics.sndSyscallNum, ic_statistics.sndBytes);
 
 	ic_control_info.isSender = false;
 	memset(&ic_statistics, 0, sizeof(ICStatistics));
@@ -4723,6 +4841,7 @@ sendOnce(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEntry,
 xmit_retry:
 	n = sendto(pEntry->txfd, buf->pkt, buf->pkt->len, 0,
 			   (struct sockaddr *)&conn->peer, conn->peer_len);
+	ic_statistics.sndSyscallNum++;
 	if (n < 0)
 	{
 		if (errno == EINTR)
@@ -4740,6 +4859,8 @@ xmit_retry:
 		/* not reached */
 	}
 
+	ic_statistics.sndBytes += n;
+
 	if (n != buf->pkt->len)
 	{
 		if (DEBUG1 >= log_min_messages)
@@ -4755,6 +4876,135 @@ xmit_retry:
 	return;
 }
 
+#ifdef IC_USE_SENDMMSG
+/*
+ * queueXmit
+ * 		Defer the first transmission of buf to the next flush of the
+ * 		xmit batch.
+ */
+static void
+queueXmit(ChunkTransportStateEntry *pEntry, ICBuffer *buf, MotionConn *conn)
+{
+	int i;
+
+#ifdef USE_ASSERT_CHECKING
+	if (testmode_inject_fault(gp_udpic_dropxmit_percent))
+	{
+	#ifdef AMS_VERBOSE_LOGGING
+		write_log("THROW PKT with seq %d srcpid %d despid %d", buf->pkt->seq, buf->pkt->srcPid, buf->pkt->dstPid);
+	#endif
+		return;
+	}
+#endif
+
+	if (xmit_batch.count > 0 && xmit_batch.fd != pEntry->txfd)
+		flushXmitBatch();
+
+	i = xmit_batch.count;
+
+	xmit_batch.fd = pEntry->txfd;
+	xmit_batch.bufs[i] = buf;
+	xmit_batch.iovs[i].iov_base = buf->pkt;
+	xmit_batch.iovs[i].iov_len = buf->pkt->len;
+
+	memset(&xmit_batch.msgs[i], 0, sizeof(struct mmsghdr));
+	xmit_batch.msgs[i].msg_hdr.msg_name = &conn->peer;
+	xmit_batch.msgs[i].msg_hdr.msg_namelen = conn->peer_len;
+	xmit_batch.msgs[i].msg_hdr.msg_iov = &xmit_batch.iovs[i];
+	xmit_batch.msgs[i].msg_hdr.msg_iovlen = 1;
+
+	xmit_batch.count++;
+
+	if (xmit_batch.count >= Min(Gp_interconnect_tx_batch_size, IC_TX_BATCH_MAX))
+		flushXmitBatch();
+}
+
+/*
+ * flushXmitBatch
+ * 		Send the packets in xmit batch.
+ *
+ * Like sendOnce(), packets not sent for lack of socket buffer space are
+ * left to retransmission.
+ */
+static void
+flushXmitBatch(void)
+{
+	int			sent = 0;
+
+	while (sent < xmit_batch.count)
+	{
+		int			n;
+
+		n = sendmmsg(xmit_batch.fd, &xmit_batch.msgs[sent], xmit_batch.count - sent, 0);
+		ic_statistics.sndSyscallNum++;
+
+		if (n < 0)
+		{
+			MotionConn *conn = xmit_batch.bufs[sent]->conn;
+
+			if (errno == EINTR)
+				continue;
+
+			if (errno == EAGAIN) /* no space ? not an error. */
+				break;
+
+			xmit_batch.count = 0;
+			ereport(ERROR, (errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+							errmsg("Interconnect error writing an outgoing packet: %m"),
+							errdetail("error during sendmmsg() call (error:%d).\n"
+									  "For Remote Connection: contentId=%d at %s",
+									  errno, conn->remoteContentId,
+									  conn->remoteHostAndPort)));
+			/* not reached */
+		}
+
+		for (int i = sent; i < sent + n; i++)
+		{
+			ICBuffer *buf = xmit_batch.bufs[i];
+
+			ic_statistics.sndBytes += xmit_batch.msgs[i].msg_len;
+
+			if (xmit_batch.msgs[i].msg_len != buf->pkt->len && DEBUG1 >= log_min_messages)
+				write_log("Interconnect error writing an outgoing packet [seq %d]: short transmit (given %d sent %d) during sendmmsg() call."
+					  "For Remote Connection: contentId=%d at %s", buf->pkt->seq, buf->pkt->len, xmit_batch.msgs[i].msg_len,
+					  buf->conn->remoteContentId,
+					  buf->conn->remoteHostAndPort);
+		}
+
+		sent += n;
+	}
+
+	xmit_batch.count = 0;
+}
+
+/*
+ * resetXmitBatch
+ * 		Drop the deferred packets, they are retransmitted if still needed.
+ */
+static void
+resetXmitBatch(void)
+{
+	xmit_batch.deferring = false;
+	xmit_batch.count = 0;
+}
+#endif   /* IC_USE_SENDMMSG */
+
+/*
+ * FlushChunksUDP
+ * 		Send the packets deferred by the send call that has just finished.
+ *
+ * See cdbinterconnect.h
+ */
+static void
+FlushChunksUDP(ChunkTransportState *transportStates)
+{
+#ifdef IC_USE_SENDMMSG
+	if (xmit_batch.count > 0)
+		flushXmitBatch();
+	xmit_batch.deferring = false;
+#endif
+}
+
 
 /*
  * handleStopMsgs
@@ -4769,6 +5019,12 @@ handleStopMsgs(ChunkTransportState *transportStates, ChunkTransportStateEntry *p
 #ifdef AMS_VERBOSE_LOGGING
 	elog(DEBUG3, "handleStopMsgs: node %d", motionId);
 #endif
+
+#ifdef IC_USE_SENDMMSG
+	/* the buffers of stopped connections are returned to the pool below */
+	if (xmit_batch.count > 0)
+		flushXmitBatch();
+#endif
 	while (i < pEntry->numConns)
 	{
 		MotionConn *conn=NULL;
@@ -4909,7 +5165,12 @@ sendBuffers(ChunkTransportState *transportStates, ChunkTransportStateEntry *pEnt
 		updateStats(TPE_DATA_PKT_SEND, conn, buf->pkt);
 #endif
 
-		sendOnce(transportStates, pEntry, buf, conn);
+#ifdef IC_USE_SENDMMSG
+		if (xmit_batch.deferring)
+			queueXmit(pEntry, buf, conn);
+		else
+#endif
+			sendOnce(transportStates, pEntry, buf, conn);
 		ic_statistics.sndPktNum++;
 
 #ifdef AMS_VERBOSE_LOGGING
@@ -5318,6 +5579,12 @@ pollAcks(ChunkTransportState *transportStates, int fd, int timeout)
 	struct pollfd nfd;
 	int n;
 
+#ifdef IC_USE_SENDMMSG
+	/* acks can't come for packets we haven't sent */
+	if (xmit_batch.count > 0)
+		flushXmitBatch();
+#endif
+
 	nfd.fd = fd;
 	nfd.events = POLLIN;
 
@@ -5477,6 +5744,11 @@ SendChunkUDP(MotionLayerState *mlStates,
 	elog(DEBUG3, "sendChunk: msgSize %d this chunk length %d conn seq %d", conn->msgSize, tcItem->chunk_length, conn->conn_info.seq);
 #endif
 
+#ifdef IC_USE_SENDMMSG
+	/* flushed by FlushChunksUDP() when the send call finishes */
+	xmit_batch.deferring = true;
+#endif
+
 	if (conn->msgSize + length <= Gp_max_packet_size)
 	{
 		memcpy(conn->pBuff + conn->msgSize, tcItem->chunk_data, tcItem->chunk_length);
@@ -5594,6 +5866,10 @@ SendEosUDP(MotionLayerState *mlStates,
 
 	getChunkTransportState(transportStates, motNodeID, &pEntry);
 
+#ifdef IC_USE_SENDMMSG
+	xmit_batch.deferring = true;
+#endif
+
 	if (gp_log_interconnect >= GPVARS_VERBOSITY_DEBUG)
 		elog(DEBUG1, "Interconnect seg%d slice%d sending end-of-stream to slice%d",
 			 GetQEIndex(), motNodeID, pEntry->recvSlice->sliceIndex);
@@ -5638,6 +5914,8 @@ SendEosUDP(MotionLayerState *mlStates,
 		}
 	}
 
+	FlushChunksUDP(transportStates);
+
 	/*
 	 * Now waiting for acks from receivers.
 	 *
@@ -6298,15 +6576,23 @@ rxThreadFunc(void *arg)
 			/* we've got something interesting to read */
 			/* handle incoming */
 			/* ready to read on our socket */
-			MotionConn *conn = NULL;
 			int read_count = 0;
 
+#ifdef IC_USE_RECVMMSG
+			if (Gp_interconnect_rx_batch_size > 1)
+			{
+				skip_poll = receiveRxBatch(&pkt);
+				continue;
+			}
+#endif
+
 			struct sockaddr_storage peer;
 			socklen_t peerlen;
 
 			peerlen = sizeof(peer);
 			read_count = recvfrom(UDP_listenerFd, (char *)pkt, Gp_max_packet_size, 0,
 								  (struct sockaddr *)&peer, &peerlen);
+			gp_atomic_add_32(&ic_statistics.recvSyscallNum, 1);
 
 			if (DEBUG5 >= log_min_messages)
 				write_log("received inbound len %d", read_count);
@@ -6340,38 +6626,8 @@ rxThreadFunc(void *arg)
 			/* when we get a "good" recvfrom() result, we can skip poll() until we get a bad one. */
 			skip_poll = true;
 
-			/* length must be >= 0 */
-			if (pkt->len < 0)
-			{
-				if (DEBUG3 >= log_min_messages)
-					write_log("received inbound with negative length");
+			if (!checkRxPacket(pkt, read_count))
 				continue;
-			}
-
-			if (pkt->len != read_count)
-			{
-				if (DEBUG3 >= log_min_messages)
-					write_log("received inbound packet [%d], short: read %d bytes, pkt->len %d", pkt->seq, read_count, pkt->len);
-				continue;
-			}
-
-			/*
-			 * check the CRC of the payload.
-			 */
-			if (gp_interconnect_full_crc)
-			{
-				if (!checkCRC(pkt))
-				{
-					gp_atomic_add_32(&ic_statistics.crcErrors, 1);
-					if (DEBUG2 >= log_min_messages)
-						write_log("received network data error, dropping bad packet, user data unaffected.");
-					continue;
-				}
-			}
-
-			#ifdef AMS_VERBOSE_LOGGING
-				logPkt("GOT MESSAGE", pkt);
-			#endif
 
 			AckSendParam param;
 			memset(&param, 0, sizeof(AckSendParam));
@@ -6386,38 +6642,8 @@ rxThreadFunc(void *arg)
 			 */
 
 			pthread_mutex_lock(&ic_control_info.lock);
-			conn = findConnByHeader(&ic_control_info.connHtab, pkt);
-
-			if (conn != NULL)
-			{
-				/* Handling a regular packet */
-				if (handleDataPacket(conn, pkt, &peer, &peerlen, &param))
-					pkt = NULL;
-				ic_statistics.recvPktNum++;
-			}
-			else
-			{
-				/*
-				 * There may have two kinds of Mismatched packets:
-				 *    a) Past packets from previous command after I was torn down
-				 *    b) Future packets from current command before my connections are built.
-				 *
-				 * The handling logic is to "Ack the past and Nak the future".
-				 */
-				if ((pkt->flags & UDPIC_FLAGS_RECEIVER_TO_SENDER) == 0)
-				{
-					if (DEBUG1 >= log_min_messages)
-						write_log("mismatched packet received, seq %d, srcpid %d, dstpid %d, icid %d, sid %d", pkt->seq, pkt->srcPid, pkt->dstPid, pkt->icId, pkt->sessionId);
-
-				#ifdef AMS_VERBOSE_LOGGING
-					logPkt("Got a Mismatched Packet", pkt);
-				#endif
-
-					if (handleMismatch(pkt, &peer, peerlen))
-						pkt = NULL;
-					ic_statistics.mismatchNum++;
-				}
-			}
+			if (dispatchRxPacket(pkt, &peer, &peerlen, &param))
+				pkt = NULL;
 			pthread_mutex_unlock(&ic_control_info.lock);
 
 			/* real ack sending is after lock release to decrease the lock holding time. */
@@ -6441,6 +6667,239 @@ rxThreadFunc(void *arg)
 	return NULL;
 }
 
+/*
+ * checkRxPacket
+ * 		Sanity check of a received packet of read_count bytes, return false
+ * 		if the packet should be dropped.
+ *
+ * NOTE: This function MUST NOT contain elog or ereport statements.
+ * elog is NOT thread-safe.  Developers should instead use something like:
+ *
+ *	if (DEBUG3 >= log_min_messages)
+ *		write_log("my brilliant log statement here.");
+ */
+static bool
+checkRxPacket(icpkthdr *pkt, int read_count)
+{
+	/* length must be >= 0 */
+	if (pkt->len < 0)
+	{
+		if (DEBUG3 >= log_min_messages)
+			write_log("received inbound with negative length");
+		return false;
+	}
+
+	if (pkt->len != read_count)
+	{
+		if (DEBUG3 >= log_min_messages)
+			write_log("received inbound packet [%d], short: read %d bytes, pkt->len %d", pkt->seq, read_count, pkt->len);
+		return false;
+	}
+
+	/*
+	 * check the CRC of the payload.
+	 */
+	if (gp_interconnect_full_crc)
+	{
+		if (!checkCRC(pkt))
+		{
+			gp_atomic_add_32(&ic_statistics.crcErrors, 1);
+			if (DEBUG2 >= log_min_messages)
+				write_log("received network data error, dropping bad packet, user data unaffected.");
+			return false;
+		}
+	}
+
+	#ifdef AMS_VERBOSE_LOGGING
+		logPkt("GOT MESSAGE", pkt);
+	#endif
+
+	return true;
+}
+
+/*
+ * dispatchRxPacket
+ * 		Hand a received packet to its connection, or handle it as a
+ * 		mismatched packet. Return true if the packet is cached and its
+ * 		buffer is no longer owned by the rx thread.
+ *
+ * SHOULD BE CALLED WITH ic_control_info.lock *LOCKED*
+ *
+ * NOTE: This function MUST NOT contain elog or ereport statements.
+ * elog is NOT thread-safe.
+ */
+static bool
+dispatchRxPacket(icpkthdr *pkt, struct sockaddr_storage *peer, socklen_t *peerlen, AckSendParam *param)
+{
+	MotionConn *conn = NULL;
+	bool		cached = false;
+
+	conn = findConnByHeader(&ic_control_info.connHtab, pkt);
+
+	if (conn != NULL)
+	{
+		/* Handling a regular packet */
+		cached = handleDataPacket(conn, pkt, peer, peerlen, param);
+		ic_statistics.recvPktNum++;
+	}
+	else
+	{
+		/*
+		 * There may have two kinds of Mismatched packets:
+		 *    a) Past packets from previous command after I was torn down
+		 *    b) Future packets from current command before my connections are built.
+		 *
+		 * The handling logic is to "Ack the past and Nak the future".
+		 */
+		if ((pkt->flags & UDPIC_FLAGS_RECEIVER_TO_SENDER) == 0)
+		{
+			if (DEBUG1 >= log_min_messages)
+				write_log("mismatched packet received, seq %d, srcpid %d, dstpid %d, icid %d, sid %d", pkt->seq, pkt->srcPid, pkt->dstPid, pkt->icId, pkt->sessionId);
+
+		#ifdef AMS_VERBOSE_LOGGING
+			logPkt("Got a Mismatched Packet", pkt);
+		#endif
+
+			cached = handleMismatch(pkt, peer, *peerlen);
+			ic_statistics.mismatchNum++;
+		}
+	}
+
+	return cached;
+}
+
+#ifdef IC_USE_RECVMMSG
+/*
+ * receiveRxBatch
+ * 		Receive up to gp_interconnect_rx_batch_size packets with one
+ * 		recvmmsg() call, and dispatch all of them with one acquisition of
+ * 		ic_control_info.lock.
+ *
+ * *firstPkt is the buffer the rx thread always holds. Additional buffers
+ * are borrowed from the pool for the duration of the call only, those not
+ * consumed are returned before returning. On return *firstPkt is a free
+ * buffer, or NULL if all buffers are consumed.
+ *
+ * Return true if any packet is received, in which case the caller can skip
+ * poll() for the next round.
+ *
+ * NOTE: This function MUST NOT contain elog or ereport statements.
+ * elog is NOT thread-safe.
+ *
+ * NOTE: In threads, we cannot use palloc/pfree, because it's not thread safe.
+ */
+static bool
+receiveRxBatch(icpkthdr **firstPkt)
+{
+	icpkthdr	   *pkts[IC_RX_BATCH_MAX];
+	struct mmsghdr	msgs[IC_RX_BATCH_MAX];
+	struct iovec	iovs[IC_RX_BATCH_MAX];
+	struct sockaddr_storage peers[IC_RX_BATCH_MAX];
+	AckSendParam	params[IC_RX_BATCH_MAX];
+	bool			valid[IC_RX_BATCH_MAX];
+	int				batchSize = Min(Gp_interconnect_rx_batch_size, IC_RX_BATCH_MAX);
+	int				npkts = 1;
+	int				nrecv;
+	int				i;
+
+	pkts[0] = *firstPkt;
+
+	pthread_mutex_lock(&ic_control_info.lock);
+	while (npkts < batchSize)
+	{
+		icpkthdr *buf = getRxBatchBuffer(&rx_buffer_pool);
+
+		if (buf == NULL)
+			break;
+		pkts[npkts++] = buf;
+	}
+	pthread_mutex_unlock(&ic_control_info.lock);
+
+	memset(msgs, 0, npkts * sizeof(struct mmsghdr));
+	for (i = 0; i < npkts; i++)
+	{
+		iovs[i].iov_base = pkts[i];
+		iovs[i].iov_len = Gp_max_packet_size;
+		msgs[i].msg_hdr.msg_name = &peers[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	nrecv = recvmmsg(UDP_listenerFd, msgs, npkts, MSG_DONTWAIT, NULL);
+	gp_atomic_add_32(&ic_statistics.recvSyscallNum, 1);
+
+	if (DEBUG5 >= log_min_messages)
+		write_log("received %d inbound packets in batch of %d", nrecv, npkts);
+
+	if (nrecv < 0 && errno != EWOULDBLOCK && errno != EINTR)
+	{
+		write_log("Interconnect error: recvmmsg (%d)", errno);
+		/* let main thread report the error, see rxThreadFunc() */
+		setRxThreadError(errno);
+	}
+
+	for (i = 0; i < nrecv; i++)
+	{
+		int read_count = msgs[i].msg_len;
+
+		valid[i] = false;
+		if (read_count < sizeof(icpkthdr))
+		{
+			if (DEBUG1 >= log_min_messages)
+				write_log("Interconnect error: short conn receive (%d)", read_count);
+			continue;
+		}
+
+		valid[i] = checkRxPacket(pkts[i], read_count);
+		memset(&params[i], 0, sizeof(AckSendParam));
+	}
+
+	/* see rxThreadFunc() for why the lock is held during dispatch */
+	pthread_mutex_lock(&ic_control_info.lock);
+
+	for (i = 0; i < nrecv; i++)
+	{
+		socklen_t peerlen = msgs[i].msg_hdr.msg_namelen;
+
+		if (valid[i] && dispatchRxPacket(pkts[i], &peers[i], &peerlen, &params[i]))
+			pkts[i] = NULL;
+	}
+
+	/* keep one free buffer for next round, return the others */
+	*firstPkt = NULL;
+	for (i = 0; i < npkts; i++)
+	{
+		if (pkts[i] == NULL)
+			continue;
+
+		if (*firstPkt == NULL)
+			*firstPkt = pkts[i];
+		else
+			putRxBufferToFreeList(&rx_buffer_pool, pkts[i]);
+	}
+	rx_buffer_pool.batchHeld = 0;
+
+	/* the pool may have been shrunk by teardown in the meantime */
+	while (rx_buffer_pool.count > rx_buffer_pool.maxCount &&
+		   rx_buffer_pool.freeList != NULL)
+	{
+		freeRxBuffer(&rx_buffer_pool, getRxBufferFromFreeList(&rx_buffer_pool));
+	}
+
+	pthread_mutex_unlock(&ic_control_info.lock);
+
+	/* real ack sending is after lock release to decrease the lock holding time. */
+	for (i = 0; i < nrecv; i++)
+	{
+		if (valid[i] && params[i].msg.len != 0)
+			sendAckWithParam(&params[i]);
+	}
+
+	return nrecv > 0;
+}
+#endif   /* IC_USE_RECVMMSG */
+
 /*
  * handleMismatch
  * 		If the mismatched packet is from an old connection, we may need to
@@ -27,6 +27,12 @@
 #include "utils/syscache.h"
 
 #include "access/memtup.h"
+#include "access/tupmacs.h"
+#include "access/tuptoaster.h"
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
 
 /* A MemoryContext used within the tuple serialize code, so that freeing of
  * space is SUPAFAST.  It is initialized in the first call to InitSerTupInfo()
@@ -65,6 +71,24 @@ skipPadding(StringInfo serialTup)
 	serialTup->cursor = TYPEALIGN(TUPLE_CHUNK_ALIGN,serialTup->cursor);
 }
 
+/*
+ * The fixed-width arrays of a batch are MAXALIGNed relative to the start of
+ * the serialized batch, the receiver reassembles it in a palloc'd buffer and
+ * fetches the values in place.
+ */
+static inline void
+addMaxAlignPadding(TupleChunkList tcList, TupleChunkListCache *cache)
+{
+	while (tcList->serialized_data_length != MAXALIGN(tcList->serialized_data_length))
+		addCharToChunkList(tcList, 0, cache);
+}
+
+static inline void
+skipMaxAlignPadding(StringInfo serialTup)
+{
+	serialTup->cursor = MAXALIGN(serialTup->cursor);
+}
+
 /*
  * stringInfoGetInt32
  *
@@ -276,6 +300,14 @@ CleanupSerTupInfo(SerTupInfo * pSerInfo)
 
 	pSerInfo->tupdesc = NULL;
 
+	if (pSerInfo->compressRaw.data != NULL)
+		pfree(pSerInfo->compressRaw.data);
+	pSerInfo->compressRaw.data = NULL;
+
+	if (pSerInfo->compressBuf.data != NULL)
+		pfree(pSerInfo->compressBuf.data);
+	pSerInfo->compressBuf.data = NULL;
+
 	while (pSerInfo->chunkCache.items != NULL)
 	{
 		TupleChunkListItem item;
@@ -789,6 +821,263 @@ SerializeTupleDirect(HeapTuple tuple, SerTupInfo * pSerInfo, struct directTransp
 	return dataSize;   
 }
 
+typedef struct TupSerBatchHeader
+{
+	uint32		ntuples;		/* number of tuples */
+	uint32		natts;			/* number of attributes */
+} TupSerBatchHeader;
+
+/* Flags at the start of each attribute section of a batch */
+#define TUPSER_BATCH_HASNULLS	0x0001
+
+/*
+ * Set up the column buffers of a batch for the tuple-descriptor of pSerInfo.
+ *
+ * Like InitSerTupInfo(), the caller sets the desired memory-context.
+ */
+void
+InitSerTupBatch(SerTupInfo *pSerInfo, SerTupBatch *batch)
+{
+	TupleDesc	tupdesc = pSerInfo->tupdesc;
+	int			i;
+
+	AssertArg(batch != NULL);
+
+	batch->ntuples = 0;
+	batch->nbytes = 0;
+	batch->columns = (SerTupBatchColumn *) palloc0(Max(tupdesc->natts, 1) * sizeof(SerTupBatchColumn));
+
+	/* Start small, there is one batch per route and attribute. */
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		SerTupBatchColumn *col = &batch->columns[i];
+
+		initStringInfoOfSize(&col->nulls, 32);
+		initStringInfoOfSize(&col->data, 256);
+		if (tupdesc->attrs[i]->attlen < 0)
+			initStringInfoOfSize(&col->offsets, 256);
+	}
+}
+
+/* Free the column buffers of a batch. */
+void
+CleanupSerTupBatch(SerTupInfo *pSerInfo, SerTupBatch *batch)
+{
+	int			i;
+
+	AssertArg(batch != NULL);
+
+	if (batch->columns == NULL)
+		return;
+
+	for (i = 0; i < pSerInfo->tupdesc->natts; i++)
+	{
+		SerTupBatchColumn *col = &batch->columns[i];
+
+		pfree(col->nulls.data);
+		pfree(col->data.data);
+		if (col->offsets.data != NULL)
+			pfree(col->offsets.data);
+	}
+
+	pfree(batch->columns);
+	batch->columns = NULL;
+	batch->ntuples = 0;
+	batch->nbytes = 0;
+}
+
+/*
+ * Copy the attribute values of a tuple into a batch.
+ *
+ * Fixed-width values are kept for NULLs too, so that the receiver can
+ * index the arrays by tuple number.  Toasted values are fetched, but
+ * values compressed inline are sent as they are.
+ */
+void
+AddTupleToBatch(SerTupInfo *pSerInfo, SerTupBatch *batch, Datum *values, bool *nulls)
+{
+	TupleDesc	tupdesc;
+	int			row;
+	int			i;
+
+	AssertArg(pSerInfo != NULL);
+	AssertArg(batch != NULL && batch->columns != NULL);
+
+	tupdesc = pSerInfo->tupdesc;
+	row = batch->ntuples;
+
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		Form_pg_attribute attr = tupdesc->attrs[i];
+		SerTupBatchColumn *col = &batch->columns[i];
+		StringInfo	data = &col->data;
+		uint32		offset;
+		int			len;
+
+		if ((row & 0x07) == 0)
+			appendStringInfoCharMacro(&col->nulls, 0);
+
+		if (nulls[i])
+		{
+			col->hasnulls = true;
+
+			if (attr->attlen > 0)
+			{
+				enlargeStringInfo(data, attr->attlen);
+				memset(data->data + data->len, 0, attr->attlen);
+				data->len += attr->attlen;
+			}
+			else
+			{
+				offset = data->len;
+				appendBinaryStringInfo(&col->offsets, (char *) &offset, sizeof(uint32));
+			}
+			continue;
+		}
+
+		col->nulls.data[row >> 3] |= (1 << (row & 0x07));
+
+		if (attr->attlen > 0)
+		{
+			len = attr->attlen;
+			enlargeStringInfo(data, len);
+			if (attr->attbyval)
+				store_att_byval(data->data + data->len, values[i], len);
+			else
+				memcpy(data->data + data->len, DatumGetPointer(values[i]), len);
+			data->len += len;
+		}
+		else if (attr->attlen == -1)
+		{
+			struct varlena *value = (struct varlena *) DatumGetPointer(values[i]);
+			bool		fetched = false;
+
+			if (VARATT_IS_EXTERNAL(value))
+			{
+				MemoryContext oldCtxt = MemoryContextSwitchTo(s_tupSerMemCtxt);
+
+				value = heap_tuple_fetch_attr(value);
+				fetched = true;
+				MemoryContextSwitchTo(oldCtxt);
+			}
+
+			/* values with a 4-byte header stay int aligned, as in a heap tuple */
+			if (!VARATT_IS_SHORT(value))
+			{
+				while (data->len != INTALIGN(data->len))
+					appendStringInfoCharMacro(data, 0);
+			}
+
+			len = VARSIZE_ANY(value);
+			offset = data->len;
+			appendBinaryStringInfo(&col->offsets, (char *) &offset, sizeof(uint32));
+			appendBinaryStringInfo(data, (char *) value, len);
+
+			if (fetched)
+				MemoryContextReset(s_tupSerMemCtxt);
+		}
+		else
+		{
+			char	   *str = DatumGetCString(values[i]);
+
+			Assert(attr->attlen == -2);
+
+			len = strlen(str) + 1;
+			offset = data->len;
+			appendBinaryStringInfo(&col->offsets, (char *) &offset, sizeof(uint32));
+			appendBinaryStringInfo(data, str, len);
+		}
+
+		batch->nbytes += len;
+	}
+
+	batch->ntuples++;
+}
+
+/*
+ * Convert a batch into chunks for transmission, and empty the batch.
+ */
+void
+SerializeBatchIntoChunks(SerTupBatch *batch, SerTupInfo *pSerInfo, TupleChunkList tcList)
+{
+	TupleChunkListCache *cache = &pSerInfo->chunkCache;
+	TupleChunkListItem tcItem;
+	TupSerBatchHeader tsbh;
+	TupleDesc	tupdesc;
+	int			i;
+
+	AssertArg(batch != NULL && batch->ntuples > 0);
+	AssertArg(pSerInfo != NULL);
+	AssertArg(tcList != NULL);
+
+	tupdesc = pSerInfo->tupdesc;
+
+	/* get ready to go */
+	tcList->p_first = NULL;
+	tcList->p_last = NULL;
+	tcList->num_chunks = 0;
+	tcList->serialized_data_length = 0;
+	tcList->max_chunk_length = Gp_max_tuple_chunk_size;
+
+	tcItem = getChunkFromCache(cache);
+	if (tcItem == NULL)
+	{
+		ereport(FATAL, (errcode(ERRCODE_OUT_OF_MEMORY),
+						errmsg("Could not allocate space for first chunk item in new chunk list.")));
+	}
+
+	/* assume that we'll take a single chunk */
+	SetChunkType(tcItem->chunk_data, TC_BATCH_WHOLE);
+	tcItem->chunk_length = TUPLE_CHUNK_HEADER_SIZE;
+	appendChunkToTCList(tcList, tcItem);
+
+	tsbh.ntuples = batch->ntuples;
+	tsbh.natts = tupdesc->natts;
+	addByteStringToChunkList(tcList, (char *) &tsbh, sizeof(TupSerBatchHeader), cache);
+
+	for (i = 0; i < tupdesc->natts; i++)
+	{
+		Form_pg_attribute attr = tupdesc->attrs[i];
+		SerTupBatchColumn *col = &batch->columns[i];
+
+		addInt32ToChunkList(tcList, col->hasnulls ? TUPSER_BATCH_HASNULLS : 0, cache);
+
+		if (col->hasnulls)
+		{
+			Assert(col->nulls.len == BITMAPLEN(batch->ntuples));
+			addByteStringToChunkList(tcList, col->nulls.data, col->nulls.len, cache);
+			addPadding(tcList, cache, col->nulls.len);
+		}
+
+		if (attr->attlen < 0)
+		{
+			addInt32ToChunkList(tcList, col->data.len, cache);
+			addByteStringToChunkList(tcList, col->offsets.data, col->offsets.len, cache);
+		}
+
+		addMaxAlignPadding(tcList, cache);
+		addByteStringToChunkList(tcList, col->data.data, col->data.len, cache);
+		addPadding(tcList, cache, col->data.len);
+
+		/* empty the column for the next batch */
+		col->hasnulls = false;
+		resetStringInfo(&col->nulls);
+		resetStringInfo(&col->data);
+		if (attr->attlen < 0)
+			resetStringInfo(&col->offsets);
+	}
+
+	batch->ntuples = 0;
+	batch->nbytes = 0;
+
+	/* as in SerializeTupleIntoChunks() */
+	if (tcList->num_chunks > 1)
+	{
+		SetChunkType(tcList->p_first->chunk_data, TC_BATCH_START);
+		SetChunkType(tcList->p_last->chunk_data, TC_PARTIAL_END);
+	}
+}
+
 /*
  * Deserialize a HeapTuple's data from a byte-array.
  *
@@ -1030,48 +1319,47 @@ DeserializeTuple(SerTupInfo * pSerInfo, StringInfo serialTup)
 	return htup;
 }
 
-HeapTuple
-CvtChunksToHeapTup(TupleChunkList tcList, SerTupInfo * pSerInfo)
+/* Name of a chunk type that starts a collection, for error messages. */
+static const char *
+chunkTypeName(TupleChunkType tcType)
+{
+	switch (tcType)
+	{
+		case TC_WHOLE:
+			return "TC_WHOLE";
+		case TC_PARTIAL_START:
+			return "TC_PARTIAL_START";
+		case TC_BATCH_WHOLE:
+			return "TC_BATCH_WHOLE";
+		case TC_BATCH_START:
+			return "TC_BATCH_START";
+		case TC_COMPRESSED_WHOLE:
+			return "TC_COMPRESSED_WHOLE";
+		case TC_COMPRESSED_START:
+			return "TC_COMPRESSED_START";
+		default:
+			return "unknown";
+	}
+}
+
+/*
+ * Dump all of the data in the tuple chunk list into a single StringInfo, so
+ * that we can convert it into HeapTuples.  Check chunk types based on whether
+ * there is only one chunk, or multiple chunks: the first one must be of
+ * wholeType or startType respectively.
+ */
+static void
+collectChunks(TupleChunkList tcList, StringInfo serData,
+			  TupleChunkType wholeType, TupleChunkType startType)
 {
-	StringInfoData serData;
 	TupleChunkListItem tcItem;
-	int			i;
-	HeapTuple	htup;
 	TupleChunkType tcType;
-
-	AssertArg(tcList != NULL);
-	AssertArg(tcList->p_first != NULL);
-	AssertArg(pSerInfo != NULL);
+	int			i;
 
 	tcItem = tcList->p_first;
 
-	if (tcList->num_chunks == 1)
-	{
-		GetChunkType(tcItem, &tcType);
-
-		if (tcType == TC_EMPTY)
-		{
-			/*
-			 * the sender is indicating that there was a row with no attributes:
-			 * return a NULL tuple
-			 */
-			clearTCList(NULL, tcList);
-
-			htup = heap_form_tuple(pSerInfo->tupdesc, pSerInfo->values, pSerInfo->nulls);
-
-			return htup;
-		}
-	}
-
-	/*
-	 * Dump all of the data in the tuple chunk list into a single StringInfo,
-	 * so that we can convert it into a HeapTuple.	Check chunk types based on
-	 * whether there is only one chunk, or multiple chunks.
-	 *
-	 * We know roughly how much space we'll need, allocate all in one go.
-	 *
-	 */
-	initStringInfoOfSize(&serData, tcList->num_chunks * tcList->max_chunk_length);
+	/* We know roughly how much space we'll need, allocate all in one go. */
+	initStringInfoOfSize(serData, tcList->num_chunks * tcList->max_chunk_length);
 
 	i = 0;
 	do
@@ -1083,20 +1371,22 @@ CvtChunksToHeapTup(TupleChunkList tcList, SerTupInfo * pSerInfo)
 		{
 			if (tcItem->p_next == NULL)
 			{
-				if (tcType != TC_WHOLE)
+				if (tcType != wholeType)
 				{
 					ereport(ERROR, (errcode(ERRCODE_PROTOCOL_VIOLATION),
-									errmsg("Single chunk's type must be TC_WHOLE.")));
+									errmsg("Single chunk's type must be %s.",
+										   chunkTypeName(wholeType))));
 				}
 			}
 			else
 				/* tcItem->p_next != NULL */
 			{
-				if (tcType != TC_PARTIAL_START)
+				if (tcType != startType)
 				{
 					ereport(ERROR, (errcode(ERRCODE_PROTOCOL_VIOLATION),
 									errmsg("First chunk of collection must have type"
-										   " TC_PARTIAL_START.")));
+										   " %s.",
+										   chunkTypeName(startType))));
 				}
 			}
 		}
@@ -1125,7 +1415,7 @@ CvtChunksToHeapTup(TupleChunkList tcList, SerTupInfo * pSerInfo)
 		}
 
 		/* Copy this chunk into the tuple data.  Don't include the header! */
-		appendBinaryStringInfo(&serData,
+		appendBinaryStringInfo(serData,
 							   (const char *) GetChunkDataPtr(tcItem) + TUPLE_CHUNK_HEADER_SIZE,
 							   tcItem->chunk_length - TUPLE_CHUNK_HEADER_SIZE);
 
@@ -1134,9 +1424,16 @@ CvtChunksToHeapTup(TupleChunkList tcList, SerTupInfo * pSerInfo)
 		i++;
 	}
 	while (tcItem != NULL);
+}
 
-	/* we've finished with the TCList, free it now. */
-	clearTCList(NULL, tcList);
+/*
+ * Convert the serialized data of a tuple, reassembled from its chunks, into a
+ * HeapTuple.
+ */
+static HeapTuple
+deserializeHeapTup(StringInfo serData, SerTupInfo *pSerInfo)
+{
+	HeapTuple	htup;
 
 	{
 		TupSerHeader *tshp;
@@ -1144,7 +1441,7 @@ CvtChunksToHeapTup(TupleChunkList tcList, SerTupInfo * pSerInfo)
 		unsigned int	nullslen;
 		unsigned int	hoff;
 		HeapTupleHeader t_data;
-		char *pos = (char *)serData.data;
+		char *pos = (char *)serData->data;
 
 		tshp = (TupSerHeader *)pos;
 
@@ -1163,13 +1460,9 @@ CvtChunksToHeapTup(TupleChunkList tcList, SerTupInfo * pSerInfo)
 			 * the old slow way. */
 			if ((tshp->infomask & (HEAP_HASEXTERNAL | HEAP_HASEXTENDED)) != 0)
 			{
-				serData.cursor += sizeof(TupSerHeader);
+				serData->cursor += sizeof(TupSerHeader);
 
-				htup = DeserializeTuple(pSerInfo, &serData);
-
-				/* Free up memory we used. */
-				pfree(serData.data);
-				return htup;
+				return DeserializeTuple(pSerInfo, serData);
 			}
 
 			/* reconstruct lengths of null bitmap and data part */
@@ -1232,8 +1525,390 @@ CvtChunksToHeapTup(TupleChunkList tcList, SerTupInfo * pSerInfo)
 		}
 	}
 
+	return htup;
+}
+
+HeapTuple
+CvtChunksToHeapTup(TupleChunkList tcList, SerTupInfo * pSerInfo)
+{
+	StringInfoData serData;
+	TupleChunkListItem tcItem;
+	HeapTuple	htup;
+	TupleChunkType tcType;
+
+	AssertArg(tcList != NULL);
+	AssertArg(tcList->p_first != NULL);
+	AssertArg(pSerInfo != NULL);
+
+	tcItem = tcList->p_first;
+
+	if (tcList->num_chunks == 1)
+	{
+		GetChunkType(tcItem, &tcType);
+
+		if (tcType == TC_EMPTY)
+		{
+			/*
+			 * the sender is indicating that there was a row with no attributes:
+			 * return a NULL tuple
+			 */
+			clearTCList(NULL, tcList);
+
+			htup = heap_form_tuple(pSerInfo->tupdesc, pSerInfo->values, pSerInfo->nulls);
+
+			return htup;
+		}
+	}
+
+	collectChunks(tcList, &serData, TC_WHOLE, TC_PARTIAL_START);
+
+	/* we've finished with the TCList, free it now. */
+	clearTCList(NULL, tcList);
+
+	htup = deserializeHeapTup(&serData, pSerInfo);
+
 	/* Free up memory we used. */
 	pfree(serData.data);
 
 	return htup;
 }
+
+/*
+ * Pointers into a reassembled batch for one attribute, see
+ * CvtChunksToHeapTupBatch().
+ */
+typedef struct TupSerBatchColumnRef
+{
+	bits8	   *nulls;			/* null bitmap, NULL if no NULLs */
+	uint32	   *offsets;		/* var-width: offset of each value */
+	char	   *data;			/* the values */
+	uint32		datalen;		/* length of data */
+} TupSerBatchColumnRef;
+
+/*
+ * Convert a serialized batch, reassembled from its chunks into a palloc'd
+ * buffer, into HeapTuples and add them to fifo.
+ *
+ * The attribute values are fetched in place from the batch, no send/recv
+ * functions are called.  Returns the number of tuples added.
+ */
+static int
+deserializeBatch(StringInfo serData, SerTupInfo *pSerInfo, htup_fifo fifo)
+{
+	TupSerBatchHeader tsbh;
+	TupSerBatchColumnRef *cols;
+	TupleDesc	tupdesc;
+	int			natts;
+	uint32		row;
+	int			i;
+
+	tupdesc = pSerInfo->tupdesc;
+	natts = tupdesc->natts;
+
+	pq_copymsgbytes(serData, (char *) &tsbh, sizeof(TupSerBatchHeader));
+
+	if (tsbh.natts != natts || tsbh.ntuples == 0)
+		ereport(ERROR, (errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+						errmsg("Interconnect error: cannot convert chunks to a batch of tuples."),
+						errdetail("batch of %u tuples with %u attributes, expected %d attributes",
+								  tsbh.ntuples, tsbh.natts, natts)));
+
+	cols = (TupSerBatchColumnRef *) palloc0(Max(natts, 1) * sizeof(TupSerBatchColumnRef));
+
+	/* Locate the arrays of each attribute. */
+	for (i = 0; i < natts; i++)
+	{
+		Form_pg_attribute attr = tupdesc->attrs[i];
+		TupSerBatchColumnRef *col = &cols[i];
+		uint32		flags;
+
+		flags = stringInfoGetInt32(serData);
+
+		if (flags & TUPSER_BATCH_HASNULLS)
+		{
+			col->nulls = (bits8 *) pq_getmsgbytes(serData, BITMAPLEN(tsbh.ntuples));
+			skipPadding(serData);
+		}
+
+		if (attr->attlen < 0)
+		{
+			col->datalen = stringInfoGetInt32(serData);
+			if (tsbh.ntuples > (uint32) (serData->len - serData->cursor) / sizeof(uint32))
+				ereport(ERROR, (errcode(ERRCODE_PROTOCOL_VIOLATION),
+								errmsg("deserialize data underflow")));
+			col->offsets = (uint32 *) pq_getmsgbytes(serData, tsbh.ntuples * sizeof(uint32));
+		}
+		else
+		{
+			if (tsbh.ntuples > (uint32) (serData->len - serData->cursor) / attr->attlen)
+				ereport(ERROR, (errcode(ERRCODE_PROTOCOL_VIOLATION),
+								errmsg("deserialize data underflow")));
+			col->datalen = tsbh.ntuples * attr->attlen;
+		}
+
+		skipMaxAlignPadding(serData);
+		col->data = (char *) pq_getmsgbytes(serData, col->datalen);
+		skipPadding(serData);
+	}
+
+	/* Form the tuples. */
+	for (row = 0; row < tsbh.ntuples; row++)
+	{
+		HeapTuple	htup;
+
+		for (i = 0; i < natts; i++)
+		{
+			Form_pg_attribute attr = tupdesc->attrs[i];
+			TupSerBatchColumnRef *col = &cols[i];
+
+			if (col->nulls != NULL && att_isnull(row, col->nulls))
+			{
+				pSerInfo->values[i] = (Datum) 0;
+				pSerInfo->nulls[i] = true;
+				continue;
+			}
+
+			pSerInfo->nulls[i] = false;
+
+			if (attr->attlen > 0)
+				pSerInfo->values[i] = fetch_att(col->data + row * attr->attlen,
+												attr->attbyval, attr->attlen);
+			else
+			{
+				uint32		offset = col->offsets[row];
+
+				if (offset >= col->datalen)
+					ereport(ERROR, (errcode(ERRCODE_PROTOCOL_VIOLATION),
+									errmsg("deserialize data underflow")));
+
+				pSerInfo->values[i] = PointerGetDatum(col->data + offset);
+			}
+		}
+
+		htup = heap_form_tuple(tupdesc, pSerInfo->values, pSerInfo->nulls);
+		htfifo_addtuple(fifo, htup);
+	}
+
+	/* Free up memory we used. */
+	pfree(cols);
+
+	return tsbh.ntuples;
+}
+
+/*
+ * Convert the chunks of a batch serialized by SerializeBatchIntoChunks()
+ * into HeapTuples, and add them to fifo.  Returns the number of tuples added.
+ */
+int
+CvtChunksToHeapTupBatch(TupleChunkList tcList, SerTupInfo *pSerInfo, htup_fifo fifo)
+{
+	StringInfoData serData;
+	int			numTuples;
+
+	AssertArg(tcList != NULL);
+	AssertArg(tcList->p_first != NULL);
+	AssertArg(pSerInfo != NULL);
+
+	collectChunks(tcList, &serData, TC_BATCH_WHOLE, TC_BATCH_START);
+
+	/* we've finished with the TCList, free it now. */
+	clearTCList(NULL, tcList);
+
+	numTuples = deserializeBatch(&serData, pSerInfo, fifo);
+
+	/* Free up memory we used. */
+	pfree(serData.data);
+
+	return numTuples;
+}
+
+/*
+ * A compressed payload is a TupSerCompressHeader followed by the zlib stream
+ * of the payload of the original TC_WHOLE tuple or TC_BATCH_WHOLE batch.
+ */
+typedef struct TupSerCompressHeader
+{
+	uint32		rawlen;			/* length of the original payload */
+	uint32		zlen;			/* length of the compressed stream */
+	uint16		rawtype;		/* TC_WHOLE or TC_BATCH_WHOLE */
+	uint16		pad;
+} TupSerCompressHeader;
+
+/*
+ * Compress the payload of a chunk list built by SerializeTupleIntoChunks()
+ * or SerializeBatchIntoChunks(), and rebuild the list around the compressed
+ * bytes with TC_COMPRESSED_WHOLE/TC_COMPRESSED_START chunks.
+ *
+ * Returns false, and leaves the list untouched, if the payload is not of a
+ * compressible type or does not get smaller.
+ */
+bool
+CompressChunkList(TupleChunkList tcList, SerTupInfo *pSerInfo, int level)
+{
+#ifdef HAVE_LIBZ
+	TupleChunkListCache *cache = &pSerInfo->chunkCache;
+	TupleChunkListItem tcItem;
+	TupleChunkType tcType;
+	TupSerCompressHeader tsch;
+	char	   *raw;
+	int			rawlen;
+	uLongf		zlen;
+
+	AssertArg(tcList != NULL);
+	AssertArg(tcList->p_first != NULL);
+	AssertArg(pSerInfo != NULL);
+
+	GetChunkType(tcList->p_first, &tcType);
+	if (tcType == TC_WHOLE || tcType == TC_PARTIAL_START)
+		tsch.rawtype = TC_WHOLE;
+	else if (tcType == TC_BATCH_WHOLE || tcType == TC_BATCH_START)
+		tsch.rawtype = TC_BATCH_WHOLE;
+	else
+		return false;
+
+	rawlen = tcList->serialized_data_length;
+	if (rawlen > MaxAllocSize / 2)
+		return false;
+
+	/* A single chunk can be compressed in place, otherwise gather them up. */
+	if (tcList->num_chunks == 1)
+		raw = GetChunkDataPtr(tcList->p_first) + TUPLE_CHUNK_HEADER_SIZE;
+	else
+	{
+		if (pSerInfo->compressRaw.data == NULL)
+			initStringInfoOfSize(&pSerInfo->compressRaw, rawlen + 1);
+		else
+			resetStringInfo(&pSerInfo->compressRaw);
+
+		for (tcItem = tcList->p_first; tcItem != NULL; tcItem = tcItem->p_next)
+			appendBinaryStringInfo(&pSerInfo->compressRaw,
+								   GetChunkDataPtr(tcItem) + TUPLE_CHUNK_HEADER_SIZE,
+								   tcItem->chunk_length - TUPLE_CHUNK_HEADER_SIZE);
+		Assert(pSerInfo->compressRaw.len == rawlen);
+
+		raw = pSerInfo->compressRaw.data;
+	}
+
+	/* worst case, compressBound() doesn't exist in older zlibs */
+	zlen = rawlen + (rawlen >> 12) + (rawlen >> 14) + 11;
+	if (pSerInfo->compressBuf.data == NULL)
+		initStringInfoOfSize(&pSerInfo->compressBuf, zlen + 1);
+	else
+	{
+		resetStringInfo(&pSerInfo->compressBuf);
+		enlargeStringInfo(&pSerInfo->compressBuf, zlen);
+	}
+
+	if (compress2((Bytef *) pSerInfo->compressBuf.data, &zlen,
+				  (Bytef *) raw, rawlen, level) != Z_OK)
+		return false;
+
+	if (zlen + sizeof(TupSerCompressHeader) >= rawlen)
+		return false;
+
+	/* Worth it: swap the original chunks for the compressed ones. */
+	clearTCList(cache, tcList);
+
+	tcList->max_chunk_length = Gp_max_tuple_chunk_size;
+
+	tcItem = getChunkFromCache(cache);
+	if (tcItem == NULL)
+	{
+		ereport(FATAL, (errcode(ERRCODE_OUT_OF_MEMORY),
+						errmsg("Could not allocate space for first chunk item in new chunk list.")));
+	}
+
+	SetChunkType(tcItem->chunk_data, TC_COMPRESSED_WHOLE);
+	tcItem->chunk_length = TUPLE_CHUNK_HEADER_SIZE;
+	appendChunkToTCList(tcList, tcItem);
+
+	tsch.rawlen = rawlen;
+	tsch.zlen = zlen;
+	tsch.pad = 0;
+	addByteStringToChunkList(tcList, (char *) &tsch, sizeof(TupSerCompressHeader), cache);
+	addByteStringToChunkList(tcList, pSerInfo->compressBuf.data, zlen, cache);
+	addPadding(tcList, cache, zlen);
+
+	if (tcList->num_chunks > 1)
+	{
+		SetChunkType(tcList->p_first->chunk_data, TC_COMPRESSED_START);
+		SetChunkType(tcList->p_last->chunk_data, TC_PARTIAL_END);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*
+ * Convert the chunks of a payload compressed by CompressChunkList() into
+ * HeapTuples, and add them to fifo.  Returns the number of tuples added.
+ */
+int
+CvtChunksToHeapTupCompressed(TupleChunkList tcList, SerTupInfo *pSerInfo, htup_fifo fifo)
+{
+	StringInfoData serData;
+	StringInfoData rawData;
+	TupSerCompressHeader tsch;
+	int			numTuples = 0;
+
+	AssertArg(tcList != NULL);
+	AssertArg(tcList->p_first != NULL);
+	AssertArg(pSerInfo != NULL);
+
+	collectChunks(tcList, &serData, TC_COMPRESSED_WHOLE, TC_COMPRESSED_START);
+
+	/* we've finished with the TCList, free it now. */
+	clearTCList(NULL, tcList);
+
+	pq_copymsgbytes(&serData, (char *) &tsch, sizeof(TupSerCompressHeader));
+
+	if (tsch.zlen > serData.len - serData.cursor ||
+		tsch.rawlen >= MaxAllocSize)
+		ereport(ERROR, (errcode(ERRCODE_PROTOCOL_VIOLATION),
+						errmsg("Compressed motion payload of %u bytes does not fit"
+							   " in its %d byte message.",
+							   tsch.zlen, serData.len - serData.cursor)));
+
+	initStringInfoOfSize(&rawData, tsch.rawlen + 1);
+
+#ifdef HAVE_LIBZ
+	{
+		uLongf		rawlen = tsch.rawlen;
+		int			status;
+
+		status = uncompress((Bytef *) rawData.data, &rawlen,
+							(Bytef *) serData.data + serData.cursor, tsch.zlen);
+		if (status != Z_OK || rawlen != tsch.rawlen)
+			ereport(ERROR, (errcode(ERRCODE_GP_INTERCONNECTION_ERROR),
+							errmsg("Interconnect error: could not uncompress motion payload: %s",
+								   status != Z_OK ? zError(status) : "length mismatch")));
+	}
+#else
+	ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+					errmsg("Interconnect error: compressed motion payload received,"
+						   " but this build does not support zlib.")));
+#endif
+
+	rawData.len = tsch.rawlen;
+	rawData.data[rawData.len] = '\0';
+	pfree(serData.data);
+
+	if (tsch.rawtype == TC_WHOLE)
+	{
+		htfifo_addtuple(fifo, deserializeHeapTup(&rawData, pSerInfo));
+		numTuples = 1;
+	}
+	else if (tsch.rawtype == TC_BATCH_WHOLE)
+		numTuples = deserializeBatch(&rawData, pSerInfo, fifo);
+	else
+		ereport(ERROR, (errcode(ERRCODE_PROTOCOL_VIOLATION),
+						errmsg("Compressed motion payload has invalid type %d.",
+							   tsch.rawtype)));
+
+	/* Free up memory we used. */
+	pfree(rawData.data);
+
+	return numTuples;
+}
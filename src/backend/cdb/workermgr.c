@@ -7,6 +7,12 @@
  *	to a thread in the worker manager. In each group, there are some tasks. The
  *	tasks in one group have to be same property. But each group may have
  *	different property.
+ *
+ *	The threads are not created per job.  Each backend keeps a pool of worker
+ *	threads that wait for tasks, so that a job only hands its groups to idle
+ *	threads, and creates new ones only when all of them are busy.  Up to
+ *	gp_workermgr_idle_threads threads stay in the pool between jobs; the
+ *	others exit when their task is done.
  */
 #include "postgres.h"
 #include <pthread.h>
@@ -14,6 +20,7 @@
 #include "cdb/workermgr.h"
 
 #include "cdb/cdbgang.h"		/* gp_pthread_create */
+#include "cdb/cdbvars.h"		/* gp_workermgr_idle_threads */
 #include "miscadmin.h"			/* TODO: InterruptPending */
 
 
@@ -36,10 +43,30 @@ typedef struct WorkerMgrState {
 	/* Control flags */
 	volatile bool	cancel;
 
+	/* Number of submitted tasks not yet finished, under workermgr_pool_lock */
+	int					running;
+
 	int					threads_num;
 	WorkerMgrThread		threads[0];
 } WorkerMgrState;
 
+/*
+ * A thread of the pool.  It runs the task it is given in 'work', then puts
+ * itself back on the idle list, or exits if the list is full.
+ */
+typedef struct WorkerMgrPoolThread {
+	pthread_t			thread;
+	pthread_cond_t		wakeup;
+	WorkerMgrThread		*work;			/* NULL while idle */
+	int					idle_limit;		/* gp_workermgr_idle_threads, as of 'work' */
+	struct WorkerMgrPoolThread *next;	/* in idle list */
+} WorkerMgrPoolThread;
+
+static pthread_mutex_t workermgr_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t workermgr_pool_done = PTHREAD_COND_INITIALIZER;
+static WorkerMgrPoolThread *workermgr_pool_idle = NULL;
+static int	workermgr_pool_nidle = 0;
+
 typedef struct WorkerMgrThreadIterator {
 	int		thread_id;
 } WorkerMgrThreadIterator;
@@ -47,6 +74,7 @@ typedef struct WorkerMgrThreadIterator {
 
 static void	workermgr_init_thread_iterator(WorkerMgrState *state, WorkerMgrThreadIterator *iterator);
 static WorkerMgrThread *workermgr_get_thread_iterator(WorkerMgrState *state, WorkerMgrThreadIterator *iterator);
+static int	workermgr_start_thread(WorkerMgrThread *thread);
 static void *workermgr_thread_func(void *arg);
 static void workermgr_join(WorkerMgrState *state);
 
@@ -95,10 +123,9 @@ workermgr_submit_job(WorkerMgrState *state,
 		i++;
 		worker_mgr_thread->func = func;
 
-		worker_mgr_thread->thread_ret = gp_pthread_create(&worker_mgr_thread->thread, workermgr_thread_func, worker_mgr_thread, "submit_plan_to_qe");
+		worker_mgr_thread->thread_ret = workermgr_start_thread(worker_mgr_thread);
 		if (worker_mgr_thread->thread_ret)
 			goto error_cleanup;
-		worker_mgr_thread->started = true;
 	}
 
 	return true;
@@ -151,15 +178,113 @@ workermgr_get_thread_iterator(WorkerMgrState *state, WorkerMgrThreadIterator *it
 	return &state->threads[iterator->thread_id++];
 }
 
+/*
+ * workermgr_start_thread
+ *	Hand a group to an idle thread of the pool, or to a new one if there is
+ *	none.  Returns the error of thread creation, or 0.
+ */
+static int
+workermgr_start_thread(WorkerMgrThread *thread)
+{
+	WorkerMgrPoolThread	*pool_thread;
+	int		ret;
+
+	pthread_mutex_lock(&workermgr_pool_lock);
+	pool_thread = workermgr_pool_idle;
+	if (pool_thread != NULL)
+	{
+		workermgr_pool_idle = pool_thread->next;
+		workermgr_pool_nidle--;
+
+		thread->state->running++;
+		thread->started = true;
+		pool_thread->work = thread;
+		pool_thread->idle_limit = gp_workermgr_idle_threads;
+		pthread_cond_signal(&pool_thread->wakeup);
+		pthread_mutex_unlock(&workermgr_pool_lock);
+		return 0;
+	}
+	pthread_mutex_unlock(&workermgr_pool_lock);
+
+	/* The pool thread outlives this job, so it can't live in its memory */
+	pool_thread = malloc(sizeof(WorkerMgrPoolThread));
+	if (pool_thread == NULL)
+		return ENOMEM;
+	pthread_cond_init(&pool_thread->wakeup, NULL);
+	pool_thread->work = thread;
+	pool_thread->idle_limit = gp_workermgr_idle_threads;
+	pool_thread->next = NULL;
+
+	pthread_mutex_lock(&workermgr_pool_lock);
+	thread->state->running++;
+	thread->started = true;
+	pthread_mutex_unlock(&workermgr_pool_lock);
+
+	ret = gp_pthread_create(&pool_thread->thread, workermgr_thread_func, pool_thread, "submit_plan_to_qe");
+	if (ret)
+	{
+		pthread_mutex_lock(&workermgr_pool_lock);
+		thread->state->running--;
+		thread->started = false;
+		pthread_mutex_unlock(&workermgr_pool_lock);
+
+		pthread_cond_destroy(&pool_thread->wakeup);
+		free(pool_thread);
+		return ret;
+	}
+
+	/* Nobody joins pool threads */
+	pthread_detach(pool_thread->thread);
+	return 0;
+}
+
 /*
  * workermgr_thread_func
+ *	Main loop of a pool thread.
  */
 static void *
 workermgr_thread_func(void *arg)
 {
-	WorkerMgrThread	*thread = (WorkerMgrThread *) arg;
+	WorkerMgrPoolThread	*pool_thread = (WorkerMgrPoolThread *) arg;
 
-	thread->func(thread->task, thread->state);
+	gp_set_thread_sigmasks();
+
+	for (;;)
+	{
+		WorkerMgrThread	*thread;
+		bool	keep;
+
+		pthread_mutex_lock(&workermgr_pool_lock);
+		while (pool_thread->work == NULL)
+			pthread_cond_wait(&pool_thread->wakeup, &workermgr_pool_lock);
+		thread = pool_thread->work;
+		pthread_mutex_unlock(&workermgr_pool_lock);
+
+		thread->func(thread->task, thread->state);
+
+		/*
+		 * After running is decremented the job's state may be freed, so it
+		 * must not be touched again.
+		 */
+		pthread_mutex_lock(&workermgr_pool_lock);
+		thread->state->running--;
+		pool_thread->work = NULL;
+		keep = (workermgr_pool_nidle < pool_thread->idle_limit);
+		if (keep)
+		{
+			pool_thread->next = workermgr_pool_idle;
+			workermgr_pool_idle = pool_thread;
+			workermgr_pool_nidle++;
+		}
+		pthread_cond_broadcast(&workermgr_pool_done);
+		pthread_mutex_unlock(&workermgr_pool_lock);
+
+		if (!keep)
+			break;
+	}
+
+	pthread_cond_destroy(&pool_thread->wakeup);
+	free(pool_thread);
 	return NULL;
 }
 
@@ -175,24 +300,16 @@ workermgr_should_query_stop(WorkerMgrState *state)
 	return false;
 }
 
-/*
- * workermgr_thread_cleanup
- *	TODO: pthread_join may not be able to interrupt, so change it to a loop!
- */
-static void
-workermgr_thread_cleanup(WorkerMgrThread *thread)
-{
-	if (thread->started)
-	{
-		pthread_join(thread->thread, NULL);
-		thread->started = false;
-	}
-}
-
 /*
  * workermgr_join
- *	Cleanup the threads, set state->cancel properly before calling. This
- *	function have to be safe even if it was interrupted and get into again.
+ *	Wait for the tasks of the job to finish, set state->cancel properly
+ *	before calling. This function have to be safe even if it was interrupted
+ *	and get into again.
+ *
+ *	The wait is not interrupted: the tasks use the job's state until they
+ *	finish, so it can't be freed before.  They poll
+ *	workermgr_should_query_stop(), which sees a pending interrupt, so a
+ *	cancel doesn't leave this waiting long.
  */
 static void
 workermgr_join(WorkerMgrState *state)
@@ -200,10 +317,14 @@ workermgr_join(WorkerMgrState *state)
 	WorkerMgrThreadIterator		iterator;
 	WorkerMgrThread				*thread;
 
+	pthread_mutex_lock(&workermgr_pool_lock);
+	while (state->running > 0)
+		pthread_cond_wait(&workermgr_pool_done, &workermgr_pool_lock);
+	pthread_mutex_unlock(&workermgr_pool_lock);
+
 	workermgr_init_thread_iterator(state, &iterator);
 	while ((thread = workermgr_get_thread_iterator(state, &iterator)) != NULL)
 	{
-		workermgr_thread_cleanup(thread);
+		thread->started = false;
 	}
 }
-
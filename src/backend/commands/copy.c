@@ -2285,7 +2285,7 @@ CopyTo(CopyState cstate)
 				for(i=0; i<nvp; ++i)
 					proj[i] = true;
 
-				scan = parquet_beginscan(rel, ActiveSnapshot, 0, proj);
+				scan = parquet_beginscan(rel, ActiveSnapshot, 0, proj, NIL);
 				scan->splits = cstate->splits;
 				for(;;)
 				{
@@ -5118,23 +5118,8 @@ CopyReadAttributesText(CopyState cstate, bool * __restrict nulls,
 	{
 		bytes_remaining = cstate->line_buf.len - cstate->line_buf.cursor;
 		stop = scan_start + bytes_remaining;
-		/*
-		 * We can eliminate one test (for length) in the loop by replacing the
-		 * last byte with the delimiter.  We need to remember what it was so we
-		 * can replace it later.
-		 */
-		char  endchar = *(stop-1);
-		*(stop-1) = delimc;
-
 		/* Find the next of: delimiter, or escape, or end of buffer */
-		for (scanner = scan_start; *scanner != delimc && *scanner != escapec; scanner++)
-			;
-		if (scanner == (stop-1) && endchar != delimc)
-		{
-			if (endchar != escapec)
-				scanner++;
-		}
-		*(stop-1) = endchar;
+		scanner = copyScanChars(scan_start, stop, delimc, escapec, escapec);
 
 		scan_end = (*scanner != '\0' ? (char *) scanner : NULL);
 
@@ -5472,11 +5457,13 @@ CopyReadAttributesCSV(CopyState cstate, bool *nulls, int *attr_offsets,
 	bool		in_quote = false;
 	bool		saw_quote = false;
 	ListCell   *cur;			/* cursor to attribute list used for this COPY */
+	char	   *line_end;		/* the eol char, which is not parsed */
 
 	/* init variables for attribute scan */
 	RESET_ATTRBUF;
 
 	cur = list_head(cstate->attnumlist);
+	line_end = cstate->line_buf.data + cstate->line_buf.len - 1;
 
 	if(num_phys_attrs > 0)
 	{
@@ -5560,6 +5547,30 @@ CopyReadAttributesCSV(CopyState cstate, bool *nulls, int *attr_offsets,
 			break;
 		}
 
+		/*
+		 * copy the run of bytes up to the next one that may mean something
+		 * here in one go
+		 */
+		{
+			char	   *run = cstate->line_buf.data + cstate->line_buf.cursor;
+			char	   *run_end;
+
+			if (in_quote)
+				run_end = copyScanChars(run, line_end, quotec, escapec, quotec);
+			else if (cstate->delimiter_off)
+				run_end = copyScanChars(run, line_end, quotec, quotec, quotec);
+			else
+				run_end = copyScanChars(run, line_end, delimc, quotec, quotec);
+
+			if (run_end != run)
+			{
+				appendBinaryStringInfo(&cstate->attribute_buf, run, run_end - run);
+				cstate->line_buf.cursor += run_end - run;
+				cstate->attribute_buf.cursor += run_end - run;
+				continue;
+			}
+		}
+
 		c = cstate->line_buf.data[cstate->line_buf.cursor++];
 
 		/* unquoted field delimiter  */
@@ -6472,16 +6483,31 @@ scanCSVLine(CopyState cstate, const char *s, char eol, char escapec, char quotec
 		cstate->missing_bytes = (s > end ? s - end : 0);
 	}
 	else
-		/* safe to scroll byte by byte */
+		/* safe to scroll byte by byte, so skip to the next special one */
 	{	
-		for ( ; *s != eol && s < end ; s++)
+		while (s < end)
 		{
+			const char *next = copyScanChars(s, end, eol, escapec, quotec);
+
+			/* the bytes skipped are not escapes */
+			if (next != s)
+			{
+				cstate->last_was_esc = false;
+				s = next;
+				if (s == end)
+					break;
+			}
+
+			if (*s == eol)
+				break;
+
 			if (cstate->in_quote && *s == escapec)
 				cstate->last_was_esc = !cstate->last_was_esc;
 			if (*s == quotec && !cstate->last_was_esc)
 				cstate->in_quote = !cstate->in_quote;
 			if (*s != escapec)
 				cstate->last_was_esc = false;
+			s++;
 		}
 	}
 
@@ -0,0 +1,148 @@
+/*-------------------------------------------------------------------------
+ *
+ * copyscan.c
+ *	  Search COPY input for its structural characters (delimiter, quote,
+ *	  escape, end of line) many bytes at a time.
+ *
+ * COPY text and CSV parsing spends most of its time walking over ordinary
+ * data bytes to get to the next character that means something.  The
+ * routines here find the first of up to three given bytes in a range.  On
+ * x86 they compare 16 (SSE2) or 32 (AVX2) bytes per step; the variant is
+ * picked the first time copyScanChars is called, like crc32c.
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "commands/copy.h"
+
+static char *copyScanCharsSimple(const char *s, const char *end,
+								 char c1, char c2, char c3);
+
+/*
+ * Return a pointer to the first byte in [s, end) that is c1, c2 or c3, or
+ * end if there is none.  Pass a character twice to look for fewer than
+ * three.  This is only safe on input where no trailing byte of a multibyte
+ * character can look like one of them.
+ */
+static char *
+copyScanCharsSimple(const char *s, const char *end, char c1, char c2, char c3)
+{
+	for (; s < end; s++)
+	{
+		if (*s == c1 || *s == c2 || *s == c3)
+			break;
+	}
+
+	return (char *) s;
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <immintrin.h>
+
+static char *copyScanCharsSSE2(const char *s, const char *end,
+							   char c1, char c2, char c3);
+static char *copyScanCharsAVX2(const char *s, const char *end,
+							   char c1, char c2, char c3);
+static char *copyScanCharsDetect(const char *s, const char *end,
+								 char c1, char c2, char c3);
+
+/* SSE2 is always there on x86_64 */
+static char *
+copyScanCharsSSE2(const char *s, const char *end, char c1, char c2, char c3)
+{
+	__m128i		v1 = _mm_set1_epi8(c1);
+	__m128i		v2 = _mm_set1_epi8(c2);
+	__m128i		v3 = _mm_set1_epi8(c3);
+
+	while (end - s >= 16)
+	{
+		__m128i		chunk = _mm_loadu_si128((const __m128i *) s);
+		__m128i		hit;
+		int			mask;
+
+		hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, v1),
+										_mm_cmpeq_epi8(chunk, v2)),
+						   _mm_cmpeq_epi8(chunk, v3));
+		mask = _mm_movemask_epi8(hit);
+		if (mask != 0)
+			return (char *) s + __builtin_ctz(mask);
+		s += 16;
+	}
+
+	return copyScanCharsSimple(s, end, c1, c2, c3);
+}
+
+__attribute__((target("avx2")))
+static char *
+copyScanCharsAVX2(const char *s, const char *end, char c1, char c2, char c3)
+{
+	__m256i		v1 = _mm256_set1_epi8(c1);
+	__m256i		v2 = _mm256_set1_epi8(c2);
+	__m256i		v3 = _mm256_set1_epi8(c3);
+
+	while (end - s >= 32)
+	{
+		__m256i		chunk = _mm256_loadu_si256((const __m256i *) s);
+		__m256i		hit;
+		unsigned int mask;
+
+		hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, v1),
+											  _mm256_cmpeq_epi8(chunk, v2)),
+							  _mm256_cmpeq_epi8(chunk, v3));
+		mask = (unsigned int) _mm256_movemask_epi8(hit);
+		if (mask != 0)
+			return (char *) s + __builtin_ctz(mask);
+		s += 32;
+	}
+
+	/* the tail still has up to 31 bytes */
+	return copyScanCharsSSE2(s, end, c1, c2, c3);
+}
+
+/*
+ * Pick the best variant for this CPU.  This gets called the first time
+ * someone scans.
+ */
+static char *
+copyScanCharsDetect(const char *s, const char *end, char c1, char c2, char c3)
+{
+	uint32		eax, ebx, ecx = 0, edx;
+	bool		hasAVX2 = false;
+
+	/*
+	 * AVX2 needs the CPU to have it (level 7, ebx) and the OS to save the
+	 * YMM registers (level 1 OSXSAVE, then XCR0 bits 1 and 2).
+	 */
+	if (__get_cpuid_max(0, NULL) >= 7 &&
+		__get_cpuid(1, &eax, &ebx, &ecx, &edx) &&
+		(ecx & bit_OSXSAVE) != 0)
+	{
+		uint32		xcr0_lo, xcr0_hi;
+
+		__asm__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+		if ((xcr0_lo & 0x6) == 0x6)
+		{
+			__cpuid_count(7, 0, eax, ebx, ecx, edx);
+			hasAVX2 = (ebx & bit_AVX2) != 0;
+		}
+	}
+
+	if (hasAVX2)
+		copyScanChars = &copyScanCharsAVX2;
+	else
+		copyScanChars = &copyScanCharsSSE2;
+
+	return copyScanChars(s, end, c1, c2, c3);
+}
+
+CopyScanCharsFunc copyScanChars = &copyScanCharsDetect;
+
+#else
+
+/* not x86_64: the portable loop */
+CopyScanCharsFunc copyScanChars = &copyScanCharsSimple;
+
+#endif
@@ -6216,7 +6216,7 @@ ATRewriteTable(AlteredTableInfo *tab, Oid OIDNewHeap)
 				idesc = parquet_insert_init(newrel, segfileinfo);
 			}
 
-			sdesc = parquet_beginscan(oldrel, SnapshotNow, oldTupDesc, proj);
+			sdesc = parquet_beginscan(oldrel, SnapshotNow, oldTupDesc, proj, NIL);
 			sdesc->splits = GetFileSplitsOfSegment(tab->scantable_splits,
 			                oldrel->rd_id, GetQEIndex());
 			parquet_getnext(sdesc, ForwardScanDirection, oldslot);
@@ -15343,7 +15343,7 @@ split_rows(Relation intoa, Relation intob, Relation temprel, List *splits, int s
 			aocsproj[i] = true;
 
 
-		parquetscan = parquet_beginscan(temprel, SnapshotNow, NULL /* relationTupleDesc */, aocsproj);
+		parquetscan = parquet_beginscan(temprel, SnapshotNow, NULL /* relationTupleDesc */, aocsproj, NIL);
 		parquetscan->splits = splits;
 	}
 	else
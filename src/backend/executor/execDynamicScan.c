@@ -271,6 +271,7 @@ DynamicScan_InitExpressions(ScanState *scanState, DynamicPartitionIterator *iter
 	 */
 	if (iterator->firstPartition || NULL != iterator->attMap)
 	{
+		ExecResetFastQual(scanState);
 		MemoryContextReset(iterator->partitionMemoryContext);
 
 		/*
@@ -717,6 +718,7 @@ DynamicScan_InitIndexExpressions(IndexScanState *indexScanState, bool initQual,
 
 	if (initQual)
 	{
+		ExecResetFastQual(scanState);
 		scanState->ps.qual = (List *)ExecInitExpr((Expr *)plan->qual, (PlanState*)scanState);
 	}
 
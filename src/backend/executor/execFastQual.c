@@ -0,0 +1,720 @@
+/*-------------------------------------------------------------------------
+ *
+ * execFastQual.c
+ *	  Evaluate simple scan quals without the expression interpreter.
+ *
+ * Most quals of filter-heavy scans are comparisons of a column with a
+ * constant, combined with AND/OR, BETWEEN (which the parser expands into
+ * two comparisons), IN-lists and IS [NOT] NULL.  Evaluated through
+ * ExecQual(), each of them costs an ExprState dispatch per node and an fmgr
+ * call per comparison.  ExecBuildFastQual() compiles such quals once into a
+ * small tree of FastQualNodes whose constants are already decoded, and
+ * ExecFastQual() evaluates that tree directly on the values of the scan
+ * slot.  Quals that cannot be compiled are left to ExecQual().
+ *
+ * Only built-in comparison functions whose semantics are reproduced here
+ * are compiled: integer, float, date and timestamp comparisons, including
+ * the cross-type integer and float ones, and text equality and inequality,
+ * which are bitwise.  All of them are strict, so a NULL input makes the
+ * qual not true.  A qual list only ever asks whether a clause is true, and
+ * without NOT that is also all AND and OR need of their arms, so NULL is
+ * treated as false throughout.
+ *
+ * Portions Copyright (c) 2006 - present, EMC/Greenplum
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/tuptoaster.h"
+#include "executor/executor.h"
+#include "utils/array.h"
+#include "utils/fmgroids.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+
+#include <math.h>
+
+/* How a column value or constant is decoded from its Datum */
+typedef enum FastQualArg
+{
+	FQA_INT2,
+	FQA_INT4,
+	FQA_INT8,
+	FQA_FLOAT4,
+	FQA_FLOAT8,
+	FQA_TEXT
+} FastQualArg;
+
+#ifdef HAVE_INT64_TIMESTAMP
+#define FQA_TIMESTAMP FQA_INT8
+#else
+#define FQA_TIMESTAMP FQA_FLOAT8
+#endif
+
+/* How decoded values compare */
+typedef enum FastQualClass
+{
+	FQC_INT,					/* as int64 */
+	FQC_FLOAT,					/* as double, NaN above everything */
+	FQC_TEXT					/* bitwise, equality only */
+} FastQualClass;
+
+typedef enum FastQualOp
+{
+	FQOP_EQ,
+	FQOP_NE,
+	FQOP_LT,
+	FQOP_LE,
+	FQOP_GT,
+	FQOP_GE
+} FastQualOp;
+
+typedef enum FastQualKind
+{
+	FQ_CMP,						/* column op constant */
+	FQ_IN,						/* column = ANY (constant array) */
+	FQ_ISNULL,
+	FQ_NOTNULL,
+	FQ_AND,
+	FQ_OR
+} FastQualKind;
+
+/*
+ * A comparison function we know how to evaluate: the decoding of its left
+ * and right argument, and the comparison it makes.
+ */
+typedef struct FastQualFunc
+{
+	Oid			funcid;
+	FastQualArg larg;
+	FastQualArg rarg;
+	FastQualOp	op;
+} FastQualFunc;
+
+#define FQ_FUNCS(prefix, l, r) \
+	{ F_##prefix##EQ, l, r, FQOP_EQ }, \
+	{ F_##prefix##NE, l, r, FQOP_NE }, \
+	{ F_##prefix##LT, l, r, FQOP_LT }, \
+	{ F_##prefix##LE, l, r, FQOP_LE }, \
+	{ F_##prefix##GT, l, r, FQOP_GT }, \
+	{ F_##prefix##GE, l, r, FQOP_GE }
+
+static const FastQualFunc fastQualFuncs[] =
+{
+	FQ_FUNCS(INT2, FQA_INT2, FQA_INT2),
+	FQ_FUNCS(INT4, FQA_INT4, FQA_INT4),
+	FQ_FUNCS(INT8, FQA_INT8, FQA_INT8),
+	FQ_FUNCS(INT24, FQA_INT2, FQA_INT4),
+	FQ_FUNCS(INT42, FQA_INT4, FQA_INT2),
+	FQ_FUNCS(INT28, FQA_INT2, FQA_INT8),
+	FQ_FUNCS(INT82, FQA_INT8, FQA_INT2),
+	FQ_FUNCS(INT48, FQA_INT4, FQA_INT8),
+	FQ_FUNCS(INT84, FQA_INT8, FQA_INT4),
+	FQ_FUNCS(FLOAT4, FQA_FLOAT4, FQA_FLOAT4),
+	FQ_FUNCS(FLOAT8, FQA_FLOAT8, FQA_FLOAT8),
+	FQ_FUNCS(FLOAT48, FQA_FLOAT4, FQA_FLOAT8),
+	FQ_FUNCS(FLOAT84, FQA_FLOAT8, FQA_FLOAT4),
+	FQ_FUNCS(DATE_, FQA_INT4, FQA_INT4),
+	FQ_FUNCS(TIMESTAMP_, FQA_TIMESTAMP, FQA_TIMESTAMP),
+	{ F_TEXTEQ, FQA_TEXT, FQA_TEXT, FQOP_EQ },
+	{ F_TEXTNE, FQA_TEXT, FQA_TEXT, FQOP_NE }
+};
+
+/* A decoded constant */
+typedef struct FastQualValue
+{
+	int64		ival;
+	double		fval;
+	char	   *tval;
+	int			tlen;
+} FastQualValue;
+
+typedef struct FastQualNode
+{
+	FastQualKind kind;
+
+	/* FQ_CMP, FQ_IN, FQ_ISNULL, FQ_NOTNULL: the scan column tested */
+	AttrNumber	attno;
+	FastQualArg argtype;
+	FastQualClass cls;
+
+	/* FQ_CMP: column op value */
+	FastQualOp	op;
+	FastQualValue value;
+
+	/* FQ_IN: the non-null array elements, sorted unless text */
+	int			nvalues;
+	FastQualValue *values;
+
+	/* FQ_AND, FQ_OR */
+	int			nargs;
+	struct FastQualNode **args;
+} FastQualNode;
+
+struct FastQualProgram
+{
+	FastQualNode *root;			/* AND of the compiled quals */
+	AttrNumber	maxattno;		/* highest scan column they reference */
+	List	   *residual;		/* ExprStates left to ExecQual() */
+};
+
+static FastQualNode *fq_compile(Expr *expr, AttrNumber *maxattno);
+static const FastQualFunc *fq_lookup_func(Oid opno, Oid funcid);
+static Var *fq_scan_var(Expr *expr);
+static FastQualClass fq_class(FastQualArg arg);
+static void fq_decode(Datum d, FastQualArg arg, FastQualValue *value, bool copy);
+static int	fq_compare(FastQualClass cls, const FastQualValue *a,
+					   const FastQualValue *b);
+static int	fq_compare_int(const void *a, const void *b);
+static int	fq_compare_float(const void *a, const void *b);
+static bool fq_eval(FastQualNode *node, TupleTableSlot *slot);
+static bool fq_eval_cmp(FastQualNode *node, Datum d);
+static bool fq_eval_in(FastQualNode *node, Datum d);
+
+
+/*
+ * ExecResetFastQual
+ *		Forget the program compiled for the qual of a scan.
+ *
+ * Must be called whenever ps.qual is rebuilt (e.g. for a partition with a
+ * different column layout): the new list may well be allocated at the
+ * address of the old one, which ExecScan() would take for the same qual.
+ */
+void
+ExecResetFastQual(ScanState *node)
+{
+	node->ss_fastQual = NULL;
+	node->ss_fastQualSource = NULL;
+}
+
+/*
+ * ExecBuildFastQual
+ *		Compile the clauses of an initialized qual list that we know how to
+ *		evaluate directly.
+ *
+ * The program and everything it points to is allocated in cxt.  Returns
+ * NULL if no clause could be compiled, in which case the caller should keep
+ * using ExecQual().
+ */
+FastQualProgram *
+ExecBuildFastQual(List *qual, MemoryContext cxt)
+{
+	FastQualProgram *prog;
+	MemoryContext oldcxt;
+	List	   *compiled = NIL;
+	List	   *residual = NIL;
+	AttrNumber	maxattno = 0;
+	ListCell   *lc;
+	int			i;
+
+	oldcxt = MemoryContextSwitchTo(cxt);
+
+	foreach(lc, qual)
+	{
+		ExprState  *clause = (ExprState *) lfirst(lc);
+		FastQualNode *node = fq_compile(clause->expr, &maxattno);
+
+		if (node != NULL)
+			compiled = lappend(compiled, node);
+		else
+			residual = lappend(residual, clause);
+	}
+
+	if (compiled == NIL)
+	{
+		list_free(residual);
+		MemoryContextSwitchTo(oldcxt);
+		return NULL;
+	}
+
+	prog = (FastQualProgram *) palloc0(sizeof(FastQualProgram));
+	prog->root = (FastQualNode *) palloc0(sizeof(FastQualNode));
+	prog->root->kind = FQ_AND;
+	prog->root->nargs = list_length(compiled);
+	prog->root->args = (FastQualNode **)
+		palloc(prog->root->nargs * sizeof(FastQualNode *));
+	i = 0;
+	foreach(lc, compiled)
+		prog->root->args[i++] = (FastQualNode *) lfirst(lc);
+	list_free(compiled);
+
+	prog->maxattno = maxattno;
+	prog->residual = residual;
+
+	MemoryContextSwitchTo(oldcxt);
+	return prog;
+}
+
+/*
+ * ExecFastQual
+ *		Check the scan tuple of econtext against a compiled qual list.
+ *
+ * Equivalent to ExecQual(qual, econtext, false) on the list the program
+ * was built from, except that the compiled clauses are checked first.
+ */
+bool
+ExecFastQual(FastQualProgram *prog, ExprContext *econtext)
+{
+	TupleTableSlot *slot = econtext->ecxt_scantuple;
+
+	/* Deform the referenced columns once instead of once per clause */
+	slot_getsomeattrs(slot, prog->maxattno);
+
+	if (!fq_eval(prog->root, slot))
+		return false;
+
+	return prog->residual == NIL ||
+		ExecQual(prog->residual, econtext, false);
+}
+
+/*
+ * fq_compile
+ *		Compile one clause, or return NULL if it is not simple enough.
+ */
+static FastQualNode *
+fq_compile(Expr *expr, AttrNumber *maxattno)
+{
+	FastQualNode *node;
+
+	if (IsA(expr, OpExpr))
+	{
+		OpExpr	   *opexpr = (OpExpr *) expr;
+		const FastQualFunc *func;
+		Var		   *var;
+		Const	   *con;
+		FastQualArg vararg;
+		FastQualArg conarg;
+		FastQualOp	op;
+
+		if (list_length(opexpr->args) != 2)
+			return NULL;
+		func = fq_lookup_func(opexpr->opno, opexpr->opfuncid);
+		if (func == NULL)
+			return NULL;
+
+		op = func->op;
+		var = fq_scan_var(linitial(opexpr->args));
+		if (var != NULL && IsA(lsecond(opexpr->args), Const))
+		{
+			con = (Const *) lsecond(opexpr->args);
+			vararg = func->larg;
+			conarg = func->rarg;
+		}
+		else if (IsA(linitial(opexpr->args), Const) &&
+				 (var = fq_scan_var(lsecond(opexpr->args))) != NULL)
+		{
+			/* const op column: commute to column op' const */
+			con = (Const *) linitial(opexpr->args);
+			vararg = func->rarg;
+			conarg = func->larg;
+			switch (op)
+			{
+				case FQOP_LT: op = FQOP_GT; break;
+				case FQOP_LE: op = FQOP_GE; break;
+				case FQOP_GT: op = FQOP_LT; break;
+				case FQOP_GE: op = FQOP_LE; break;
+				default: break;
+			}
+		}
+		else
+			return NULL;
+
+		/* A NULL constant makes the clause NULL; leave that to ExecQual */
+		if (con->constisnull)
+			return NULL;
+
+		node = (FastQualNode *) palloc0(sizeof(FastQualNode));
+		node->kind = FQ_CMP;
+		node->attno = var->varattno;
+		node->argtype = vararg;
+		node->cls = fq_class(vararg);
+		node->op = op;
+		fq_decode(con->constvalue, conarg, &node->value, true);
+		*maxattno = Max(*maxattno, var->varattno);
+		return node;
+	}
+
+	if (IsA(expr, ScalarArrayOpExpr))
+	{
+		ScalarArrayOpExpr *saop = (ScalarArrayOpExpr *) expr;
+		const FastQualFunc *func;
+		Var		   *var;
+		Const	   *con;
+		ArrayType  *arr;
+		int16		elmlen;
+		bool		elmbyval;
+		char		elmalign;
+		Datum	   *elems;
+		bool	   *nulls;
+		int			nelems;
+		int			i;
+
+		if (!saop->useOr || list_length(saop->args) != 2)
+			return NULL;
+		func = fq_lookup_func(saop->opno, saop->opfuncid);
+		if (func == NULL || func->op != FQOP_EQ)
+			return NULL;
+		var = fq_scan_var(linitial(saop->args));
+		if (var == NULL || !IsA(lsecond(saop->args), Const))
+			return NULL;
+		con = (Const *) lsecond(saop->args);
+		if (con->constisnull)
+			return NULL;
+
+		arr = DatumGetArrayTypeP(con->constvalue);
+		get_typlenbyvalalign(ARR_ELEMTYPE(arr), &elmlen, &elmbyval, &elmalign);
+		deconstruct_array(arr, ARR_ELEMTYPE(arr), elmlen, elmbyval, elmalign,
+						  &elems, &nulls, &nelems);
+
+		node = (FastQualNode *) palloc0(sizeof(FastQualNode));
+		node->kind = FQ_IN;
+		node->attno = var->varattno;
+		node->argtype = func->larg;
+		node->cls = fq_class(func->larg);
+		node->values = (FastQualValue *) palloc0(Max(nelems, 1) * sizeof(FastQualValue));
+
+		/* NULL elements can only make the result NULL, i.e. not true */
+		for (i = 0; i < nelems; i++)
+		{
+			if (nulls[i])
+				continue;
+			fq_decode(elems[i], func->rarg, &node->values[node->nvalues++], true);
+		}
+
+		if (node->cls == FQC_INT)
+			qsort(node->values, node->nvalues, sizeof(FastQualValue),
+				  fq_compare_int);
+		else if (node->cls == FQC_FLOAT)
+			qsort(node->values, node->nvalues, sizeof(FastQualValue),
+				  fq_compare_float);
+
+		*maxattno = Max(*maxattno, var->varattno);
+		return node;
+	}
+
+	if (IsA(expr, NullTest))
+	{
+		NullTest   *ntest = (NullTest *) expr;
+		Var		   *var;
+
+		if (!IsA(ntest->arg, Var))
+			return NULL;
+		var = fq_scan_var(ntest->arg);
+
+		/* IS NULL on a row tests its fields, not the row */
+		if (var == NULL || type_is_rowtype(var->vartype))
+			return NULL;
+
+		node = (FastQualNode *) palloc0(sizeof(FastQualNode));
+		node->kind = (ntest->nulltesttype == IS_NULL) ? FQ_ISNULL : FQ_NOTNULL;
+		node->attno = var->varattno;
+		*maxattno = Max(*maxattno, var->varattno);
+		return node;
+	}
+
+	if (IsA(expr, BoolExpr))
+	{
+		BoolExpr   *bexpr = (BoolExpr *) expr;
+		ListCell   *lc;
+		int			i;
+
+		if (bexpr->boolop != AND_EXPR && bexpr->boolop != OR_EXPR)
+			return NULL;
+
+		node = (FastQualNode *) palloc0(sizeof(FastQualNode));
+		node->kind = (bexpr->boolop == AND_EXPR) ? FQ_AND : FQ_OR;
+		node->nargs = list_length(bexpr->args);
+		node->args = (FastQualNode **) palloc(node->nargs * sizeof(FastQualNode *));
+
+		i = 0;
+		foreach(lc, bexpr->args)
+		{
+			node->args[i] = fq_compile((Expr *) lfirst(lc), maxattno);
+			if (node->args[i] == NULL)
+				return NULL;
+			i++;
+		}
+		return node;
+	}
+
+	return NULL;
+}
+
+/*
+ * fq_lookup_func
+ *		Find the comparison behind an operator, if it is one we evaluate.
+ */
+static const FastQualFunc *
+fq_lookup_func(Oid opno, Oid funcid)
+{
+	int			i;
+
+	if (!OidIsValid(funcid))
+		funcid = get_opcode(opno);
+
+	for (i = 0; i < lengthof(fastQualFuncs); i++)
+	{
+		if (fastQualFuncs[i].funcid == funcid)
+			return &fastQualFuncs[i];
+	}
+	return NULL;
+}
+
+/*
+ * fq_scan_var
+ *		Return expr as a user column of the scan tuple, looking through
+ *		binary-compatible relabeling, or NULL if it is anything else.
+ */
+static Var *
+fq_scan_var(Expr *expr)
+{
+	Var		   *var;
+
+	while (IsA(expr, RelabelType))
+		expr = ((RelabelType *) expr)->arg;
+
+	if (!IsA(expr, Var))
+		return NULL;
+
+	var = (Var *) expr;
+	if (var->varattno <= 0 || var->varlevelsup != 0 ||
+		var->varno == INNER || var->varno == OUTER)
+		return NULL;
+
+	return var;
+}
+
+static FastQualClass
+fq_class(FastQualArg arg)
+{
+	switch (arg)
+	{
+		case FQA_INT2:
+		case FQA_INT4:
+		case FQA_INT8:
+			return FQC_INT;
+		case FQA_FLOAT4:
+		case FQA_FLOAT8:
+			return FQC_FLOAT;
+		case FQA_TEXT:
+		default:
+			return FQC_TEXT;
+	}
+}
+
+/*
+ * fq_decode
+ *		Decode a non-null datum into value.
+ *
+ * Text is pointed to in place, possibly after detoasting into a palloc'd
+ * copy; with copy set it is always copied into the current context.
+ */
+static void
+fq_decode(Datum d, FastQualArg arg, FastQualValue *value, bool copy)
+{
+	switch (arg)
+	{
+		case FQA_INT2:
+			value->ival = DatumGetInt16(d);
+			break;
+		case FQA_INT4:
+			value->ival = DatumGetInt32(d);
+			break;
+		case FQA_INT8:
+			value->ival = DatumGetInt64(d);
+			break;
+		case FQA_FLOAT4:
+			value->fval = DatumGetFloat4(d);
+			break;
+		case FQA_FLOAT8:
+			value->fval = DatumGetFloat8(d);
+			break;
+		case FQA_TEXT:
+			{
+				char	   *p;
+				int			len;
+				void	   *tofree;
+
+				varattrib_untoast_ptr_len(d, &p, &len, &tofree);
+				if (copy && tofree == NULL)
+				{
+					value->tval = palloc(Max(len, 1));
+					memcpy(value->tval, p, len);
+				}
+				else
+					value->tval = p;
+				value->tlen = len;
+			}
+			break;
+	}
+}
+
+/*
+ * fq_compare
+ *		Three-way comparison of two decoded values, following
+ *		float8_cmp_internal() for floats.  Text only compares for equality.
+ */
+static inline int
+fq_compare(FastQualClass cls, const FastQualValue *a, const FastQualValue *b)
+{
+	switch (cls)
+	{
+		case FQC_INT:
+			if (a->ival < b->ival)
+				return -1;
+			return (a->ival > b->ival) ? 1 : 0;
+
+		case FQC_FLOAT:
+			if (isnan(a->fval))
+				return isnan(b->fval) ? 0 : 1;
+			if (isnan(b->fval))
+				return -1;
+			if (a->fval < b->fval)
+				return -1;
+			return (a->fval > b->fval) ? 1 : 0;
+
+		case FQC_TEXT:
+		default:
+			if (a->tlen != b->tlen)
+				return 1;
+			return (memcmp(a->tval, b->tval, a->tlen) == 0) ? 0 : 1;
+	}
+}
+
+static int
+fq_compare_int(const void *a, const void *b)
+{
+	return fq_compare(FQC_INT, (const FastQualValue *) a,
+					  (const FastQualValue *) b);
+}
+
+static int
+fq_compare_float(const void *a, const void *b)
+{
+	return fq_compare(FQC_FLOAT, (const FastQualValue *) a,
+					  (const FastQualValue *) b);
+}
+
+/*
+ * fq_eval
+ *		Is the clause true for the tuple in slot?
+ */
+static bool
+fq_eval(FastQualNode *node, TupleTableSlot *slot)
+{
+	Datum		d;
+	bool		isnull;
+	int			i;
+
+	switch (node->kind)
+	{
+		case FQ_CMP:
+			d = slot_getattr(slot, node->attno, &isnull);
+			return !isnull && fq_eval_cmp(node, d);
+
+		case FQ_IN:
+			d = slot_getattr(slot, node->attno, &isnull);
+			return !isnull && fq_eval_in(node, d);
+
+		case FQ_ISNULL:
+			return slot_attisnull(slot, node->attno);
+
+		case FQ_NOTNULL:
+			return !slot_attisnull(slot, node->attno);
+
+		case FQ_AND:
+			for (i = 0; i < node->nargs; i++)
+			{
+				if (!fq_eval(node->args[i], slot))
+					return false;
+			}
+			return true;
+
+		case FQ_OR:
+			for (i = 0; i < node->nargs; i++)
+			{
+				if (fq_eval(node->args[i], slot))
+					return true;
+			}
+			return false;
+	}
+
+	Assert(false);
+	return false;
+}
+
+static bool
+fq_eval_cmp(FastQualNode *node, Datum d)
+{
+	FastQualValue value;
+	void	   *tofree = NULL;
+	int			cmp;
+
+	if (node->argtype == FQA_TEXT)
+	{
+		varattrib_untoast_ptr_len(d, &value.tval, &value.tlen, &tofree);
+		cmp = fq_compare(FQC_TEXT, &value, &node->value);
+		if (tofree != NULL)
+			pfree(tofree);
+	}
+	else
+	{
+		fq_decode(d, node->argtype, &value, false);
+		cmp = fq_compare(node->cls, &value, &node->value);
+	}
+
+	switch (node->op)
+	{
+		case FQOP_EQ: return cmp == 0;
+		case FQOP_NE: return cmp != 0;
+		case FQOP_LT: return cmp < 0;
+		case FQOP_LE: return cmp <= 0;
+		case FQOP_GT: return cmp > 0;
+		case FQOP_GE: return cmp >= 0;
+	}
+
+	Assert(false);
+	return false;
+}
+
+static bool
+fq_eval_in(FastQualNode *node, Datum d)
+{
+	FastQualValue value;
+	void	   *tofree = NULL;
+	bool		found = false;
+
+	if (node->argtype == FQA_TEXT)
+	{
+		int			i;
+
+		varattrib_untoast_ptr_len(d, &value.tval, &value.tlen, &tofree);
+		for (i = 0; i < node->nvalues && !found; i++)
+			found = (fq_compare(FQC_TEXT, &value, &node->values[i]) == 0);
+		if (tofree != NULL)
+			pfree(tofree);
+	}
+	else
+	{
+		int			lo = 0;
+		int			hi = node->nvalues - 1;
+
+		/* The values were sorted at compile time */
+		fq_decode(d, node->argtype, &value, false);
+		while (lo <= hi && !found)
+		{
+			int			mid = lo + (hi - lo) / 2;
+			int			cmp = fq_compare(node->cls, &value, &node->values[mid]);
+
+			if (cmp == 0)
+				found = true;
+			else if (cmp < 0)
+				hi = mid - 1;
+			else
+				lo = mid + 1;
+		}
+	}
+
+	return found;
+}
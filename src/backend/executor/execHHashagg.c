@@ -28,6 +28,7 @@
 #include "executor/execWorkfile.h"
 #include "storage/bfz.h"
 #include "utils/datum.h"
+#include "utils/fmgroids.h"
 #include "utils/memutils.h"
 #include "utils/lsyscache.h"
 #include "utils/elog.h"
@@ -44,6 +45,17 @@
 
 #define HHA_MSG_LVL DEBUG2
 
+/* Largest fraction of the slots of an open-addressing table in use. */
+#define HASHAGG_SLOT_FILL 0.75
+
+/*
+ * A streaming hashagg checks its reduction after this many input tuples
+ * of a fill, and whenever the table fills up.  Once passing tuples through,
+ * it emits them in runs of at most HASHAGG_PASSTHROUGH_RUN.
+ */
+#define HASHAGG_PASSTHROUGH_SAMPLE 10000
+#define HASHAGG_PASSTHROUGH_RUN 1024
+
 
 /* Encapture data related to a batch file. */
 struct BatchFileInfo
@@ -54,8 +66,10 @@ struct BatchFileInfo
 };
 
 #define BATCHFILE_METADATA \
-    (sizeof(BatchFileInfo) + sizeof(bfz_t) + sizeof(struct bfz_freeable_stuff))
-#define FREEABLE_BATCHFILE_METADATA (sizeof(struct bfz_freeable_stuff))
+    (sizeof(BatchFileInfo) + sizeof(bfz_t) + FREEABLE_BATCHFILE_METADATA)
+/* With async I/O, an open file also holds the block in flight */
+#define FREEABLE_BATCHFILE_METADATA \
+    (sizeof(struct bfz_freeable_stuff) + (gp_workfile_async_io ? BFZ_BUFFER_SIZE : 0))
 /*
  * Number of batchfile metadata to reserve during spilling in order to have
  * enough memory to open them at reuse.
@@ -120,6 +134,8 @@ static HashAggEntry *lookup_agg_hash_entry(AggState *aggstate, void *input_recor
 static void agg_hash_table_stat_upd(HashAggTable *ht);
 static void reset_agg_hash_table(AggState *aggstate);
 static bool agg_hash_reload(AggState *aggstate);
+static bool agg_hash_check_reduction(AggState *aggstate);
+static bool agg_hash_passthrough(AggState *aggstate);
 static inline void *mpool_cxt_alloc(void *manager, Size len);
 
 /* Methods for state file */
@@ -378,6 +394,85 @@ setGroupAggs(HashAggTable *hashtable, MemTupleBinding *mt_bind, HashAggEntry *en
 	}
 }
 
+/*
+ * Function: agg_hash_entry_matches
+ *
+ * Returns true if the grouping keys of the input record, of the type
+ * described at lookup_agg_hash_entry(), equal those of the entry.
+ * NULLs match in group keys.
+ */
+static inline bool
+agg_hash_entry_matches(AggState *aggstate, void *input_record,
+					   InputRecordType input_type, HashAggEntry *entry)
+{
+	HashAggTable *hashtable = aggstate->hhashtable;
+	MemTupleBinding *mt_bind = aggstate->hashslot->tts_mt_bind;
+	MemTuple mtup = (MemTuple) entry->tuple_and_aggs;
+	Agg *agg = (Agg*)aggstate->ss.ps.plan;
+	int i;
+
+	for (i = 0; i < agg->numCols; i++)
+	{
+		AttrNumber	att = agg->grpColIdx[i];
+		Datum input_datum = 0;
+		Datum entry_datum = 0;
+		bool input_isNull = false;
+		bool entry_isNull = false;
+
+		switch(input_type)
+		{
+			case INPUT_RECORD_TUPLE:
+				input_datum = slot_getattr((TupleTableSlot *)input_record, att, &input_isNull);
+				break;
+			case INPUT_RECORD_GROUP_AND_AGGS:
+				input_datum = memtuple_getattr((MemTuple)input_record, mt_bind, att, &input_isNull);
+				break;
+			default:
+				insist_log(false, "invalid record type %d", input_type);
+		}
+
+		entry_datum = memtuple_getattr(mtup, mt_bind, att, &entry_isNull);
+
+		if (!input_isNull && !entry_isNull)
+		{
+			if (hashtable->eq_byval[i] ?
+				input_datum != entry_datum :
+				!DatumGetBool(FunctionCall2(&aggstate->eqfunctions[i],
+											input_datum,
+											entry_datum)))
+				return false;
+		}
+		else if (input_isNull != entry_isNull)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Function: equality_is_datum_compare
+ *
+ * Is the given equality function, on a by-value type, the same as comparing
+ * the Datums?  True for the common integer-like grouping key types.
+ */
+static bool
+equality_is_datum_compare(Oid eqfn)
+{
+	switch (eqfn)
+	{
+		case F_BOOLEQ:
+		case F_CHAREQ:
+		case F_INT2EQ:
+		case F_INT4EQ:
+		case F_INT8EQ:
+		case F_OIDEQ:
+		case F_DATE_EQ:
+			return true;
+		default:
+			return false;
+	}
+}
+
 /*
  * Function: lookup_agg_hash_entry
  *
@@ -403,80 +498,72 @@ lookup_agg_hash_entry(AggState *aggstate,
 {
 	HashAggEntry *entry;
 	HashAggTable *hashtable = aggstate->hhashtable;
-	MemTupleBinding *mt_bind = aggstate->hashslot->tts_mt_bind;
 	ExprContext *tmpcontext = aggstate->tmpcontext; /* per input tuple context */
-	Agg *agg = (Agg*)aggstate->ss.ps.plan;
 	MemoryContext oldcxt;
 	unsigned int bucket_idx;
 	uint64 bloomval;			/* bloom filter value */
    
-	Assert(mt_bind != NULL);
+	Assert(aggstate->hashslot->tts_mt_bind != NULL);
 
 	if (p_isnew != NULL)
 		*p_isnew = false;
 
 	oldcxt = MemoryContextSwitchTo(tmpcontext->ecxt_per_tuple_memory);
-	bucket_idx = (hashkey >> parent_hash_bit) % (hashtable->nbuckets);
-	bloomval = ((uint64)1) << ((hashkey >> 23) & 0x3f);
-	entry = (0 == (hashtable->bloom[bucket_idx] & bloomval) ? NULL :
-			 hashtable->buckets[bucket_idx]);
 
-	/*
-	 * Search entry chain for the bucket. If such an entry found in the
-	 * chain, move it to the front of the chain. Otherwise, if there
-	 * are any space left, create a new entry, and insert it in
-	 * the front of the chain.
-	 */
-	while (entry != NULL)
+	if (hashtable->slots != NULL)
 	{
-		MemTuple mtup = (MemTuple) entry->tuple_and_aggs;
-		int i;
-		bool match = true;
+		/*
+		 * Probe the slots from the home slot of the hash key on, until the
+		 * matching entry or a free slot is found.  The table is never
+		 * allowed to fill up, so there always is a free slot.
+		 */
+		unsigned mask = hashtable->nbuckets - 1;
 
-		if (hashkey != entry->hashvalue)
+		entry = NULL;
+		bucket_idx = (hashkey >> parent_hash_bit) & mask;
+		bloomval = 0;
+		hashtable->slot_hash_bit = parent_hash_bit;
+		while (hashtable->slots[bucket_idx].entry != NULL)
 		{
-			entry = entry->next;
-			continue;
-		}
-		
-		for (i = 0; match && i < agg->numCols; i++)
-		{
-			AttrNumber	att = agg->grpColIdx[i];
-			Datum input_datum = 0;
-			Datum entry_datum = 0;
-			bool input_isNull = false;
-			bool entry_isNull = false;
-				
-			switch(input_type)
+			HashAggSlot *slot = &hashtable->slots[bucket_idx];
+
+			if (slot->hashvalue == hashkey &&
+				agg_hash_entry_matches(aggstate, input_record, input_type, slot->entry))
 			{
-				case INPUT_RECORD_TUPLE:
-					input_datum = slot_getattr((TupleTableSlot *)input_record, att, &input_isNull);
-					break;
-				case INPUT_RECORD_GROUP_AND_AGGS:
-					input_datum = memtuple_getattr((MemTuple)input_record, mt_bind, att, &input_isNull);
-					break;
-				default:
-					insist_log(false, "invalid record type %d", input_type);
+				entry = slot->entry;
+				break;
 			}
 
-			entry_datum = memtuple_getattr(mtup, mt_bind, att, &entry_isNull);
-
-			if ( !input_isNull && !entry_isNull &&
-				 (DatumGetBool(FunctionCall2(&aggstate->eqfunctions[i],
-											 input_datum,
-											 entry_datum)) ) )
-				continue; /* Both non-NULL and equal. */
-			match = (input_isNull && entry_isNull);/* NULLs match in group keys. */
+			bucket_idx = (bucket_idx + 1) & mask;
 		}
-		
-		/* Break if found an existing matching entry. */
-		if (match)
-			break;
+	}
+	else
+	{
+		bucket_idx = (hashkey >> parent_hash_bit) % (hashtable->nbuckets);
+		bloomval = ((uint64)1) << ((hashkey >> 23) & 0x3f);
+		entry = (0 == (hashtable->bloom[bucket_idx] & bloomval) ? NULL :
+				 hashtable->buckets[bucket_idx]);
 
-		entry = entry->next;
+		/*
+		 * Search entry chain for the bucket. If such an entry found in the
+		 * chain, move it to the front of the chain. Otherwise, if there
+		 * are any space left, create a new entry, and insert it in
+		 * the front of the chain.
+		 */
+		while (entry != NULL)
+		{
+			/* Break if found an existing matching entry. */
+			if (hashkey == entry->hashvalue &&
+				agg_hash_entry_matches(aggstate, input_record, input_type, entry))
+				break;
+
+			entry = entry->next;
+		}
 	}
 
-	if (entry == NULL)
+	/* An open-addressing table at its load limit has no room for a new entry. */
+	if (entry == NULL &&
+		(hashtable->slots == NULL || hashtable->nslots_used < hashtable->max_slots_used))
 	{
 		/* Create a new matching entry. */
 		switch(input_type)
@@ -493,9 +580,18 @@ lookup_agg_hash_entry(AggState *aggstate,
 			
 		if (entry != NULL)
 		{
-			entry->next = hashtable->buckets[bucket_idx];
-			hashtable->buckets[bucket_idx] = entry;
-			hashtable->bloom[bucket_idx] |= bloomval;
+			if (hashtable->slots != NULL)
+			{
+				hashtable->slots[bucket_idx].hashvalue = hashkey;
+				hashtable->slots[bucket_idx].entry = entry;
+				hashtable->nslots_used++;
+			}
+			else
+			{
+				entry->next = hashtable->buckets[bucket_idx];
+				hashtable->buckets[bucket_idx] = entry;
+				hashtable->bloom[bucket_idx] |= bloomval;
+			}
 			
 			hashtable->num_ht_groups++;
 
@@ -516,7 +612,9 @@ lookup_agg_hash_entry(AggState *aggstate,
  * Check if the current memory quota is enough to handle the aggregation
  * in the hash-based fashion.
  */
-#define OVERHEAD_PER_ENTRY ((double)sizeof(uint32))/gp_hashagg_groups_per_bucket
+#define OVERHEAD_PER_ENTRY (gp_hashagg_open_addressing ? \
+							((double)sizeof(HashAggSlot))/HASHAGG_SLOT_FILL : \
+							((double)sizeof(uint32))/gp_hashagg_groups_per_bucket)
 
 bool
 calcHashAggTableSizes(double memquota,	/* Memory quota in bytes. */
@@ -575,7 +673,14 @@ calcHashAggTableSizes(double memquota,	/* Memory quota in bytes. */
     /* Allocate at least a few hash entries regardless of memquota. */
     nentries = Max(nentries, gp_hashagg_groups_per_bucket);
 
-	nbuckets = ceil(nentries/gp_hashagg_groups_per_bucket);
+	/*
+	 * An open-addressing table has a slot per entry, and is kept partly
+	 * empty to keep the probe sequences short.
+	 */
+	if (gp_hashagg_open_addressing)
+		nbuckets = ceil(nentries/HASHAGG_SLOT_FILL);
+	else
+		nbuckets = ceil(nentries/gp_hashagg_groups_per_bucket);
 
 	/* Set nbuckets to the power of 2. */
 	nbuckets = (((unsigned)1) << ((unsigned)ceil(log(nbuckets) / log(2))));
@@ -745,8 +850,35 @@ create_agg_hash_table(AggState *aggstate)
 	/* Initialize the hash buckets */
 	hashtable->nbuckets = hashtable->hats.nbuckets;
 	hashtable->total_buckets = hashtable->nbuckets;
-	hashtable->buckets = (HashAggEntry **)palloc0(hashtable->nbuckets * sizeof(HashAggEntry *));
-	hashtable->bloom = (uint64 *)palloc0(hashtable->nbuckets * sizeof(uint64));
+	if (gp_hashagg_open_addressing)
+	{
+		hashtable->slots = (HashAggSlot *)palloc0(hashtable->nbuckets * sizeof(HashAggSlot));
+		hashtable->max_slots_used = (unsigned) (hashtable->nbuckets * HASHAGG_SLOT_FILL);
+		hashtable->nslots_used = 0;
+	}
+	else
+	{
+		hashtable->buckets = (HashAggEntry **)palloc0(hashtable->nbuckets * sizeof(HashAggEntry *));
+		hashtable->bloom = (uint64 *)palloc0(hashtable->nbuckets * sizeof(uint64));
+	}
+
+	/*
+	 * Grouping keys of by-value types whose equality operator is plain
+	 * Datum equality are compared without calling the operator.
+	 */
+	hashtable->eq_byval = (bool *)palloc0(Max(agg->numCols, 1) * sizeof(bool));
+	{
+		TupleDesc	inputDesc = ExecGetResultType(outerPlanState(aggstate));
+		int			i;
+
+		for (i = 0; i < agg->numCols; i++)
+		{
+			Form_pg_attribute attr = inputDesc->attrs[agg->grpColIdx[i] - 1];
+
+			hashtable->eq_byval[i] = attr->attbyval &&
+				equality_is_datum_compare(aggstate->eqfunctions[i].fn_oid);
+		}
+	}
 
 	MemoryContextSwitchTo(hashtable->entry_cxt);
 	
@@ -765,10 +897,15 @@ create_agg_hash_table(AggState *aggstate)
 	MemoryContextSwitchTo(oldcxt);
 
 	hashtable->max_mem = 1024.0 * operatorMemKB;
-	hashtable->mem_for_metadata = sizeof(HashAggTable)
-		+ hashtable->nbuckets * sizeof(HashAggEntry *)
-		+ hashtable->nbuckets * sizeof(uint64)
-		+ sizeof(GroupKeysAndAggs);
+	if (hashtable->slots != NULL)
+		hashtable->mem_for_metadata = sizeof(HashAggTable)
+			+ hashtable->nbuckets * sizeof(HashAggSlot)
+			+ sizeof(GroupKeysAndAggs);
+	else
+		hashtable->mem_for_metadata = sizeof(HashAggTable)
+			+ hashtable->nbuckets * sizeof(HashAggEntry *)
+			+ hashtable->nbuckets * sizeof(uint64)
+			+ sizeof(GroupKeysAndAggs);
 	hashtable->mem_wanted = hashtable->mem_for_metadata;
 	hashtable->mem_used = hashtable->mem_for_metadata;
 
@@ -842,6 +979,9 @@ agg_hash_initial_pass(AggState *aggstate)
 		return tuple_remaining;
 	}
 
+	if (hashtable->passthrough)
+		return agg_hash_passthrough(aggstate);
+
 	/*
 	 * Check if an input tuple has been read, but not processed
 	 * because of lack of space before streaming the results
@@ -921,6 +1061,7 @@ agg_hash_initial_pass(AggState *aggstate)
 			{
 				Assert(tuple_remaining);
 				hashtable->prev_slot = outerslot;
+				agg_hash_check_reduction(aggstate);
 				break;
 			}
 
@@ -949,11 +1090,25 @@ agg_hash_initial_pass(AggState *aggstate)
 		advance_aggregates(aggstate, hashtable->groupaggs->aggs, &(aggstate->mem_manager));
 		
 		hashtable->num_tuples++;
+		hashtable->num_fill_tuples++;
 
 		/* Reset per-input-tuple context after each tuple */
 		ResetExprContext(tmpcontext);
 
 		if (streaming && !HAVE_FREESPACE(hashtable))
+		{
+			Assert(tuple_remaining);
+			agg_hash_check_reduction(aggstate);
+			ExecClearTuple(aggstate->hashslot);
+			break;
+		}
+
+		/*
+		 * If hashing does not reduce the input, stream out what we have and
+		 * pass the rest of the input through.
+		 */
+		if (streaming && hashtable->num_fill_tuples == HASHAGG_PASSTHROUGH_SAMPLE &&
+			agg_hash_check_reduction(aggstate))
 		{
 			Assert(tuple_remaining);
 			ExecClearTuple(aggstate->hashslot);
@@ -997,6 +1152,120 @@ agg_hash_initial_pass(AggState *aggstate)
 	return tuple_remaining;
 }
 
+/* Function: agg_hash_check_reduction
+ *
+ * For a streaming hashagg, decide whether to give up hashing: true if the
+ * groups in the table exceed gp_hashagg_stream_passthrough_ratio of the
+ * input tuples that went into it.  Such a lower stage hardly reduces the
+ * rows sent to the upper stage, and hashing only costs time and memory.
+ */
+static bool
+agg_hash_check_reduction(AggState *aggstate)
+{
+	HashAggTable *hashtable = aggstate->hhashtable;
+
+	if (gp_hashagg_stream_passthrough_ratio <= 0 ||
+		hashtable->num_fill_tuples == 0)
+		return false;
+
+	if (hashtable->num_ht_groups <=
+		gp_hashagg_stream_passthrough_ratio * hashtable->num_fill_tuples)
+		return false;
+
+	hashtable->passthrough = true;
+
+	elog(HHA_MSG_LVL,
+		 "HashAgg: " INT64_FORMAT " groups from " INT64_FORMAT " tuples, passing the rest of the input through",
+		 hashtable->num_ht_groups, hashtable->num_fill_tuples);
+
+	return true;
+}
+
+/* Function: agg_hash_passthrough
+ *
+ * Take the place of agg_hash_initial_pass once a streaming hashagg passes
+ * its input through: turn each of the next input tuples into a group of its
+ * own, without looking it up in the hash table, and chain the groups for
+ * agg_hash_iter to return.
+ *
+ * Return true if there may be more input tuples (call me again), else
+ * false.
+ */
+static bool
+agg_hash_passthrough(AggState *aggstate)
+{
+	HashAggTable *hashtable = aggstate->hhashtable;
+	MemTupleBinding *mt_bind = aggstate->hashslot->tts_mt_bind;
+	ExprContext *tmpcontext = aggstate->tmpcontext;
+	HashAggEntry *last = NULL;
+	int ngroups = 0;
+
+	Assert(hashtable->num_ht_groups == 0);
+
+	hashtable->next_entry = NULL;
+	/* agg_hash_iter follows the chain, then finds the buckets exhausted. */
+	hashtable->curr_bucket_idx = hashtable->nbuckets - 1;
+
+	while (ngroups < HASHAGG_PASSTHROUGH_RUN)
+	{
+		TupleTableSlot *outerslot;
+		HashAggEntry *entry;
+		MemoryContext oldcxt;
+
+		if (hashtable->prev_slot != NULL)
+		{
+			outerslot = hashtable->prev_slot;
+			hashtable->prev_slot = NULL;
+		}
+		else
+			outerslot = ExecProcNode(outerPlanState(aggstate));
+
+		if (TupIsNull(outerslot))
+			return false;
+
+		Gpmon_M_Incr(GpmonPktFromAggState(aggstate), GPMON_QEXEC_M_ROWSIN);
+
+		tmpcontext->ecxt_scantuple = outerslot;
+
+		oldcxt = CurrentMemoryContext;
+		entry = makeHashAggEntryForInput(aggstate, outerslot, 0);
+		MemoryContextSwitchTo(oldcxt);
+
+		if (entry == NULL)
+		{
+			if (ngroups == 0)
+				ereport(ERROR,
+						(errcode(ERRCODE_GP_INTERNAL_ERROR),
+						 ERRMSG_GP_INSUFFICIENT_STATEMENT_MEMORY));
+
+			/* Out of space: emit the groups made so far first. */
+			hashtable->prev_slot = outerslot;
+			break;
+		}
+
+		setGroupAggs(hashtable, mt_bind, entry);
+		MemSet((char *)entry->tuple_and_aggs +
+			   MAXALIGN(memtuple_get_size((MemTuple)entry->tuple_and_aggs, mt_bind)), 0,
+			   aggstate->numaggs * sizeof(AggStatePerGroupData));
+		initialize_aggregates(aggstate, aggstate->peragg, hashtable->groupaggs->aggs,
+							  &(aggstate->mem_manager));
+		advance_aggregates(aggstate, hashtable->groupaggs->aggs, &(aggstate->mem_manager));
+
+		hashtable->num_tuples++;
+
+		ResetExprContext(tmpcontext);
+
+		if (last == NULL)
+			hashtable->next_entry = entry;
+		else
+			last->next = entry;
+		last = entry;
+		ngroups++;
+	}
+
+	return true;
+}
+
 /* Create a spill set for the given branching_factor (a power of two) 
  * and hash key range.
  *
@@ -1367,6 +1636,26 @@ read_spill_set(AggState *aggstate)
 	return spill_set;
 }
 
+/* Write one hash entry to the given spill file. */
+static inline void
+spill_hash_entry(AggState *aggstate, SpillFile *spill_file, HashAggEntry *spill_entry)
+{
+	HashAggTable *hashtable = aggstate->hhashtable;
+	int32 written_bytes;
+
+	written_bytes = writeHashEntry(aggstate, spill_file->file_info, spill_entry);
+	spill_file->file_info->ntuples++;
+	spill_file->file_info->total_bytes += written_bytes;
+
+	hashtable->num_spill_groups++;
+
+	Gpmon_M_Incr(GpmonPktFromAggState(aggstate), GPMON_AGG_SPILLTUPLE);
+	Gpmon_M_Add(GpmonPktFromAggState(aggstate), GPMON_AGG_SPILLBYTE, written_bytes);
+
+	Gpmon_M_Incr(GpmonPktFromAggState(aggstate), GPMON_AGG_CURRSPILLPASS_TUPLE);
+	Gpmon_M_Add(GpmonPktFromAggState(aggstate), GPMON_AGG_CURRSPILLPASS_BYTE, written_bytes);
+}
+
 /* Spill all entries from the hash table to file in order to make room
  * for new hash entries.
  *
@@ -1375,6 +1664,10 @@ read_spill_set(AggState *aggstate)
  * We simply write bucket 0, #batches, 2 * #batches, ... to the batch 0;
  * write bucket 1, (#batches + 1), (2 * #batches + 1), ... to the batch 1;
  * and etc.
+ *
+ * Entries of an open-addressing table may sit away from their home slot,
+ * so there the spill file is chosen from the hash value of each entry, in
+ * a single pass over the slots.
  */
 static void
 spill_hash_table(AggState *aggstate)
@@ -1433,6 +1726,9 @@ spill_hash_table(AggState *aggstate)
 			CheckSendPlanStateGpmonPkt(&aggstate->ss.ps);
 		}
 
+		if (hashtable->slots != NULL)
+			continue;
+
 		for (bucket_no = file_no; bucket_no < hashtable->nbuckets;
 			 bucket_no += spill_set->num_spill_files)
 		{
@@ -1448,25 +1744,30 @@ spill_hash_table(AggState *aggstate)
 				entry = spill_entry->next;
 
 				if (spill_entry != NULL)
-				{
-					int32 written_bytes;
-					
-					written_bytes = writeHashEntry(aggstate, spill_file->file_info, spill_entry);
-					spill_file->file_info->ntuples++;
-					spill_file->file_info->total_bytes += written_bytes;
+					spill_hash_entry(aggstate, spill_file, spill_entry);
+			}
 
-					hashtable->num_spill_groups++;
+			hashtable->buckets[bucket_no] = NULL;
+		}
+	}
 
-					Gpmon_M_Incr(GpmonPktFromAggState(aggstate), GPMON_AGG_SPILLTUPLE);
-					Gpmon_M_Add(GpmonPktFromAggState(aggstate), GPMON_AGG_SPILLBYTE, written_bytes);
+	if (hashtable->slots != NULL)
+	{
+		unsigned hash_bit = spill_set->spill_files[0].batch_hash_bit;
 
-					Gpmon_M_Incr(GpmonPktFromAggState(aggstate), GPMON_AGG_CURRSPILLPASS_TUPLE);
-					Gpmon_M_Add(GpmonPktFromAggState(aggstate), GPMON_AGG_CURRSPILLPASS_BYTE, written_bytes);
-				}
-			}
+		for (bucket_no = 0; bucket_no < hashtable->nbuckets; bucket_no++)
+		{
+			HashAggEntry *spill_entry = hashtable->slots[bucket_no].entry;
 
-			hashtable->buckets[bucket_no] = NULL;
+			if (spill_entry == NULL)
+				continue;
+
+			file_no = (spill_entry->hashvalue >> hash_bit) % spill_set->num_spill_files;
+			spill_hash_entry(aggstate, &spill_set->spill_files[file_no], spill_entry);
 		}
+
+		MemSet(hashtable->slots, 0, hashtable->nbuckets * sizeof(HashAggSlot));
+		hashtable->nslots_used = 0;
 	}
 
 	/* Reset the buffer */
@@ -1593,6 +1894,23 @@ agg_hash_table_stat_upd(HashAggTable *ht)
 
     char hostname[SEGMENT_IDENTITY_NAME_LENGTH];
     gethostname(hostname,SEGMENT_IDENTITY_NAME_LENGTH);
+    /* For an open-addressing table, record the probe length of each entry. */
+    if (ht->slots != NULL)
+    {
+        unsigned int    mask = ht->nbuckets - 1;
+
+        for (i = 0; i < ht->nbuckets; i++)
+        {
+            HashAggSlot    *slot = &ht->slots[i];
+
+            if (slot->entry != NULL)
+                cdbexplain_agg_upd(&ht->chainlength,
+                                   ((i - (slot->hashvalue >> ht->slot_hash_bit)) & mask) + 1,
+                                   i, hostname);
+        }
+        return;
+    }
+
     for (i = 0; i < ht->nbuckets; i++)
     {
         HashAggEntry   *entry = ht->buckets[i];
@@ -1613,7 +1931,7 @@ agg_hash_table_stat_upd(HashAggTable *ht)
  * Initialize the HashAggTable's (one and only) entry iterator. */
 void init_agg_hash_iter(HashAggTable* hashtable)
 {
-	Assert( hashtable != NULL && hashtable->buckets != NULL && hashtable->nbuckets > 0 );
+	Assert( hashtable != NULL && (hashtable->buckets != NULL || hashtable->slots != NULL) && hashtable->nbuckets > 0 );
 	
 	hashtable->curr_bucket_idx = -1;
 	hashtable->next_entry = NULL;
@@ -1636,7 +1954,7 @@ agg_hash_iter(AggState *aggstate)
 	SpillSet *spill_set = hashtable->spill_set;
 	MemoryContext oldcxt;
 
-	Assert( hashtable != NULL && hashtable->buckets != NULL && hashtable->nbuckets > 0 );
+	Assert( hashtable != NULL && (hashtable->buckets != NULL || hashtable->slots != NULL) && hashtable->nbuckets > 0 );
 
 	if (hashtable->curr_spill_file != NULL)
 		spill_set = hashtable->curr_spill_file->spill_set;
@@ -1646,7 +1964,10 @@ agg_hash_iter(AggState *aggstate)
 	while (entry == NULL &&
 		   hashtable->nbuckets > ++ hashtable->curr_bucket_idx)
 	{
-		entry = hashtable->buckets[hashtable->curr_bucket_idx];
+		if (hashtable->slots != NULL)
+			entry = hashtable->slots[hashtable->curr_bucket_idx].entry;
+		else
+			entry = hashtable->buckets[hashtable->curr_bucket_idx];
 		if (entry != NULL)
 		{
 			Assert(entry->is_primodial);
@@ -1733,7 +2054,17 @@ agg_hash_stream(AggState *aggstate)
 	elog(HHA_MSG_LVL,
 		"HashAgg: streaming");
 
-	reset_agg_hash_table(aggstate);
+	/*
+	 * Passed-through groups are never linked into the hash table, so only
+	 * their memory needs to be released.
+	 */
+	if (aggstate->hhashtable->passthrough && aggstate->hhashtable->num_ht_groups == 0)
+	{
+		CdbCellBuf_Reset(&(aggstate->hhashtable->entry_buf));
+		mpool_reset(aggstate->hhashtable->group_buf);
+	}
+	else
+		reset_agg_hash_table(aggstate);
 	
 	return agg_hash_initial_pass(aggstate);
 }
@@ -2148,8 +2479,9 @@ agg_hash_next_pass(AggState *aggstate)
         /* Hash chain statistics */
         if (hashtable->chainlength.vcnt > 0)
             appendStringInfo(hbuf,
-                             "Hash chain length %.1f avg, %.0f max,"
+                             "Hash %s length %.1f avg, %.0f max,"
                              " using %d of " INT64_FORMAT " buckets.\n",
+                             hashtable->slots != NULL ? "probe" : "chain",
                              cdbexplain_agg_avg(&hashtable->chainlength),
                              hashtable->chainlength.vmax,
                              hashtable->chainlength.vcnt,
@@ -2172,9 +2504,18 @@ void reset_agg_hash_table(AggState *aggstate)
 		"HashAgg: resetting " INT64_FORMAT "-entry hash table",
 		hashtable->num_ht_groups);
 	
-	MemSet(hashtable->buckets, 0, hashtable->nbuckets * sizeof(HashAggEntry*));
-	MemSet(hashtable->bloom, 0, hashtable->nbuckets * sizeof(uint64));
+	if (hashtable->slots != NULL)
+	{
+		MemSet(hashtable->slots, 0, hashtable->nbuckets * sizeof(HashAggSlot));
+		hashtable->nslots_used = 0;
+	}
+	else
+	{
+		MemSet(hashtable->buckets, 0, hashtable->nbuckets * sizeof(HashAggEntry*));
+		MemSet(hashtable->bloom, 0, hashtable->nbuckets * sizeof(uint64));
+	}
 	hashtable->num_ht_groups = 0;
+	hashtable->num_fill_tuples = 0;
 
 	CdbCellBuf_Reset(&(hashtable->entry_buf));
 	mpool_reset(hashtable->group_buf);
@@ -2211,8 +2552,14 @@ void destroy_agg_hash_table(AggState *aggstate)
 		reset_agg_hash_table(aggstate);
 
 		/* destroy_batches(aggstate->hhashtable); */
-		pfree(aggstate->hhashtable->buckets);
-		pfree(aggstate->hhashtable->bloom);
+		if (aggstate->hhashtable->slots != NULL)
+			pfree(aggstate->hhashtable->slots);
+		else
+		{
+			pfree(aggstate->hhashtable->buckets);
+			pfree(aggstate->hhashtable->bloom);
+		}
+		pfree(aggstate->hhashtable->eq_byval);
 		if (aggstate->hhashtable->hashkey_buf)
 			pfree(aggstate->hhashtable->hashkey_buf);
 
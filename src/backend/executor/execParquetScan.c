@@ -88,7 +88,8 @@ BeginScanParquetRelation(ScanState *scanState)
 			node->ss.ss_currentRelation,
 			node->ss.ps.state->es_snapshot,
 			NULL /* relationTupleDesc */,
-			node->opaque->proj);
+			node->opaque->proj,
+			scanState->ps.plan->qual);
 
 	node->opaque->scandesc->splits = scanState->splits;
 	node->ss.scan_state = SCAN_SCAN;
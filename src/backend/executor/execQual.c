@@ -5531,7 +5531,7 @@ ExecTargetList(List *targetlist,
 
 /*
  * ExecVariableList
- *		Evaluates a simple-Variable-list projection.
+ *		Evaluates the simple-Variable entries of a projection.
  *
  * Results are stored into the passed values and isnull arrays.
  */
@@ -5543,19 +5543,35 @@ ExecVariableList(ProjectionInfo *projInfo,
 	ExprContext *econtext = projInfo->pi_exprContext;
 	int		   *varSlotOffsets = projInfo->pi_varSlotOffsets;
 	int		   *varNumbers = projInfo->pi_varNumbers;
+	int		   *varOutputCols = projInfo->pi_varOutputCols;
 	int			i;
 
+	/*
+	 * Force extraction of all input values that we need, once per slot,
+	 * rather than attribute by attribute.
+	 */
+	if (projInfo->pi_lastInnerVar > 0)
+		slot_getsomeattrs(econtext->ecxt_innertuple,
+						  projInfo->pi_lastInnerVar);
+	if (projInfo->pi_lastOuterVar > 0)
+		slot_getsomeattrs(econtext->ecxt_outertuple,
+						  projInfo->pi_lastOuterVar);
+	if (projInfo->pi_lastScanVar > 0)
+		slot_getsomeattrs(econtext->ecxt_scantuple,
+						  projInfo->pi_lastScanVar);
+
 	/*
 	 * Assign to result by direct extraction of fields from source slots ... a
 	 * mite ugly, but fast ...
 	 */
-	for (i = list_length(projInfo->pi_targetlist) - 1; i >= 0; i--)
+	for (i = projInfo->pi_numSimpleVars - 1; i >= 0; i--)
 	{
 		char	   *slotptr = ((char *) econtext) + varSlotOffsets[i];
 		TupleTableSlot *varSlot = *((TupleTableSlot **) slotptr);
 		int			varNumber = varNumbers[i] - 1;
+		int			resind = varOutputCols[i];
 
-		values[i] = slot_getattr(varSlot, varNumber+1, &(isnull[i])); 
+		values[resind] = slot_getattr(varSlot, varNumber+1, &(isnull[resind])); 
 	}
 }
 
@@ -5609,7 +5625,11 @@ ExecProject(ProjectionInfo *projInfo, ExprDoneCond *isDone)
 	}
 	else
 	{
-		if (ExecTargetList(projInfo->pi_targetlist,
+		/* fetch the simple Vars directly, evaluate only the rest */
+		if (projInfo->pi_numSimpleVars > 0)
+			ExecVariableList(projInfo, slot_get_values(slot), slot_get_isnull(slot));
+
+		if (ExecTargetList(projInfo->pi_exprList,
 						   projInfo->pi_exprContext,
 						   slot_get_values(slot),
 						   slot_get_isnull(slot),
@@ -18,6 +18,7 @@
 #include "access/filesplit.h"
 #include "cdb/cdbvars.h"
 #include "executor/executor.h"
+#include "executor/nodeHash.h"
 #include "miscadmin.h"
 #include "utils/memutils.h"
 #include "utils/debugbreak.h"
@@ -95,18 +96,22 @@ ExecScan(ScanState *node,
 	ExprContext *econtext;
 	List	   *qual;
 	ProjectionInfo *projInfo;
+	FastQualProgram *fastQual = NULL;
+
+	HashJoinRuntimeFilter runtimeFilter;
 
 	/*
 	 * Fetch data from node
 	 */
 	qual = node->ps.qual;
 	projInfo = node->ps.ps_ProjInfo;
+	runtimeFilter = node->ss_runtimeFilter;
 
 	/*
 	 * If we have neither a qual to check nor a projection to do, just skip
 	 * all the overhead and return the raw scan tuple.
 	 */
-	if (!qual && !projInfo)
+	if (!qual && !projInfo && !runtimeFilter)
 		return (*accessMtd) (node);
 
 	/*
@@ -116,6 +121,22 @@ ExecScan(ScanState *node,
 	econtext = node->ps.ps_ExprContext;
     ResetExprContext(econtext);
 
+	/*
+	 * Compile the simple clauses of the qual on first use, so that they are
+	 * checked without going through the expression interpreter.
+	 */
+	if (qual && gp_enable_fast_qual)
+	{
+		if (node->ss_fastQualSource != qual)
+		{
+			/* the program lives and dies with the qual it was built from */
+			node->ss_fastQual = ExecBuildFastQual(qual,
+												  GetMemoryChunkContext(qual));
+			node->ss_fastQualSource = qual;
+		}
+		fastQual = node->ss_fastQual;
+	}
+
 	/*
 	 * get a tuple from the access method loop until we obtain a tuple which
 	 * passes the qualification.
@@ -154,7 +175,10 @@ ExecScan(ScanState *node,
 		 * when the qual is nil ... saves only a few cycles, but they add up
 		 * ...
 		 */
-		if (!qual || ExecQual(qual, econtext, false))
+		if ((!qual ||
+			 (fastQual ? ExecFastQual(fastQual, econtext) :
+			  ExecQual(qual, econtext, false))) &&
+			(!runtimeFilter || ExecHashRuntimeFilterCheck(runtimeFilter, econtext)))
 		{
 			/*
 			 * Found a satisfactory scan tuple.
@@ -177,7 +201,8 @@ ExecScan(ScanState *node,
 		}
 
 		/*
-		 * Tuple fails qual, so free per-tuple memory and try again.
+		 * Tuple fails qual, or can't join with the parent hash join's inner
+		 * side, so free per-tuple memory and try again.
 		 */
 		ResetExprContext(econtext);
 	}
@@ -96,6 +96,7 @@ DynamicTableScanInfo *dynamicTableScanInfo = NULL;
 static EState *InternalCreateExecutorState(MemoryContext qcontext,
 										   bool is_subquery);
 static void ShutdownExprContext(ExprContext *econtext);
+static bool ExecIsSimpleProjectionVar(Var *variable, TupleDesc inputDesc);
 
 
 /* ----------------------------------------------------------------
@@ -699,8 +700,15 @@ ExecBuildProjectionInfo(List *targetList,
 {
 	ProjectionInfo *projInfo = makeNode(ProjectionInfo);
 	int			len;
-	bool		isVarList;
+	int			numSimpleVars;
+	List	   *exprList;
 	ListCell   *tl;
+	int		   *varSlotOffsets;
+	int		   *varNumbers;
+	int		   *varOutputCols;
+	AttrNumber	lastInnerVar = 0;
+	AttrNumber	lastOuterVar = 0;
+	AttrNumber	lastScanVar = 0;
 
 	len = ExecTargetListLength(targetList);
 
@@ -709,110 +717,127 @@ ExecBuildProjectionInfo(List *targetList,
 	projInfo->pi_slot = slot;
 
 	/*
-	 * Determine whether the target list consists entirely of simple Var
-	 * references (ie, references to non-system attributes) that match the
-	 * input.  If so, we can use the simpler ExecVariableList instead of
-	 * ExecTargetList.  (Note: if there is a type mismatch then ExecEvalVar
-	 * will probably throw an error at runtime, but we leave that to it.)
+	 * Separate the simple Var references (ie, references to non-system
+	 * attributes) that match the input from the other entries.  The former
+	 * are fetched directly from their slots by ExecVariableList, so that
+	 * only the latter go through ExecTargetList.  If there are no other
+	 * entries we don't need ExecTargetList at all.  (Note: if there is a
+	 * type mismatch then ExecEvalVar will probably throw an error at
+	 * runtime, but we leave that to it.)
 	 */
-	isVarList = true;
+	numSimpleVars = 0;
+	exprList = NIL;
 	foreach(tl, targetList)
 	{
 		GenericExprState *gstate = (GenericExprState *) lfirst(tl);
-		Var		   *variable = (Var *) gstate->arg->expr;
-		Form_pg_attribute attr;
 
-		if (variable == NULL ||
-			!IsA(variable, Var) ||
-			variable->varattno <= 0)
-		{
-			isVarList = false;
-			break;
-		}
-		if (!inputDesc)
-			continue;			/* can't check type, assume OK */
-		if (variable->varattno > inputDesc->natts)
-		{
-			isVarList = false;
-			break;
-		}
-		attr = inputDesc->attrs[variable->varattno - 1];
-		if (attr->attisdropped || variable->vartype != attr->atttypid)
-		{
-			isVarList = false;
-			break;
-		}
+		if (ExecIsSimpleProjectionVar((Var *) gstate->arg->expr, inputDesc))
+			numSimpleVars++;
+		else
+			exprList = lappend(exprList, gstate);
 	}
-	projInfo->pi_isVarList = isVarList;
+	projInfo->pi_isVarList = (exprList == NIL);
+	projInfo->pi_numSimpleVars = numSimpleVars;
+	projInfo->pi_exprList = exprList;
 
-	if (isVarList)
+	if (exprList != NIL)
+		projInfo->pi_itemIsDone = (ExprDoneCond *)
+			palloc0(len * sizeof(ExprDoneCond));
+	else
+		projInfo->pi_itemIsDone = NULL; /* not needed */
+
+	if (numSimpleVars == 0)
 	{
-		int		   *varSlotOffsets;
-		int		   *varNumbers;
-		AttrNumber	lastInnerVar = 0;
-		AttrNumber	lastOuterVar = 0;
-		AttrNumber	lastScanVar = 0;
+		projInfo->pi_varSlotOffsets = NULL;
+		projInfo->pi_varNumbers = NULL;
+		projInfo->pi_varOutputCols = NULL;
+		return projInfo;
+	}
 
-		projInfo->pi_itemIsDone = NULL; /* not needed */
-		projInfo->pi_varSlotOffsets = varSlotOffsets = (int *)
-			palloc0(len * sizeof(int));
-		projInfo->pi_varNumbers = varNumbers = (int *)
-			palloc0(len * sizeof(int));
+	projInfo->pi_varSlotOffsets = varSlotOffsets = (int *)
+		palloc0(numSimpleVars * sizeof(int));
+	projInfo->pi_varNumbers = varNumbers = (int *)
+		palloc0(numSimpleVars * sizeof(int));
+	projInfo->pi_varOutputCols = varOutputCols = (int *)
+		palloc0(numSimpleVars * sizeof(int));
 
-		/*
-		 * Set up the data needed by ExecVariableList.	The slots in which the
-		 * variables can be found at runtime are denoted by the offsets of
-		 * their slot pointers within the econtext.  This rather grotty
-		 * representation is needed because the caller may not have given us
-		 * the real econtext yet (see hacks in nodeSubplan.c).
-		 */
-		foreach(tl, targetList)
-		{
-			GenericExprState *gstate = (GenericExprState *) lfirst(tl);
-			Var		   *variable = (Var *) gstate->arg->expr;
-			AttrNumber	attnum = variable->varattno;
-			TargetEntry *tle = (TargetEntry *) gstate->xprstate.expr;
-			AttrNumber	resind = tle->resno - 1;
+	/*
+	 * Set up the data needed by ExecVariableList.	The slots in which the
+	 * variables can be found at runtime are denoted by the offsets of
+	 * their slot pointers within the econtext.  This rather grotty
+	 * representation is needed because the caller may not have given us
+	 * the real econtext yet (see hacks in nodeSubplan.c).
+	 */
+	numSimpleVars = 0;
+	foreach(tl, targetList)
+	{
+		GenericExprState *gstate = (GenericExprState *) lfirst(tl);
+		Var		   *variable = (Var *) gstate->arg->expr;
+		TargetEntry *tle = (TargetEntry *) gstate->xprstate.expr;
+		AttrNumber	attnum;
+		AttrNumber	resind = tle->resno - 1;
 
-			Assert(resind >= 0 && resind < len);
-			varNumbers[resind] = attnum;
+		if (!ExecIsSimpleProjectionVar(variable, inputDesc))
+			continue;
 
-			switch (variable->varno)
-			{
-				case INNER:
-					varSlotOffsets[resind] = offsetof(ExprContext,
-													  ecxt_innertuple);
-					lastInnerVar = Max(lastInnerVar, attnum);
-					break;
+		attnum = variable->varattno;
+		Assert(resind >= 0 && resind < len);
+		varNumbers[numSimpleVars] = attnum;
+		varOutputCols[numSimpleVars] = resind;
 
-				case OUTER:
-					varSlotOffsets[resind] = offsetof(ExprContext,
-													  ecxt_outertuple);
-					lastOuterVar = Max(lastOuterVar, attnum);
-					break;
+		switch (variable->varno)
+		{
+			case INNER:
+				varSlotOffsets[numSimpleVars] = offsetof(ExprContext,
+														 ecxt_innertuple);
+				lastInnerVar = Max(lastInnerVar, attnum);
+				break;
 
-				default:
-					varSlotOffsets[resind] = offsetof(ExprContext,
-													  ecxt_scantuple);
-					lastScanVar = Max(lastScanVar, attnum);
-					break;
-			}
+			case OUTER:
+				varSlotOffsets[numSimpleVars] = offsetof(ExprContext,
+														 ecxt_outertuple);
+				lastOuterVar = Max(lastOuterVar, attnum);
+				break;
+
+			default:
+				varSlotOffsets[numSimpleVars] = offsetof(ExprContext,
+														 ecxt_scantuple);
+				lastScanVar = Max(lastScanVar, attnum);
+				break;
 		}
-		projInfo->pi_lastInnerVar = lastInnerVar;
-		projInfo->pi_lastOuterVar = lastOuterVar;
-		projInfo->pi_lastScanVar = lastScanVar;
-	}
-	else
-	{
-		projInfo->pi_itemIsDone = (ExprDoneCond *)
-			palloc0(len * sizeof(ExprDoneCond));
-		projInfo->pi_varSlotOffsets = NULL;
-		projInfo->pi_varNumbers = NULL;
+		numSimpleVars++;
 	}
+	projInfo->pi_lastInnerVar = lastInnerVar;
+	projInfo->pi_lastOuterVar = lastOuterVar;
+	projInfo->pi_lastScanVar = lastScanVar;
 
 	return projInfo;
 }
 
+/*
+ * ExecIsSimpleProjectionVar
+ *		Can this target list expression be fetched directly from its slot by
+ *		ExecVariableList?
+ */
+static bool
+ExecIsSimpleProjectionVar(Var *variable, TupleDesc inputDesc)
+{
+	Form_pg_attribute attr;
+
+	if (variable == NULL ||
+		!IsA(variable, Var) ||
+		variable->varattno <= 0)
+		return false;
+	if (!inputDesc)
+		return true;			/* can't check type, assume OK */
+	if (variable->varattno > inputDesc->natts)
+		return false;
+	attr = inputDesc->attrs[variable->varattno - 1];
+	if (attr->attisdropped || variable->vartype != attr->atttypid)
+		return false;
+	return true;
+}
+
 /* ----------------
  *		ExecAssignProjectionInfo
  *
@@ -191,6 +191,7 @@ initNextIndexToScan(DynamicIndexScanState *node)
 
 		ScanState *scanState = (ScanState *)node;
 
+		ExecResetFastQual(scanState);
 		MemoryContextReset(node->partitionMemoryContext);
 		MemoryContext oldCxt = MemoryContextSwitchTo(node->partitionMemoryContext);
 
@@ -163,6 +163,7 @@ initNextTableToScan(DynamicTableScanState *node)
 		if (attMap || node->firstPartition)
 		{
 			node->firstPartition = false;
+			ExecResetFastQual(scanState);
 			MemoryContextReset(node->partitionMemoryContext);
 			MemoryContext oldCxt = MemoryContextSwitchTo(node->partitionMemoryContext);
 
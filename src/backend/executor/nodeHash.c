@@ -34,6 +34,7 @@
 #include "executor/nodeHashjoin.h"
 #include "miscadmin.h"
 #include "parser/parse_expr.h"
+#include "utils/dynahash.h"
 #include "utils/memutils.h"
 #include "utils/lsyscache.h"
 #include "utils/debugbreak.h"
@@ -41,6 +42,7 @@
 
 #include "cdb/cdbexplain.h"
 #include "cdb/cdbvars.h"
+#include "cdb/workermgr.h"
 
 static void ExecHashIncreaseNumBatches(HashJoinTable hashtable);
 static void ExecHashTableExplainEnd(PlanState *planstate, struct StringInfoData *buf);
@@ -52,6 +54,19 @@ ExecHashTableExplainBatches(HashJoinTable   hashtable,
                             const char     *title);
 static void ExecHashTableReallocBatchData(HashJoinTable hashtable, int new_nbatch);
 static int ExecChoosePrimeNBuckets(int nbuckets);
+static void ExecHashChooseRadixPartitions(HashJoinTable hashtable, int tupwidth);
+static void *ExecHashChunkAlloc(HashJoinTable hashtable, int partno, Size size);
+static Size ExecHashDumpTuple(HashJoinTable hashtable, HashJoinTuple tuple, int batchno);
+static void ExecHashLinkPartitionRange(HashJoinTable hashtable, int firstpart, int endpart);
+static void ExecHashLinkTaskRun(Task task, struct WorkerMgrState *state);
+
+/* A set of radix partitions linked by one build thread */
+typedef struct HashLinkTask
+{
+	HashJoinTable hashtable;
+	int			firstpart;
+	int			endpart;		/* exclusive */
+} HashLinkTask;
 
 void ExecChooseHashTableSize(double ntuples, int tupwidth,
 						int *numbuckets,
@@ -61,6 +76,29 @@ void ExecChooseHashTableSize(double ntuples, int tupwidth,
 
 #define BLOOMVAL(hk)  (((uint64)1) << (((hk) >> 13) & 0x3f))
 
+/*
+ * A runtime filter gets RUNTIME_FILTER_BITS_PER_TUPLE bits per estimated
+ * inner tuple, within the min and max sizes.  One holding more than a tuple
+ * per RUNTIME_FILTER_MAX_FILL bits when built is not used, nor is one that
+ * dropped less than RUNTIME_FILTER_MIN_DROP of its first
+ * RUNTIME_FILTER_SAMPLE outer rows.
+ */
+#define RUNTIME_FILTER_MIN_BITS			(1 << 16)
+#define RUNTIME_FILTER_MAX_BITS			(1 << 26)
+#define RUNTIME_FILTER_BITS_PER_TUPLE	16
+#define RUNTIME_FILTER_MAX_FILL			8
+#define RUNTIME_FILTER_MEM_FRACTION		8	/* of the operator memory, at most */
+#define RUNTIME_FILTER_SAMPLE			10000
+#define RUNTIME_FILTER_MIN_DROP			0.05
+
+/* The two bits of a hash value, the second from its swapped halves. */
+#define RUNTIME_FILTER_BIT1(filter, hv)	((hv) & (filter)->nbits_mask)
+#define RUNTIME_FILTER_BIT2(filter, hv)	((((hv) >> 16) | ((hv) << 16)) & (filter)->nbits_mask)
+#define RUNTIME_FILTER_TEST(filter, bit) \
+	(((filter)->bits[(bit) >> 6] & (((uint64) 1) << ((bit) & 0x3f))) != 0)
+#define RUNTIME_FILTER_SET(filter, bit) \
+	((filter)->bits[(bit) >> 6] |= ((uint64) 1) << ((bit) & 0x3f))
+
 /* Amount of metadata memory required per batch */
 #define MD_MEM_PER_BATCH 	(sizeof(HashJoinBatchData *) + sizeof(HashJoinBatchData))
 
@@ -121,6 +159,9 @@ MultiExecHash(HashState *node)
             ""); // tableName
 #endif
 
+	if (node->hs_runtimeFilter != NULL)
+		ExecHashRuntimeFilterReset(node->hs_runtimeFilter);
+
 	/*
 	 * get all inner tuples and insert into the hash table (or temp files)
 	 */
@@ -139,6 +180,15 @@ MultiExecHash(HashState *node)
 		if (ExecHashGetHashValue(node, hashtable, econtext, hashkeys, node->hs_keepnull, &hashvalue, &hashkeys_null))
 		{
 			ExecHashTableInsert(node, hashtable, slot, hashvalue);
+
+			if (node->hs_runtimeFilter != NULL)
+			{
+				HashJoinRuntimeFilter filter = node->hs_runtimeFilter;
+
+				RUNTIME_FILTER_SET(filter, RUNTIME_FILTER_BIT1(filter, hashvalue));
+				RUNTIME_FILTER_SET(filter, RUNTIME_FILTER_BIT2(filter, hashvalue));
+				filter->ninserted++;
+			}
 		}
 
 		if (hashkeys_null)
@@ -156,6 +206,11 @@ MultiExecHash(HashState *node)
 	/* Now we have set up all the initial batches & primary overflow batches. */
 	hashtable->nbatch_outstart = hashtable->nbatch;
 
+	ExecHashTableLinkPartitions(hashtable);
+
+	if (node->hs_runtimeFilter != NULL)
+		ExecHashRuntimeFilterFinish(node->hs_runtimeFilter);
+
 	/* must provide our own instrumentation support */
 	if (node->ps.instrument)
 		InstrStopNode(node->ps.instrument, hashtable->totalTuples);
@@ -313,6 +368,9 @@ ExecHashTableCreate(HashState *hashState, HashJoinState *hjstate, List *hashOper
 	hashtable->work_set = NULL;
 	hashtable->state_file = NULL;
 	hashtable->spaceAllowed = operatorMemKB * 1024L;
+	/* The runtime filter's bits count against the memory of the table. */
+	if (hashState->hs_runtimeFilter != NULL)
+		hashtable->spaceAllowed -= (hashState->hs_runtimeFilter->nbits_mask + 1) / 8;
 	hashtable->stats = NULL;
 	hashtable->eagerlyReleased = false;
 	hashtable->hjstate = hjstate;
@@ -353,6 +411,9 @@ ExecHashTableCreate(HashState *hashState, HashJoinState *hjstate, List *hashOper
 	{
 		ExecChooseHashTableSize(outerNode->plan_rows, outerNode->plan_width,
 				&hashtable->nbuckets, &hashtable->nbatch, operatorMemKB);
+
+		if (gp_hashjoin_radix_partition != 0 || gp_hashjoin_build_threads > 1)
+			ExecHashChooseRadixPartitions(hashtable, outerNode->plan_width);
 	}
 
 	nbuckets = hashtable->nbuckets;
@@ -440,12 +501,112 @@ ExecHashTableCreate(HashState *hashState, HashJoinState *hjstate, List *hashOper
 	if(gp_hashjoin_bloomfilter!=0)
 		hashtable->bloom = (uint64*) palloc0(nbuckets * sizeof(uint64));
 
+	if (hashtable->radix_bits > 0)
+		hashtable->partchunks = (HashJoinChunk *)
+			palloc0((1 << hashtable->radix_bits) * sizeof(HashJoinChunk));
+
 	MemoryContextSwitchTo(oldcxt);
 	}
 	END_MEMORY_ACCOUNT();
 	return hashtable;
 }
 
+/*
+ * ExecHashChooseRadixPartitions
+ *		set up a radix-partitioned table, see hashjoin.h
+ *
+ * The number of buckets is rounded up to a power of 2, and the table is
+ * split into as many partitions as it takes for each to be about
+ * HJ_RADIX_PARTITION_BYTES.  A table that fits in that is left alone.
+ */
+static void
+ExecHashChooseRadixPartitions(HashJoinTable hashtable, int tupwidth)
+{
+	int			bucket_bits = my_log2(hashtable->nbuckets);
+	double		table_bytes;
+	int			radix_bits;
+
+	/* Expected size of the in-memory table, at the planned bucket load. */
+	table_bytes = (double) hashtable->nbuckets *
+		(gp_hashjoin_tuples_per_bucket * ExecHashRowSize(tupwidth) + MD_MEM_PER_BUCKET);
+	table_bytes = Min(table_bytes, (double) hashtable->spaceAllowed);
+
+	radix_bits = 0;
+	while (radix_bits < HJ_RADIX_MAX_BITS &&
+		   radix_bits < bucket_bits &&
+		   table_bytes / (1 << radix_bits) > HJ_RADIX_PARTITION_BYTES)
+		radix_bits++;
+
+	if (radix_bits == 0)
+		return;
+
+	hashtable->nbuckets = 1 << bucket_bits;
+	hashtable->radix_bits = radix_bits;
+	hashtable->radix_shift = bucket_bits - radix_bits;
+
+	/* The outer buffer is taken out of the memory for the table. */
+	hashtable->radix_outer_bytes = Min(HJ_RADIX_OUTER_BUFFER_BYTES,
+									   hashtable->spaceAllowed / 4);
+	hashtable->spaceAllowed -= hashtable->radix_outer_bytes;
+	hashtable->linkDeferred = (gp_hashjoin_build_threads > 1);
+
+#ifdef HJDEBUG
+	elog(LOG, "HJ: nbuckets = %d, %d radix partitions", hashtable->nbuckets, 1 << radix_bits);
+#endif
+}
+
+/*
+ * ExecHashChunkAlloc
+ *		allocate space for a hash tuple in the chunks of a radix partition
+ *
+ * Tuples too big to share a chunk get one of their own, linked behind the
+ * chunk being filled.
+ */
+static void *
+ExecHashChunkAlloc(HashJoinTable hashtable, int partno, Size size)
+{
+	HashJoinChunk chunk = hashtable->partchunks[partno];
+	char	   *ptr;
+
+	size = MAXALIGN(size);
+
+	if (size > HJ_CHUNK_SIZE / 4)
+	{
+		HashJoinChunk bigchunk;
+
+		bigchunk = (HashJoinChunk) MemoryContextAlloc(hashtable->batchCxt,
+													  HJ_CHUNK_HEADER_SIZE + size);
+		bigchunk->maxlen = size;
+		bigchunk->used = size;
+		if (chunk != NULL)
+		{
+			bigchunk->next = chunk->next;
+			chunk->next = bigchunk;
+		}
+		else
+		{
+			bigchunk->next = NULL;
+			hashtable->partchunks[partno] = bigchunk;
+		}
+		return HJ_CHUNK_DATA(bigchunk);
+	}
+
+	if (chunk == NULL || chunk->maxlen - chunk->used < size)
+	{
+		chunk = (HashJoinChunk) MemoryContextAlloc(hashtable->batchCxt,
+												   HJ_CHUNK_HEADER_SIZE + HJ_CHUNK_SIZE);
+		chunk->maxlen = HJ_CHUNK_SIZE;
+		chunk->used = 0;
+		chunk->next = hashtable->partchunks[partno];
+		hashtable->partchunks[partno] = chunk;
+	}
+
+	ptr = HJ_CHUNK_DATA(chunk) + chunk->used;
+	chunk->used += size;
+
+	return ptr;
+}
+
 
 /*
  * Compute appropriate size for hashtable given the estimated size of the
@@ -707,6 +868,8 @@ ExecHashTableDestroy(HashState *hashState, HashJoinTable hashtable)
 	/* Release working memory (batchCxt is a child, so it goes away too) */
 	MemoryContextDelete(hashtable->hashCxt);
 	hashtable->batches = NULL;
+	hashtable->partchunks = NULL;
+	hashtable->outerBuffer = NULL;
 	}
 	END_MEMORY_ACCOUNT();
 }
@@ -770,7 +933,75 @@ ExecHashIncreaseNumBatches(HashJoinTable hashtable)
 	 */
 	ninmemory = nfreed = 0;
 
-	for (i = 0; i < hashtable->nbuckets; i++)
+	if (hashtable->radix_bits > 0)
+	{
+		int			npartitions = 1 << hashtable->radix_bits;
+		int			partno;
+
+		/*
+		 * The tuples are packed in chunks, so copy the ones we keep into
+		 * fresh chunks of their partition, relink the buckets, and free the
+		 * old chunks.
+		 */
+		MemSet(hashtable->buckets, 0, hashtable->nbuckets * sizeof(HashJoinTuple));
+		if (gp_hashjoin_bloomfilter != 0)
+			MemSet(hashtable->bloom, 0, hashtable->nbuckets * sizeof(uint64));
+
+		for (partno = 0; partno < npartitions; partno++)
+		{
+			HashJoinChunk chunk = hashtable->partchunks[partno];
+
+			hashtable->partchunks[partno] = NULL;
+
+			while (chunk != NULL)
+			{
+				HashJoinChunk nextchunk = chunk->next;
+				Size		offset = 0;
+
+				while (offset < chunk->used)
+				{
+					HashJoinTuple tuple = (HashJoinTuple) (HJ_CHUNK_DATA(chunk) + offset);
+					Size		hashTupleSize;
+					int			bucketno;
+					int			batchno;
+
+					hashTupleSize = HJTUPLE_OVERHEAD +
+						memtuple_get_size(HJTUPLE_MINTUPLE(tuple), NULL);
+					offset += MAXALIGN(hashTupleSize);
+
+					ninmemory++;
+					ExecHashGetBucketAndBatch(hashtable, tuple->hashvalue,
+							&bucketno, &batchno);
+					Assert(HJ_RADIX_PARTITION(hashtable, bucketno) == partno);
+					if (batchno == curbatch)
+					{
+						HashJoinTuple copyTuple;
+
+						copyTuple = (HashJoinTuple) ExecHashChunkAlloc(hashtable, partno,
+																	   hashTupleSize);
+						memcpy(copyTuple, tuple, hashTupleSize);
+						if (!hashtable->linkDeferred)
+						{
+							copyTuple->next = hashtable->buckets[bucketno];
+							hashtable->buckets[bucketno] = copyTuple;
+							if (gp_hashjoin_bloomfilter != 0)
+								hashtable->bloom[bucketno] |= BLOOMVAL(tuple->hashvalue);
+						}
+					}
+					else
+					{
+						spaceFreed += ExecHashDumpTuple(hashtable, tuple, batchno);
+						nfreed++;
+					}
+				}
+
+				pfree(chunk);
+				chunk = nextchunk;
+			}
+		}
+	}
+
+	for (i = 0; hashtable->radix_bits == 0 && i < hashtable->nbuckets; i++)
 	{
 		HashJoinTuple prevtuple;
 		HashJoinTuple tuple;
@@ -798,16 +1029,8 @@ ExecHashIncreaseNumBatches(HashJoinTable hashtable)
 			}
 			else
 			{
-				Size    spaceTuple;
-
 				/* dump it out */
-				Assert(batchno > curbatch);
-				Assert(batchno >= hashtable->hjstate->nbatch_loaded_state);
-				ExecHashJoinSaveTuple(NULL, HJTUPLE_MINTUPLE(tuple),
-						tuple->hashvalue,
-						hashtable,
-						&hashtable->batches[batchno]->innerside,
-						hashtable->bfCxt);
+				spaceFreed += ExecHashDumpTuple(hashtable, tuple, batchno);
 				/* and remove from hash table */
 				if (prevtuple)
 					prevtuple->next = nexttuple;
@@ -815,13 +1038,6 @@ ExecHashIncreaseNumBatches(HashJoinTable hashtable)
 					hashtable->buckets[i] = nexttuple;
 				/* prevtuple doesn't change */
 
-				hashtable->totalTuples--;
-
-				spaceTuple = HJTUPLE_OVERHEAD + memtuple_get_size(HJTUPLE_MINTUPLE(tuple), NULL); 
-				spaceFreed += spaceTuple;
-				if (stats)
-					stats->batchstats[batchno].spillspace_in += spaceTuple;
-
 				pfree(tuple);
 				nfreed++;
 			}
@@ -871,6 +1087,145 @@ ExecHashIncreaseNumBatches(HashJoinTable hashtable)
 
 }
 
+/*
+ * ExecHashTableLinkPartitions
+ *		link the tuples of a table built with linkDeferred into their buckets
+ *
+ * Called when a batch has been loaded.  The partitions are divided among
+ * up to gp_hashjoin_build_threads worker threads; they have disjoint bucket
+ * ranges and chunk lists, so the threads need no locks.  Small tables, or a
+ * failure to start the threads, link in this process.
+ */
+void
+ExecHashTableLinkPartitions(HashJoinTable hashtable)
+{
+	int			npartitions;
+	int			nthreads;
+	bool		linked = false;
+
+	if (!hashtable->linkDeferred)
+		return;
+
+	npartitions = 1 << hashtable->radix_bits;
+	nthreads = Min(gp_hashjoin_build_threads, npartitions);
+
+	if (nthreads > 1 && hashtable->totalTuples >= HJ_BUILD_THREAD_MIN_TUPLES)
+	{
+		struct WorkerMgrState *state;
+		List	   *tasks = NIL;
+		int			i;
+
+		for (i = 0; i < nthreads; i++)
+		{
+			HashLinkTask *task = (HashLinkTask *) palloc(sizeof(HashLinkTask));
+
+			task->hashtable = hashtable;
+			task->firstpart = (int) ((int64) npartitions * i / nthreads);
+			task->endpart = (int) ((int64) npartitions * (i + 1) / nthreads);
+			tasks = lappend(tasks, task);
+		}
+
+		state = workermgr_create_workermgr_state(nthreads);
+		if (workermgr_submit_job(state, tasks, ExecHashLinkTaskRun))
+		{
+			workermgr_wait_job(state);
+			linked = true;
+		}
+		else
+			elog(LOG, "HJ: could not start %d build threads, linking serially", nthreads);
+
+		workermgr_free_workermgr_state(state);
+		list_free_deep(tasks);
+	}
+
+	/* Linking a range starts by clearing its buckets, so this is safe to redo. */
+	if (!linked)
+		ExecHashLinkPartitionRange(hashtable, 0, npartitions);
+}
+
+static void
+ExecHashLinkTaskRun(Task task, struct WorkerMgrState *state)
+{
+	HashLinkTask *linkTask = (HashLinkTask *) task;
+
+	ExecHashLinkPartitionRange(linkTask->hashtable, linkTask->firstpart, linkTask->endpart);
+}
+
+/*
+ * ExecHashLinkPartitionRange
+ *		link the tuples of partitions firstpart .. endpart-1 into their buckets
+ *
+ * Runs in a worker thread: it must not palloc, elog or otherwise use
+ * backend state, and touches only the buckets and chunks of its partitions.
+ */
+static void
+ExecHashLinkPartitionRange(HashJoinTable hashtable, int firstpart, int endpart)
+{
+	int			firstbucket = firstpart << hashtable->radix_shift;
+	int			endbucket = endpart << hashtable->radix_shift;
+	int			partno;
+
+	memset(&hashtable->buckets[firstbucket], 0,
+		   (endbucket - firstbucket) * sizeof(HashJoinTuple));
+	if (gp_hashjoin_bloomfilter != 0)
+		memset(&hashtable->bloom[firstbucket], 0,
+			   (endbucket - firstbucket) * sizeof(uint64));
+
+	for (partno = firstpart; partno < endpart; partno++)
+	{
+		HashJoinChunk chunk;
+
+		for (chunk = hashtable->partchunks[partno]; chunk != NULL; chunk = chunk->next)
+		{
+			Size		offset = 0;
+
+			while (offset < chunk->used)
+			{
+				HashJoinTuple tuple = (HashJoinTuple) (HJ_CHUNK_DATA(chunk) + offset);
+				int			bucketno = ExecHashGetRadixBucket(hashtable, tuple->hashvalue);
+
+				offset += MAXALIGN(HJTUPLE_OVERHEAD +
+								   memtuple_get_size(HJTUPLE_MINTUPLE(tuple), NULL));
+
+				tuple->next = hashtable->buckets[bucketno];
+				hashtable->buckets[bucketno] = tuple;
+				if (gp_hashjoin_bloomfilter != 0)
+					hashtable->bloom[bucketno] |= BLOOMVAL(tuple->hashvalue);
+			}
+		}
+	}
+}
+
+/*
+ * ExecHashDumpTuple
+ *		write a tuple of the hash table out to the inner file of a later
+ *		batch; returns the space it took in the table
+ *
+ * The caller unlinks the tuple from its bucket and frees it.
+ */
+static Size
+ExecHashDumpTuple(HashJoinTable hashtable, HashJoinTuple tuple, int batchno)
+{
+	HashJoinTableStats *stats = hashtable->stats;
+	Size		spaceTuple;
+
+	Assert(batchno > hashtable->curbatch);
+	Assert(batchno >= hashtable->hjstate->nbatch_loaded_state);
+	ExecHashJoinSaveTuple(NULL, HJTUPLE_MINTUPLE(tuple),
+			tuple->hashvalue,
+			hashtable,
+			&hashtable->batches[batchno]->innerside,
+			hashtable->bfCxt);
+
+	hashtable->totalTuples--;
+
+	spaceTuple = HJTUPLE_OVERHEAD + memtuple_get_size(HJTUPLE_MINTUPLE(tuple), NULL);
+	if (stats)
+		stats->batchstats[batchno].spillspace_in += spaceTuple;
+
+	return spaceTuple;
+}
+
 /*
  * Re-allocate the batch data array when the number of batches increases
  */
@@ -963,16 +1318,24 @@ ExecHashTableInsert(HashState *hashState, HashJoinTable hashtable,
 		 */
 		HashJoinTuple hashTuple;
 
-		hashTuple = (HashJoinTuple) MemoryContextAlloc(hashtable->batchCxt,
-				hashTupleSize);
+		if (hashtable->radix_bits > 0)
+			hashTuple = (HashJoinTuple) ExecHashChunkAlloc(hashtable,
+					HJ_RADIX_PARTITION(hashtable, bucketno), hashTupleSize);
+		else
+			hashTuple = (HashJoinTuple) MemoryContextAlloc(hashtable->batchCxt,
+					hashTupleSize);
 		hashTuple->hashvalue = hashvalue;
 		memcpy(HJTUPLE_MINTUPLE(hashTuple), tuple, memtuple_get_size(tuple, NULL)); 
-		hashTuple->next = hashtable->buckets[bucketno];
-		hashtable->buckets[bucketno] = hashTuple;
 		hashtable->totalTuples += 1;
 
-		if(gp_hashjoin_bloomfilter!=0)
-			hashtable->bloom[bucketno] |= BLOOMVAL(hashvalue);
+		if (!hashtable->linkDeferred)
+		{
+			hashTuple->next = hashtable->buckets[bucketno];
+			hashtable->buckets[bucketno] = hashTuple;
+
+			if(gp_hashjoin_bloomfilter!=0)
+				hashtable->bloom[bucketno] |= BLOOMVAL(hashvalue);
+		}
 
 		/* Double the number of batches when too much data in hash table. */
 		if (batch->innerspace > hashtable->spaceAllowed ||
@@ -1113,6 +1476,167 @@ ExecHashGetHashValue(HashState *hashState, HashJoinTable hashtable,
 	return result;
 }
 
+/*
+ * ExecHashRuntimeFilterCreate
+ *		Set up an empty runtime filter for a hash join.
+ *
+ * hashkeys are the ExprStates of the outer join keys, set up to be evaluated
+ * by the scan the filter is pushed down to; ntuples is the estimated number
+ * of inner tuples.  The bits take at most 1/RUNTIME_FILTER_MEM_FRACTION of
+ * the hash table's operatorMemKB, and ExecHashTableCreate() takes them out
+ * of the memory for the table.
+ */
+HashJoinRuntimeFilter
+ExecHashRuntimeFilterCreate(List *hashOperators, List *hashkeys, double ntuples,
+							uint64 operatorMemKB)
+{
+	HashJoinRuntimeFilter filter;
+	uint32		nbits;
+	double		maxbits;
+	ListCell   *ho;
+	int			nkeys;
+	int			i;
+
+	filter = (HashJoinRuntimeFilter) palloc0(sizeof(HashJoinRuntimeFilterData));
+
+	maxbits = (double) operatorMemKB * 1024.0 * 8 / RUNTIME_FILTER_MEM_FRACTION;
+	nbits = RUNTIME_FILTER_MIN_BITS;
+	while (nbits < RUNTIME_FILTER_MAX_BITS &&
+		   (double) (nbits << 1) <= maxbits &&
+		   nbits < ntuples * RUNTIME_FILTER_BITS_PER_TUPLE)
+		nbits <<= 1;
+
+	filter->bits = (uint64 *) palloc0(nbits / 8);
+	filter->nbits_mask = nbits - 1;
+	filter->hashkeys = hashkeys;
+
+	/* The same hash functions as ExecHashTableCreate() looks up. */
+	nkeys = list_length(hashOperators);
+	filter->hashfunctions = (FmgrInfo *) palloc(nkeys * sizeof(FmgrInfo));
+	filter->hashStrict = (bool *) palloc(nkeys * sizeof(bool));
+	i = 0;
+	foreach(ho, hashOperators)
+	{
+		Oid			hashop = lfirst_oid(ho);
+		Oid			hashfn;
+
+		hashfn = get_op_hash_function(hashop);
+		if (!OidIsValid(hashfn))
+			elog(ERROR, "could not find hash function for hash operator %u",
+				 hashop);
+		fmgr_info(hashfn, &filter->hashfunctions[i]);
+		filter->hashStrict[i] = op_strict(hashop);
+		i++;
+	}
+
+	return filter;
+}
+
+/*
+ * ExecHashRuntimeFilterReset
+ *		Empty a runtime filter before the hash table is (re)built.
+ */
+void
+ExecHashRuntimeFilterReset(HashJoinRuntimeFilter filter)
+{
+	filter->ready = false;
+	filter->ninserted = 0;
+	MemSet(filter->bits, 0, (filter->nbits_mask + 1) / 8);
+}
+
+/*
+ * ExecHashRuntimeFilterFinish
+ *		Let the scan use a runtime filter once all inner tuples are in,
+ *		unless it is too full to drop many rows.
+ */
+void
+ExecHashRuntimeFilterFinish(HashJoinRuntimeFilter filter)
+{
+	if (filter->disabled)
+		return;
+
+	if (filter->ninserted * RUNTIME_FILTER_MAX_FILL > (double) filter->nbits_mask + 1)
+	{
+		elog(DEBUG1, "HashJoin runtime filter of %u bits not used for %.0f inner tuples",
+			 filter->nbits_mask + 1, filter->ninserted);
+		return;
+	}
+
+	filter->ready = true;
+}
+
+/*
+ * ExecHashRuntimeFilterCheck
+ *		Can the scan tuple in econtext join with any inner tuple?
+ *
+ * Computes the hash value of the outer keys like ExecHashGetHashValue(),
+ * without resetting the scan's per-tuple memory.  Returns true if the
+ * filter is not ready.
+ */
+bool
+ExecHashRuntimeFilterCheck(HashJoinRuntimeFilter filter, ExprContext *econtext)
+{
+	uint32		hashkey = 0;
+	ListCell   *hk;
+	int			i = 0;
+	MemoryContext oldContext;
+	bool		result = true;
+
+	if (!filter->ready)
+		return true;
+
+	oldContext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	foreach(hk, filter->hashkeys)
+	{
+		ExprState  *keyexpr = (ExprState *) lfirst(hk);
+		Datum		keyval;
+		bool		isNull = false;
+
+		/* rotate hashkey left 1 bit at each step */
+		hashkey = (hashkey << 1) | ((hashkey & 0x80000000) ? 1 : 0);
+
+		keyval = ExecEvalExpr(keyexpr, econtext, &isNull, NULL);
+
+		if (isNull)
+		{
+			/* a strict join operator can't match a NULL */
+			if (filter->hashStrict[i])
+			{
+				result = false;
+				break;
+			}
+		}
+		else
+			hashkey ^= DatumGetUInt32(FunctionCall1(&filter->hashfunctions[i],
+													keyval));
+		i++;
+	}
+
+	MemoryContextSwitchTo(oldContext);
+
+	if (result)
+		result = RUNTIME_FILTER_TEST(filter, RUNTIME_FILTER_BIT1(filter, hashkey)) &&
+			RUNTIME_FILTER_TEST(filter, RUNTIME_FILTER_BIT2(filter, hashkey));
+
+	filter->nchecked++;
+	if (!result)
+		filter->ndropped++;
+
+	/* Give up on a filter that lets almost everything through. */
+	if (filter->nchecked == RUNTIME_FILTER_SAMPLE &&
+		filter->ndropped < filter->nchecked * RUNTIME_FILTER_MIN_DROP)
+	{
+		elog(DEBUG1, "HashJoin runtime filter dropped " UINT64_FORMAT " of "
+			 UINT64_FORMAT " rows, not checking it any more",
+			 filter->ndropped, filter->nchecked);
+		filter->ready = false;
+		filter->disabled = true;
+	}
+
+	return result;
+}
+
 /*
  * ExecHashGetBucketAndBatch
  *		Determine the bucket number and batch number for a hash value
@@ -1127,7 +1651,9 @@ ExecHashGetHashValue(HashState *hashState, HashJoinTable hashtable,
  * of some rather poorly-implemented hash functions in hashfunc.c.  (This
  * will change in PG 8.3.)
  *
- * nbuckets doesn't change over the course of the join.
+ * nbuckets doesn't change over the course of the join.  When the table is
+ * radix-partitioned, nbuckets is a power of 2 and the bucket number comes
+ * from ExecHashGetRadixBucket(); its top bits pick the partition.
  *
  * nbatch is always a power of 2; we increase it only by doubling it.  This
  * effectively adds one more bit to the top of the batchno.
@@ -1141,17 +1667,35 @@ ExecHashGetBucketAndBatch(HashJoinTable hashtable,
 	uint32		nbuckets = (uint32) hashtable->nbuckets;
 	uint32		nbatch = (uint32) hashtable->nbatch;
 
+	if (hashtable->radix_bits > 0)
+		*bucketno = ExecHashGetRadixBucket(hashtable, hashvalue);
+	else
+		*bucketno = hashvalue % nbuckets;
+
 	if (nbatch > 1)
 	{
-		*bucketno = hashvalue % nbuckets;
 		/* since nbatch is a power of 2, can do MOD by masking */
 		*batchno = hash_uint32(hashvalue) & (nbatch - 1);
 	}
 	else
-	{
-		*bucketno = hashvalue % nbuckets;
 		*batchno = 0;
-	}
+}
+
+/*
+ * ExecHashGetRadixBucket
+ *		bucket number of a hash value in a radix-partitioned table
+ *
+ * The value is rehashed with a seed of its own, so the partition, the
+ * bucket and the batch number are independent of each other even for weak
+ * hash functions.  Safe to call from the build threads.
+ */
+int
+ExecHashGetRadixBucket(HashJoinTable hashtable, uint32 hashvalue)
+{
+	uint32		mixed = DatumGetUInt32(hash_uint32(hashvalue ^ HJ_RADIX_HASH_SEED));
+
+	Assert(hashtable->radix_bits > 0);
+	return (int) (mixed & ((uint32) hashtable->nbuckets - 1));
 }
 
 /*
@@ -1248,6 +1792,10 @@ ExecHashTableReset(HashState *hashState, HashJoinTable hashtable)
 	if(gp_hashjoin_bloomfilter != 0)
 		hashtable->bloom = (uint64*) palloc0(nbuckets * sizeof(uint64));
 
+	if (hashtable->radix_bits > 0)
+		hashtable->partchunks = (HashJoinChunk *)
+			palloc0((1 << hashtable->radix_bits) * sizeof(HashJoinChunk));
+
 	hashtable->batches[hashtable->curbatch]->innerspace = 0;
 	hashtable->batches[hashtable->curbatch]->innertuples = 0;
 	hashtable->totalTuples = 0;
@@ -1436,6 +1984,10 @@ ExecHashTableExplainEnd(PlanState *planstate, struct StringInfoData *buf)
                              hashtable->nbatch - stats->nonemptybatches);
         appendStringInfoChar(buf, '\n');
     }
+
+    if (hashtable->radix_bits > 0)
+        appendStringInfo(buf, "Hash table split into %d radix partitions.\n",
+                         1 << hashtable->radix_bits);
 }                               /* ExecHashTableExplainEnd */
 
 
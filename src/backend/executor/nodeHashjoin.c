@@ -21,6 +21,8 @@
 #include "executor/instrument.h"        /* Instrumentation */
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "optimizer/clauses.h"
+#include "parser/parsetree.h"
 #include "utils/faultinjector.h"
 #include "utils/memutils.h"
 
@@ -32,6 +34,13 @@
 static TupleTableSlot *ExecHashJoinOuterGetTuple(PlanState *outerNode,
 						  HashJoinState *hjstate,
 						  uint32 *hashvalue);
+static TupleTableSlot *ExecHashJoinOuterBatchTuple(PlanState *outerNode,
+						  HashJoinState *hjstate,
+						  uint32 *hashvalue);
+static TupleTableSlot *ExecHashJoinOuterBufferedTuple(PlanState *outerNode,
+						  HashJoinState *hjstate,
+						  uint32 *hashvalue);
+static void ExecHashJoinResetOuterBuffer(HashJoinTable hashtable);
 static TupleTableSlot *ExecHashJoinGetSavedTuple(HashJoinBatchSide *side,
 						  uint32 *hashvalue,
 						  TupleTableSlot *tupleSlot);
@@ -45,6 +54,8 @@ static void ReleaseHashTable(HashJoinState *node);
 static bool isHashtableEmpty(HashJoinTable hashtable);
 static void ExecHashJoinResetWorkfileState(HashJoinState *node);
 static void ExecHashJoinSaveState(HashJoinTable hashtable);
+static void ExecHashJoinPushRuntimeFilter(HashJoinState *hjstate, HashJoin *node);
+static Node *runtime_filter_key_mutator(Node *node, List *targetlist);
 
 
 /* ----------------------------------------------------------------
@@ -691,11 +702,100 @@ ExecInitHashJoin(HashJoin *node, EState *estate, int eflags)
 
 	ExecHashJoinResetWorkfileState(hjstate);
 
+	hjstate->hj_runtimeFilter = NULL;
+	ExecHashJoinPushRuntimeFilter(hjstate, node);
+
 	initGpmonPktForHashJoin((Plan *)node, &hjstate->js.ps.gpmon_pkt, estate);
 	
 	return hjstate;
 }
 
+/*
+ * ExecHashJoinPushRuntimeFilter
+ *
+ * If gp_hashjoin_runtime_filter is on, set up a Bloom filter that the Hash
+ * node fills in with the inner join keys, and push it down to the outer
+ * scan so it drops rows that cannot join before projecting them.
+ *
+ * Only inner and IN joins qualify, as the others must return unmatched
+ * outer rows.  Only a scan directly below the join is considered; one under
+ * a Motion runs in another slice.  The outer keys refer to the scan's output
+ * columns, so they are rewritten in terms of its target list.
+ */
+static void
+ExecHashJoinPushRuntimeFilter(HashJoinState *hjstate, HashJoin *node)
+{
+	PlanState  *outerState = outerPlanState(hjstate);
+	HashState  *hashState = (HashState *) innerPlanState(hjstate);
+	List	   *keyexprs = NIL;
+	ListCell   *l;
+
+	if (!gp_hashjoin_runtime_filter)
+		return;
+
+	if ((hjstate->js.jointype != JOIN_INNER && hjstate->js.jointype != JOIN_IN) ||
+		hjstate->hj_nonequijoin)
+		return;
+
+	/* Heap, AO and Parquet tables are all scanned by TableScan. */
+	switch (nodeTag(outerState))
+	{
+		case T_TableScanState:
+		case T_ExternalScanState:
+			break;
+		default:
+			return;
+	}
+
+	foreach(l, node->hashclauses)
+	{
+		OpExpr	   *hclause = (OpExpr *) lfirst(l);
+		Node	   *key;
+
+		Assert(IsA(hclause, OpExpr));
+		key = runtime_filter_key_mutator((Node *) linitial(hclause->args),
+										 outerState->plan->targetlist);
+
+		/* The scan would evaluate these once more than the join does. */
+		if (contain_subplans(key) || contain_volatile_functions(key))
+			return;
+
+		keyexprs = lappend(keyexprs, key);
+	}
+
+	hjstate->hj_runtimeFilter =
+		ExecHashRuntimeFilterCreate(hjstate->hj_HashOperators,
+									(List *) ExecInitExpr((Expr *) keyexprs, outerState),
+									hashState->ps.plan->plan_rows,
+									PlanStateOperatorMemKB((PlanState *) hashState));
+	hashState->hs_runtimeFilter = hjstate->hj_runtimeFilter;
+	((ScanState *) outerState)->ss_runtimeFilter = hjstate->hj_runtimeFilter;
+}
+
+/*
+ * Replace the references to the outer node's output columns in a join key
+ * by the expressions of its target list.
+ */
+static Node *
+runtime_filter_key_mutator(Node *node, List *targetlist)
+{
+	if (node == NULL)
+		return NULL;
+
+	if (IsA(node, Var) && ((Var *) node)->varno == OUTER)
+	{
+		TargetEntry *tle = get_tle_by_resno(targetlist, ((Var *) node)->varattno);
+
+		if (tle == NULL)
+			elog(ERROR, "hash join outer key refers to missing column %d",
+				 ((Var *) node)->varattno);
+
+		return (Node *) copyObject(tle->expr);
+	}
+
+	return expression_tree_mutator(node, runtime_filter_key_mutator, targetlist);
+}
+
 int
 ExecCountSlotsHashJoin(HashJoin *node)
 {
@@ -727,6 +827,11 @@ ExecEndHashJoin(HashJoinState *node)
 		node->hj_HashTable = NULL;
 	}
 
+	if (node->hj_runtimeFilter != NULL && node->hj_runtimeFilter->nchecked > 0)
+		elog(DEBUG1, "HashJoin runtime filter dropped " UINT64_FORMAT " of "
+			 UINT64_FORMAT " outer rows",
+			 node->hj_runtimeFilter->ndropped, node->hj_runtimeFilter->nchecked);
+
 	/*
 	 * Free the exprcontext
 	 */
@@ -767,6 +872,88 @@ ExecHashJoinOuterGetTuple(PlanState *outerNode,
 	HashJoinTable hashtable = hjstate->hj_HashTable;
 	int			curbatch = hashtable->curbatch;
 	TupleTableSlot *slot;
+
+	/*
+	 * Loop allows us to advance to new batches as needed.  NOTE: nbatch
+	 * could increase inside ExecHashJoinNewBatch, so don't try to optimize
+	 * this loop.
+	 */
+	while (curbatch < hashtable->nbatch)
+	{
+		if (hashtable->radix_bits > 0)
+			slot = ExecHashJoinOuterBufferedTuple(outerNode, hjstate, hashvalue);
+		else
+			slot = ExecHashJoinOuterBatchTuple(outerNode, hjstate, hashvalue);
+		if (!TupIsNull(slot))
+			return slot;
+
+		if (curbatch == 0 && !hjstate->cached_workfiles_loaded)
+		{
+			/*
+			 * We have just reached the end of the first pass. Write out the
+			 * first inner batch so that we can reuse it when the workfile
+			 * caching is enabled.
+			 */
+			if (gp_workfile_caching)
+			{
+				ExecHashJoinSaveFirstInnerBatch(hashtable);
+			}
+
+			/*
+			 * Try to switch to a saved batch.
+			 *
+			 * SFR: This can cause re-spill!
+			 */
+			curbatch = ExecHashJoinNewBatch(hjstate);
+
+#ifdef HJDEBUG
+			elog(gp_workfile_caching_loglevel, "HashJoin built table with %.1f tuples for batch %d", hashtable->totalTuples, curbatch);
+#endif
+
+			Gpmon_M_Incr_Rows_Out(GpmonPktFromHashJoinState(hjstate));
+			CheckSendPlanStateGpmonPkt(&hjstate->js.ps);
+		}
+		else
+		{
+			curbatch = ExecHashJoinNewBatch(hjstate);
+
+#ifdef HJDEBUG
+			elog(gp_workfile_caching_loglevel, "HashJoin built table with %.1f tuples for batch %d", hashtable->totalTuples, curbatch);
+#endif
+
+			Gpmon_M_Incr(GpmonPktFromHashJoinState(hjstate), GPMON_HASHJOIN_SPILLBATCH);
+			CheckSendPlanStateGpmonPkt(&hjstate->js.ps);
+		}
+	}
+
+	/* Write spill file state to disk. */
+	ExecHashJoinSaveState(hashtable);
+
+	if (gp_workfile_caching && hjstate->workfiles_created)
+	{
+		workfile_mgr_mark_complete(hashtable->work_set);
+	}
+
+	/* Out of batches... */
+	return NULL;
+}
+
+/*
+ * ExecHashJoinOuterBatchTuple
+ *
+ *		get the next outer tuple of the current batch: from the outer plan
+ *		in the first pass, or from the batch's outer temp file.
+ *
+ * Returns a null slot at the end of the batch.
+ */
+static TupleTableSlot *
+ExecHashJoinOuterBatchTuple(PlanState *outerNode,
+		HashJoinState *hjstate,
+		uint32 *hashvalue)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	int			curbatch = hashtable->curbatch;
+	TupleTableSlot *slot;
 	ExprContext    *econtext;
 
 	HashState *hashState = (HashState *) innerPlanState(hjstate);
@@ -821,65 +1008,169 @@ ExecHashJoinOuterGetTuple(PlanState *outerNode,
 			 */
 		} /* for (;;) */
 
-		/*
-		 * We have just reached the end of the first pass. Write out the first
-		 * inner batch so that we can reuse it when the workfile caching is
-		 * enabled.
-		 */
-		if (gp_workfile_caching) 
-		  {
-		    ExecHashJoinSaveFirstInnerBatch(hashtable);
-		  }
+		return NULL;
+	} /* if (curbatch == 0) */
+
+	/*
+	 * Try to read from a temp file.
+	 */
+	return ExecHashJoinGetSavedTuple(&hashtable->batches[curbatch]->outerside,
+									 hashvalue,
+									 hjstate->hj_OuterTupleSlot);
+}
+
+/*
+ * ExecHashJoinOuterBufferedTuple
+ *
+ *		get the next outer tuple of the current batch from a radix-partitioned
+ *		hash table's outer buffer (see hashjoin.h).
+ *
+ * Outer tuples of the current batch are copied into the buffer until it is
+ * full, then handed out sorted by partition, so consecutive probes stay in
+ * one cache-sized partition.  Tuples of later batches are passed through to
+ * be saved to their batch file.  Returns a null slot at the end of the
+ * batch, once the buffer is empty.
+ */
+static TupleTableSlot *
+ExecHashJoinOuterBufferedTuple(PlanState *outerNode,
+		HashJoinState *hjstate,
+		uint32 *hashvalue)
+{
+	HashJoinTable hashtable = hjstate->hj_HashTable;
+	HashJoinOuterBufferData *buffer = hashtable->outerBuffer;
+	int			npartitions = 1 << hashtable->radix_bits;
+	int			i;
+
+	if (buffer == NULL)
+	{
+		MemoryContext oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+
+		buffer = (HashJoinOuterBufferData *) palloc0(sizeof(HashJoinOuterBufferData));
+		buffer->cxt = AllocSetContextCreate(hashtable->hashCxt,
+											"HashOuterBufferContext",
+											ALLOCSET_DEFAULT_MINSIZE,
+											ALLOCSET_DEFAULT_INITSIZE,
+											ALLOCSET_DEFAULT_MAXSIZE);
+		buffer->capacity = Max(HJ_RADIX_OUTER_MIN_TUPLES,
+							   npartitions * HJ_RADIX_OUTER_TUPLES_PER_PARTITION);
+		buffer->tuples = (MemTuple *) palloc(buffer->capacity * sizeof(MemTuple));
+		buffer->hashvalues = (uint32 *) palloc(buffer->capacity * sizeof(uint32));
+		buffer->sorted_tuples = (MemTuple *) palloc(buffer->capacity * sizeof(MemTuple));
+		buffer->sorted_hashvalues = (uint32 *) palloc(buffer->capacity * sizeof(uint32));
+		buffer->partstart = (int *) palloc((npartitions + 1) * sizeof(int));
+
+		MemoryContextSwitchTo(oldcxt);
+		hashtable->outerBuffer = buffer;
+	}
+
+	for (;;)
+	{
+		/* Hand out the sorted tuples first. */
+		if (buffer->next < buffer->nsorted)
+		{
+			i = buffer->next++;
+			*hashvalue = buffer->sorted_hashvalues[i];
+			return ExecStoreMemTuple(buffer->sorted_tuples[i],
+									 hjstate->hj_OuterTupleSlot,
+									 false);	/* don't pfree */
+		}
+
+		if (buffer->atend && buffer->ncollected == 0)
+		{
+			/* Done with this batch; the next one starts afresh. */
+			buffer->atend = false;
+			return NULL;
+		}
 
 		/*
-		 * We have just reached the end of the first pass. Try to switch to a
-		 * saved batch.
+		 * The tuples handed out are no longer referenced once we are called
+		 * for another one, so their space can be reused.
 		 */
+		if (buffer->ncollected == 0 && buffer->nsorted > 0)
+		{
+			MemoryContextReset(buffer->cxt);
+			buffer->nsorted = buffer->next = 0;
+			buffer->space = 0;
+		}
 
-		/* SFR: This can cause re-spill! */
-		curbatch = ExecHashJoinNewBatch(hjstate);
+		while (!buffer->atend &&
+			   buffer->ncollected < buffer->capacity &&
+			   buffer->space < hashtable->radix_outer_bytes)
+		{
+			TupleTableSlot *slot;
+			uint32		hv;
+			int			bucketno;
+			int			batchno;
+			MemTuple	tuple;
+			MemoryContext oldcxt;
 
+			slot = ExecHashJoinOuterBatchTuple(outerNode, hjstate, &hv);
+			if (TupIsNull(slot))
+			{
+				buffer->atend = true;
+				break;
+			}
 
-#ifdef HJDEBUG
-		elog(gp_workfile_caching_loglevel, "HashJoin built table with %.1f tuples for batch %d", hashtable->totalTuples, curbatch);
-#endif
+			ExecHashGetBucketAndBatch(hashtable, hv, &bucketno, &batchno);
+			if (batchno != hashtable->curbatch)
+			{
+				*hashvalue = hv;
+				return slot;
+			}
 
-		Gpmon_M_Incr_Rows_Out(GpmonPktFromHashJoinState(hjstate)); 
-		CheckSendPlanStateGpmonPkt(&hjstate->js.ps);
-	} /* if (curbatch == 0) */
+			oldcxt = MemoryContextSwitchTo(buffer->cxt);
+			tuple = ExecCopySlotMemTuple(slot);
+			MemoryContextSwitchTo(oldcxt);
 
-	/*
-	 * Try to read from a temp file. Loop allows us to advance to new batches
-	 * as needed.  NOTE: nbatch could increase inside ExecHashJoinNewBatch, so
-	 * don't try to optimize this loop.
-	 */
-	while (curbatch < hashtable->nbatch)
-	{
-		slot = ExecHashJoinGetSavedTuple(&hashtable->batches[curbatch]->outerside,
-										 hashvalue,
-										 hjstate->hj_OuterTupleSlot);
-		if (!TupIsNull(slot))
-			return slot;
-		curbatch = ExecHashJoinNewBatch(hjstate);
+			buffer->tuples[buffer->ncollected] = tuple;
+			buffer->hashvalues[buffer->ncollected] = hv;
+			buffer->ncollected++;
+			buffer->space += memtuple_get_size(tuple, NULL);
+		}
 
-#ifdef HJDEBUG
-		elog(gp_workfile_caching_loglevel, "HashJoin built table with %.1f tuples for batch %d", hashtable->totalTuples, curbatch);
-#endif
+		/* Counting sort of the collected tuples by partition. */
+		MemSet(buffer->partstart, 0, (npartitions + 1) * sizeof(int));
+		for (i = 0; i < buffer->ncollected; i++)
+		{
+			int			bucketno = ExecHashGetRadixBucket(hashtable, buffer->hashvalues[i]);
 
-		Gpmon_M_Incr(GpmonPktFromHashJoinState(hjstate), GPMON_HASHJOIN_SPILLBATCH);
-		CheckSendPlanStateGpmonPkt(&hjstate->js.ps);
-	}
+			buffer->partstart[HJ_RADIX_PARTITION(hashtable, bucketno) + 1]++;
+		}
+		for (i = 0; i < npartitions; i++)
+			buffer->partstart[i + 1] += buffer->partstart[i];
+		for (i = 0; i < buffer->ncollected; i++)
+		{
+			int			bucketno = ExecHashGetRadixBucket(hashtable, buffer->hashvalues[i]);
+			int			j = buffer->partstart[HJ_RADIX_PARTITION(hashtable, bucketno)]++;
 
-	/* Write spill file state to disk. */
-	ExecHashJoinSaveState(hashtable);
+			buffer->sorted_tuples[j] = buffer->tuples[i];
+			buffer->sorted_hashvalues[j] = buffer->hashvalues[i];
+		}
 
-	if (gp_workfile_caching && hjstate->workfiles_created)
-	{
-		workfile_mgr_mark_complete(hashtable->work_set);
+		buffer->nsorted = buffer->ncollected;
+		buffer->next = 0;
+		buffer->ncollected = 0;
 	}
+}
 
-	/* Out of batches... */
-	return NULL;
+/*
+ * ExecHashJoinResetOuterBuffer
+ *		drop the outer tuples buffered by a radix-partitioned hash join
+ */
+static void
+ExecHashJoinResetOuterBuffer(HashJoinTable hashtable)
+{
+	HashJoinOuterBufferData *buffer = hashtable->outerBuffer;
+
+	if (buffer == NULL)
+		return;
+
+	MemoryContextReset(buffer->cxt);
+	buffer->space = 0;
+	buffer->atend = false;
+	buffer->ncollected = 0;
+	buffer->nsorted = 0;
+	buffer->next = 0;
 }
 
 /*
@@ -1040,6 +1331,8 @@ start_over:
 		    hashtable->totalTuples += 1;
 	    }
 
+		ExecHashTableLinkPartitions(hashtable);
+
 	    /*
 	     * after we build the hash table, the inner batch file is no longer
 	     * needed.
@@ -1236,6 +1529,8 @@ ExecReScanHashJoin(HashJoinState *node, ExprContext *exprCtxt)
 
 			/* MPP-1600: reset the batch number */
 			node->hj_HashTable->curbatch = 0;
+
+			ExecHashJoinResetOuterBuffer(node->hj_HashTable);
 		}
 		else
 		{
@@ -1248,6 +1543,10 @@ ExecReScanHashJoin(HashJoinState *node, ExprContext *exprCtxt)
 			pfree(node->hj_HashTable);
 			node->hj_HashTable = NULL;
 
+			/* The outer scan must not use the filter until it is rebuilt. */
+			if (node->hj_runtimeFilter != NULL)
+				node->hj_runtimeFilter->ready = false;
+
 			/*
 			 * if chgParam of subnode is not null then plan will be re-scanned
 			 * by first ExecProcNode.
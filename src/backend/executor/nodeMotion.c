@@ -1535,7 +1535,7 @@ void
 doSendTuple(Motion * motion, MotionState * node, TupleTableSlot *outerTupleSlot)
 {
 	int16		    targetRoute;
-	HeapTuple       tuple;
+	HeapTuple       tuple = NULL;
 	SendReturnCode  sendRC;
 	ExprContext    *econtext = node->ps.ps_ExprContext;
 	
@@ -1601,14 +1601,26 @@ doSendTuple(Motion * motion, MotionState * node, TupleTableSlot *outerTupleSlot)
 		Assert(!is_null);
 	}
 	
-	tuple = ExecFetchSlotGenericTuple(outerTupleSlot, true);
-	
-	/* send the tuple out. */
-	sendRC = SendTuple(node->ps.state->motionlayer_context,
-			node->ps.state->interconnect_context,
-			motion->motionID,
-			tuple,
-			targetRoute);
+	if (gp_motion_batch_size > 1)
+	{
+		/* add the tuple to the batch of its route, without forming it. */
+		sendRC = SendTupleSlot(node->ps.state->motionlayer_context,
+				node->ps.state->interconnect_context,
+				motion->motionID,
+				outerTupleSlot,
+				targetRoute);
+	}
+	else
+	{
+		tuple = ExecFetchSlotGenericTuple(outerTupleSlot, true);
+
+		/* send the tuple out. */
+		sendRC = SendTuple(node->ps.state->motionlayer_context,
+				node->ps.state->interconnect_context,
+				motion->motionID,
+				tuple,
+				targetRoute);
+	}
 
 	Assert(sendRC == SEND_COMPLETE || sendRC == STOP_SENDING);
 	if (sendRC == SEND_COMPLETE)
@@ -1619,7 +1631,7 @@ doSendTuple(Motion * motion, MotionState * node, TupleTableSlot *outerTupleSlot)
 
 
 #ifdef CDB_MOTION_DEBUG
-	if (sendRC == SEND_COMPLETE && node->numTuplesToAMS <= 20)
+	if (sendRC == SEND_COMPLETE && tuple != NULL && node->numTuplesToAMS <= 20)
 	{
 		StringInfoData  buf;
 
@@ -3,6 +3,8 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
 #include "storage/bfz.h"
 #include "storage/fd.h"
 #include "miscadmin.h"
@@ -10,6 +12,7 @@
 
 #include "utils/memutils.h"		/* For MemoryContext stuff */
 #include "cdb/cdbvars.h"
+#include "cdb/cdbgang.h"		/* gp_pthread_create */
 #include "utils/workfile_mgr.h"
 #include "storage/fd.h"
 #include "postmaster/primary_mirror_mode.h"
@@ -96,6 +99,246 @@ compute_checksum(const char *buffer, uint32 size)
 	return crc;
 }
 
+/*
+ * Background I/O.
+ *
+ * With gp_workfile_async_io on, a full block is handed to a per-backend
+ * I/O thread, which compresses and writes it while the executor fills the
+ * next block. While scanning, the block after the one being consumed is
+ * read ahead the same way. A file has at most one request outstanding, so
+ * serving the queue in FIFO order keeps the blocks of each file in order.
+ *
+ * The I/O thread only calls the read_raw/write_raw hooks; a failure is
+ * recorded in the request and reported by the backend when it collects
+ * the request.
+ */
+typedef struct bfz_async
+{
+	struct bfz_async *next;		/* next request in the I/O queue */
+	bfz_t	   *bfz;
+	bool		is_write;
+	bool		pending;		/* queued or being served */
+	int			size;			/* bytes to write, or bytes read */
+	int			err;			/* errno of a failed request, or 0 */
+	char		buffer[BFZ_BUFFER_SIZE];
+} bfz_async;
+
+static pthread_mutex_t bfz_io_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t bfz_io_work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t bfz_io_done = PTHREAD_COND_INITIALIZER;
+static bfz_async *bfz_io_head = NULL;
+static bfz_async *bfz_io_tail = NULL;
+static bool bfz_io_started = false;
+static bool bfz_io_failed = false;
+
+static void *
+bfz_io_thread(void *arg)
+{
+	sigset_t	sigs;
+
+	/* Signals are for the backend, not for us */
+	sigfillset(&sigs);
+	pthread_sigmask(SIG_BLOCK, &sigs, NULL);
+
+	pthread_mutex_lock(&bfz_io_lock);
+	for (;;)
+	{
+		bfz_async  *req;
+		struct bfz_freeable_stuff *fs;
+		int			size;
+		int			err = 0;
+
+		while (bfz_io_head == NULL)
+			pthread_cond_wait(&bfz_io_work, &bfz_io_lock);
+
+		req = bfz_io_head;
+		bfz_io_head = req->next;
+		if (bfz_io_head == NULL)
+			bfz_io_tail = NULL;
+		req->next = NULL;
+		pthread_mutex_unlock(&bfz_io_lock);
+
+		fs = req->bfz->freeable_stuff;
+		errno = 0;
+		if (req->is_write)
+			size = fs->write_raw(req->bfz, req->buffer, req->size);
+		else
+			size = fs->read_raw(req->bfz, req->buffer, sizeof(req->buffer));
+		if (size < 0)
+		{
+			err = errno != 0 ? errno : EIO;
+			size = 0;
+		}
+
+		pthread_mutex_lock(&bfz_io_lock);
+		if (!req->is_write)
+			req->size = size;
+		req->err = err;
+		req->pending = false;
+		pthread_cond_broadcast(&bfz_io_done);
+	}
+
+	return NULL;
+}
+
+/*
+ * Allocate a request block for a file, starting the I/O thread if it is
+ * not running yet. Returns NULL if the file should do synchronous I/O.
+ */
+static bfz_async *
+bfz_async_create(bfz_t *thiz)
+{
+	bfz_async  *req;
+
+	if (!gp_workfile_async_io || bfz_io_failed)
+		return NULL;
+
+	if (!bfz_io_started)
+	{
+		pthread_t	thread;
+		int			pthread_err;
+
+		pthread_err = gp_pthread_create(&thread, bfz_io_thread, NULL, "bfz_async_create");
+		if (pthread_err != 0)
+		{
+			elog(LOG, "could not start workfile I/O thread, error %d; "
+				 "using synchronous I/O", pthread_err);
+			bfz_io_failed = true;
+			return NULL;
+		}
+		pthread_detach(thread);
+		bfz_io_started = true;
+	}
+
+	/* Like the bfz buffer, this must survive into the abort callback */
+	req = malloc(sizeof(*req));
+	if (req == NULL)
+		return NULL;
+
+	req->next = NULL;
+	req->bfz = thiz;
+	req->is_write = false;
+	req->pending = false;
+	req->size = 0;
+	req->err = 0;
+
+	return req;
+}
+
+static void
+bfz_async_submit(bfz_async *req, bool is_write, int size)
+{
+	Assert(!req->pending);
+
+	req->is_write = is_write;
+	req->size = size;
+	req->err = 0;
+	req->next = NULL;
+
+	pthread_mutex_lock(&bfz_io_lock);
+	req->pending = true;
+	if (bfz_io_tail == NULL)
+		bfz_io_head = req;
+	else
+		bfz_io_tail->next = req;
+	bfz_io_tail = req;
+	pthread_cond_signal(&bfz_io_work);
+	pthread_mutex_unlock(&bfz_io_lock);
+}
+
+/*
+ * Wait for the outstanding request of a file, if any.
+ *
+ * This does not elog, so it is safe in the transaction abort callback.
+ */
+static void
+bfz_async_wait(bfz_async *req)
+{
+	pthread_mutex_lock(&bfz_io_lock);
+	while (req->pending)
+		pthread_cond_wait(&bfz_io_done, &bfz_io_lock);
+	pthread_mutex_unlock(&bfz_io_lock);
+}
+
+/*
+ * Wait for the outstanding request of a file and report its failure.
+ */
+static void
+bfz_async_complete(bfz_async *req)
+{
+	bfz_async_wait(req);
+
+	if (req->err != 0)
+	{
+		errno = req->err;
+		req->err = 0;
+
+		if (req->is_write)
+			ereport(ERROR,
+					(errcode(ERRCODE_IO_ERROR),
+					 errmsg("could not write to temporary file: %m")));
+		else
+			ereport(ERROR,
+					(errcode(ERRCODE_IO_ERROR),
+					 errmsg("could not read from temporary file: %m")));
+	}
+}
+
+/*
+ * Drain and free the request block of a file. Must be called before the
+ * compression state of the file is closed or replaced.
+ */
+static void
+bfz_async_release(bfz_t *thiz)
+{
+	if (thiz->async == NULL)
+		return;
+
+	bfz_async_wait(thiz->async);
+	free(thiz->async);
+	thiz->async = NULL;
+}
+
+/*
+ * Hand a block over to the I/O thread, once the previous block of the
+ * file has made it to disk.
+ */
+static void
+bfz_async_write(bfz_t *thiz, const char *buffer, int size)
+{
+	bfz_async  *req = thiz->async;
+
+	Assert(size <= sizeof(req->buffer));
+
+	bfz_async_complete(req);
+	memcpy(req->buffer, buffer, size);
+	bfz_async_submit(req, true, size);
+}
+
+/*
+ * Collect the block read ahead by the I/O thread and start reading the
+ * next one. Returns the number of bytes read, 0 at end of file.
+ */
+static int
+bfz_async_read(bfz_t *thiz, char *buffer)
+{
+	bfz_async  *req = thiz->async;
+	int			size;
+
+	bfz_async_complete(req);
+
+	size = req->size;
+	memcpy(buffer, req->buffer, size);
+
+	/* A short block is the last one */
+	if (size == sizeof(req->buffer))
+		bfz_async_submit(req, false, 0);
+	else
+		req->size = 0;
+
+	return size;
+}
+
 /*
  * Write out a bfz buffer.
  *
@@ -132,9 +375,21 @@ write_bfz_buffer(bfz_t *bfz, bool isLast)
 		fs->buffer_pointer += sizeof(BFZ_CHECKSUM_TYPE);
 	}
 	
+	if (!isLast && bfz->async == NULL)
+		bfz->async = bfz_async_create(bfz);
+
 	PG_TRY();
 	{
-		fs->write_ex(bfz, fs->buffer, fs->buffer_pointer - fs->buffer);
+		if (bfz->async == NULL)
+			fs->write_ex(bfz, fs->buffer, fs->buffer_pointer - fs->buffer);
+		else if (!isLast)
+			bfz_async_write(bfz, fs->buffer, fs->buffer_pointer - fs->buffer);
+		else
+		{
+			/* Let the last block catch up, then write this one ourselves */
+			bfz_async_complete(bfz->async);
+			fs->write_ex(bfz, fs->buffer, fs->buffer_pointer - fs->buffer);
+		}
 	}
 	PG_CATCH();
 	{
@@ -178,7 +433,10 @@ read_bfz_buffer(bfz_t *bfz, char *buffer)
 		memcpy(oldBuffer, buffer, sizeof(fs->buffer));
 	}
 
-	bytesRead = fs->read_ex(bfz, buffer, sizeof(fs->buffer));
+	if (bfz->async != NULL)
+		bytesRead = bfz_async_read(bfz, buffer);
+	else
+		bytesRead = fs->read_ex(bfz, buffer, sizeof(fs->buffer));
 	Assert(bytesRead <= sizeof(fs->buffer));
 
 	if (bytesRead == 0)
@@ -425,6 +683,8 @@ bfz_close(bfz_t * thiz, bool unreg)
 	if (unreg)
 		UnregisterXactCallbackOnce(bfz_close_callback, thiz);
 
+	bfz_async_release(thiz);
+
 	if (thiz->freeable_stuff)
 	{
 		thiz->freeable_stuff->close_ex(thiz);
@@ -481,6 +741,8 @@ bfz_append_end(bfz_t * thiz)
 
 	tot_bytes = thiz->tot_bytes;
 
+	/* Hold no extra buffer while the file is suspended */
+	bfz_async_release(thiz);
 
 	/*
 	 * Duplicate file descriptor, since close_ex closes the file,
@@ -523,6 +785,12 @@ bfz_scan_begin(bfz_t * thiz)
 	fs = thiz->freeable_stuff;
 	fs->buffer_pointer = fs->buffer_end = fs->buffer;
 
+	/* Start reading the first block ahead of the first request */
+	Assert(thiz->async == NULL);
+	thiz->async = bfz_async_create(thiz);
+	if (thiz->async != NULL)
+		bfz_async_submit(thiz->async, false, 0);
+
 	if (gp_workfile_faultinject)
 	{
 		thiz->chosenBlockNo = (((double)random()) / ((double)MAX_RANDOM_VALUE)) * thiz->numBlocks;
@@ -29,7 +29,7 @@ bfz_nothing_close_ex(bfz_t * thiz)
 }
 
 static int
-bfz_nothing_read_ex(bfz_t * thiz, char *buffer, int size)
+bfz_nothing_read_raw(bfz_t * thiz, char *buffer, int size)
 {
 	int			orig_size = size;
 
@@ -38,9 +38,7 @@ bfz_nothing_read_ex(bfz_t * thiz, char *buffer, int size)
 		int			i = readAndRetry(thiz->fd, buffer, size);
 
 		if (i < 0)
-			ereport(ERROR,
-					(errcode(ERRCODE_IO_ERROR),
-					errmsg("could not read from temporary file: %m")));
+			return -1;
 		if (i == 0)
 			break;
 		buffer += i;
@@ -49,20 +47,40 @@ bfz_nothing_read_ex(bfz_t * thiz, char *buffer, int size)
 	return orig_size - size;
 }
 
-static void
-bfz_nothing_write_ex(bfz_t * bfz, const char *buffer, int size)
+static int
+bfz_nothing_write_raw(bfz_t * bfz, const char *buffer, int size)
 {
 	while (size)
 	{
 		int			i = writeAndRetry(bfz->fd, buffer, size);
 
 		if (i < 0)
-			ereport(ERROR,
-					(errcode(ERRCODE_IO_ERROR),
-					errmsg("could not write to temporary file: %m")));
+			return -1;
 		buffer += i;
 		size -= i;
 	}
+	return 0;
+}
+
+static int
+bfz_nothing_read_ex(bfz_t * thiz, char *buffer, int size)
+{
+	int			i = bfz_nothing_read_raw(thiz, buffer, size);
+
+	if (i < 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_IO_ERROR),
+				errmsg("could not read from temporary file: %m")));
+	return i;
+}
+
+static void
+bfz_nothing_write_ex(bfz_t * bfz, const char *buffer, int size)
+{
+	if (bfz_nothing_write_raw(bfz, buffer, size) < 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_IO_ERROR),
+				errmsg("could not write to temporary file: %m")));
 }
 
 void
@@ -80,4 +98,6 @@ bfz_nothing_init(bfz_t * thiz)
 	fs->read_ex = bfz_nothing_read_ex;
 	fs->write_ex = bfz_nothing_write_ex;
 	fs->close_ex = bfz_nothing_close_ex;
+	fs->read_raw = bfz_nothing_read_raw;
+	fs->write_raw = bfz_nothing_write_raw;
 }
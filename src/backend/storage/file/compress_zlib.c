@@ -33,7 +33,7 @@ bfz_zlib_close_ex(bfz_t * thiz)
 	thiz->freeable_stuff = NULL;
 }
 
-static void
+static int
 gzwrite_fully(gzFile f, const char *buffer, int size)
 {
 	while (size)
@@ -41,12 +41,11 @@ gzwrite_fully(gzFile f, const char *buffer, int size)
 		int			i = gzwrite(f, (void *) buffer, size);
 
 		if (i <= 0)
-			ereport(ERROR,
-					(errcode(ERRCODE_IO_ERROR),
-					errmsg("could not write to temporary file: %m")));
+			return -1;
 		buffer += i;
 		size -= i;
 	}
+	return 0;
 }
 
 static int
@@ -59,9 +58,7 @@ gzread_fully(gzFile f, char *buffer, int size)
 		int			i = gzread(f, buffer, size);
 
 		if (i < 0)
-			ereport(ERROR,
-					(errcode(ERRCODE_IO_ERROR),
-					errmsg("could not read from temporary file: %m")));
+			return -1;
 		if (i == 0)
 			break;
 		buffer += i;
@@ -70,22 +67,43 @@ gzread_fully(gzFile f, char *buffer, int size)
 	return orig_size - size;
 }
 
-static void
-bfz_zlib_write_ex(bfz_t * thiz, const char *buffer, int size)
+static int
+bfz_zlib_write_raw(bfz_t * thiz, const char *buffer, int size)
 {
 	struct bfz_zlib_freeable_stuff *fs = (void *) thiz->freeable_stuff;
 
-	gzwrite_fully(fs->f, buffer, size);
+	return gzwrite_fully(fs->f, buffer, size);
 }
 
 static int
-bfz_zlib_read_ex(bfz_t * thiz, char *buffer, int size)
+bfz_zlib_read_raw(bfz_t * thiz, char *buffer, int size)
 {
 	struct bfz_zlib_freeable_stuff *fs = (void *) thiz->freeable_stuff;
 
 	return gzread_fully(fs->f, buffer, size);
 }
 
+static void
+bfz_zlib_write_ex(bfz_t * thiz, const char *buffer, int size)
+{
+	if (bfz_zlib_write_raw(thiz, buffer, size) < 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_IO_ERROR),
+				errmsg("could not write to temporary file: %m")));
+}
+
+static int
+bfz_zlib_read_ex(bfz_t * thiz, char *buffer, int size)
+{
+	int			i = bfz_zlib_read_raw(thiz, buffer, size);
+
+	if (i < 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_IO_ERROR),
+				errmsg("could not read from temporary file: %m")));
+	return i;
+}
+
 void
 bfz_zlib_init(bfz_t * thiz)
 {
@@ -100,6 +118,8 @@ bfz_zlib_init(bfz_t * thiz)
 	fs->super.read_ex = bfz_zlib_read_ex;
 	fs->super.write_ex = bfz_zlib_write_ex;
 	fs->super.close_ex = bfz_zlib_close_ex;
+	fs->super.read_raw = bfz_zlib_read_raw;
+	fs->super.write_raw = bfz_zlib_write_raw;
 
 	if (thiz->mode == BFZ_MODE_APPEND)
 		fs->f = gzdopen(thiz->fd, "wb1");
@@ -3133,6 +3133,35 @@ FileRead(File file, char *buffer, int amount) {
 		return HdfsFileRead(file, buffer, amount);
 }
 
+/*
+ * ask the OS to start reading the given range of a file in the background,
+ * so that a later FileRead of it does not wait.  Only a hint: hdfs files and
+ * platforms without posix_fadvise ignore it.
+ *
+ * return 0 on success, otherwise an error code
+ */
+int
+FilePrefetch(File file, int64 offset, int amount)
+{
+	int			returnCode = 0;
+
+	Assert(FileIsValid(file));
+
+	if (!IsLocalPath(VfdCache[file].fileName))
+		return 0;
+
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+	returnCode = FileAccess(file);
+	if (returnCode < 0)
+		return returnCode;
+
+	returnCode = posix_fadvise(VfdCache[file].fd, offset, amount,
+							   POSIX_FADV_WILLNEED);
+#endif
+
+	return returnCode;
+}
+
 int
 FileWrite(File file, const char *buffer, int amount) {
 	if (IsLocalPath(VfdCache[file].fileName))
@@ -4804,6 +4804,11 @@ PostgresMain(int argc, char *argv[], const char *username)
 					if (serializedPlantreelen > 0)
 						serializedPlantree = pq_getmsgbytes(&input_message,serializedPlantreelen);
 
+					/* Keep or look up the plan in the dispatched plan cache */
+					if (serializedPlantreelen > 0)
+						serializedPlantree = receiveSerializedCached(serializedPlantree,
+																	 &serializedPlantreelen);
+
 					if (serializedParamslen > 0)
 						serializedParams = pq_getmsgbytes(&input_message,serializedParamslen);
 
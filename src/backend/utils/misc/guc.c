@@ -41,6 +41,7 @@
 #include "cdb/cdbappendonlyam.h"
 #include "cdb/cdbfilerep.h"
 #include "cdb/cdbfilesystemcredential.h"
+#include "cdb/cdbsrlz.h"
 #include "cdb/tupchunk.h"
 #include "commands/async.h"
 #include "commands/vacuum.h"
@@ -309,6 +310,7 @@ bool        Master_mirroring_administrator_disable = false;
 int			gp_max_local_distributed_cache = 1024;
 bool		gp_appendonly_verify_block_checksums = false;
 bool 		gp_appendonly_verify_write_block = false;
+int			gp_appendonly_read_ahead_blocks = 0;
 bool		gp_heap_require_relhasoids_match = true;
 bool		Debug_appendonly_rezero_quicklz_compress_scratch = false;
 bool		Debug_appendonly_rezero_quicklz_decompress_scratch = false;
@@ -1145,6 +1147,16 @@ static struct config_bool ConfigureNamesBool[] =
 		&gp_workfile_checksumming,
 		true, NULL, NULL
 	},
+	{
+		{"gp_workfile_async_io", PGC_USERSET, QUERY_TUNING_OTHER,
+		 gettext_noop("Write and read executor work files in a background thread."),
+		 gettext_noop("Full blocks are compressed and written behind, and the next "
+					  "block is read ahead, while the executor keeps running."),
+		 GUC_GPDB_ADDOPT
+		},
+		&gp_workfile_async_io,
+		false, NULL, NULL
+	},
 	{
 		{"gp_workfile_caching", PGC_SUSET, QUERY_TUNING_OTHER,
 			gettext_noop("Enable work file caching"),
@@ -1978,6 +1990,39 @@ static struct config_bool ConfigureNamesBool[] =
 		true, NULL, NULL
 	},
 
+	{
+		{"gp_parquet_dictionary_encoding", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Enable dictionary encoding when writing parquet tables."),
+			gettext_noop("Column chunks fall back to plain encoding if the dictionary exceeds the page size."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+		},
+		&gp_parquet_dictionary_encoding,
+		false, NULL, NULL
+	},
+
+	{
+		{"gp_parquet_late_materialization", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Enable late materialization in parquet scans."),
+			gettext_noop("Simple quals are evaluated before other columns are read, "
+						 "pages with no qualifying rows are not decompressed."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+		},
+		&gp_parquet_late_materialization,
+		true, NULL, NULL
+	},
+
+	{
+		{"gp_enable_fast_qual", PGC_USERSET, DEVELOPER_OPTIONS,
+			gettext_noop("Evaluate simple scan quals without the expression interpreter."),
+			gettext_noop("Comparisons of integer, float, date, timestamp and text "
+						 "columns with constants, IN-lists and IS NULL tests, "
+						 "combined with AND and OR, are compiled once per scan."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+		},
+		&gp_enable_fast_qual,
+		true, NULL, NULL
+	},
+
 	{
 		{"gp_enable_mk_sort", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enable multi-key sort."),
@@ -2000,6 +2045,29 @@ static struct config_bool ConfigureNamesBool[] =
 		true, NULL, NULL
 	},
 
+	{
+		{"gp_mk_sort_normalized_keys", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Compare multi-key sort keys on normalized 64-bit keys."),
+			gettext_noop("Integer, float, date, timestamp, oid and numeric keys, and "
+						 "text keys in the C locale, are compared as one unsigned integer, "
+						 "falling back to the sort function only on ties of lossy keys."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+		},
+		&gp_mk_sort_normalized_keys,
+		false, NULL, NULL
+	},
+
+	{
+		{"gp_mk_sort_bounded_spill", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Bound the runs of a LIMIT multi-key sort that spills."),
+			gettext_noop("Runs are cut at the limit, and tuples that sort after the "
+						 "limit-th tuple of a run are dropped instead of spilled."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+		},
+		&gp_mk_sort_bounded_spill,
+		true, NULL, NULL
+	},
+
 
 #ifdef USE_ASSERT_CHECKING
 	{
@@ -2023,6 +2091,16 @@ static struct config_bool ConfigureNamesBool[] =
 		true, NULL, NULL
 	},
 
+	{
+		{"gp_hashagg_open_addressing", PGC_USERSET, QUERY_TUNING_METHOD,
+            gettext_noop("Use open addressing in the hash table of hashagg"),
+            gettext_noop("Probes an array of slots instead of walking hash chains"),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+		},
+		&gp_hashagg_open_addressing,
+		false, NULL, NULL
+	},
+
 	{
 		{"gp_enable_motion_deadlock_sanity", PGC_USERSET, DEVELOPER_OPTIONS,
 			gettext_noop("Enable verbose check at planning time."),
@@ -4887,6 +4965,17 @@ static struct config_int ConfigureNamesInt[] =
 		0, 0, MAX_KILOBYTES, NULL, NULL
 	},
 
+	{
+		{"gp_dispatch_plan_cache_slots", PGC_USERSET, GP_ARRAY_TUNING,
+			gettext_noop("Sets the number of dispatched plans kept for reuse."),
+			gettext_noop("A repeated plan is not compressed again, and QEs that "
+						 "already hold it are sent a reference instead."),
+			GUC_NOT_IN_SAMPLE
+		},
+		&gp_dispatch_plan_cache_slots,
+		8, 0, SERIALIZED_CACHE_MAX_SLOTS, NULL, NULL
+	},
+
 	{
 		{"gp_max_partition_level", PGC_SUSET, PRESET_OPTIONS,
 		 	gettext_noop("Sets the maximum number of levels allowed when creating a partitioned table."),
@@ -5428,6 +5517,17 @@ static struct config_int ConfigureNamesInt[] =
 		2048, 0, INT_MAX, NULL, NULL
 	},
 
+	{
+		{"gp_appendonly_read_ahead_blocks", PGC_USERSET, APPENDONLY_TABLES,
+			gettext_noop("Sets how many more maximum size blocks each read of an append-only scan covers."),
+			gettext_noop("Each read of the scan, and the buffer of the scan, is this many blocks "
+						 "longer than the two it covers by default."),
+			GUC_GPDB_ADDOPT | GUC_NOT_IN_SAMPLE
+		},
+		&gp_appendonly_read_ahead_blocks,
+		0, 0, 64, NULL, NULL
+	},
+
 	{
 		{"test_appendonly_version_default", PGC_USERSET, APPENDONLY_TABLES,
 		 gettext_noop("Align append-only blocks to 64 bits."),
@@ -5467,6 +5567,46 @@ static struct config_int ConfigureNamesInt[] =
         4, 1, 4096, NULL, NULL
 	},
 
+	{
+		{"gp_interconnect_rx_batch_size", PGC_USERSET, GP_ARRAY_TUNING,
+            gettext_noop("Sets the maximum number of packets received by one system call in the UDP interconnect"),
+            gettext_noop("Set to 1 to receive packets one at a time."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+        },
+        &Gp_interconnect_rx_batch_size,
+        16, 1, 64, NULL, NULL
+	},
+
+	{
+		{"gp_interconnect_tx_batch_size", PGC_USERSET, GP_ARRAY_TUNING,
+            gettext_noop("Sets the maximum number of packets sent by one system call in the UDP interconnect"),
+            gettext_noop("Set to 1 to send packets one at a time."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+        },
+        &Gp_interconnect_tx_batch_size,
+        16, 1, 64, NULL, NULL
+	},
+
+	{
+		{"gp_motion_batch_size", PGC_USERSET, GP_ARRAY_TUNING,
+            gettext_noop("Sets the number of tuples motion senders pack column-wise into one batch"),
+            gettext_noop("Set to 0 or 1 to send tuples one at a time."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+        },
+        &gp_motion_batch_size,
+        0, 0, 4096, NULL, NULL
+	},
+
+	{
+		{"gp_motion_compress_level", PGC_USERSET, GP_ARRAY_TUNING,
+            gettext_noop("Sets the zlib compression level of tuples and batches sent by motion nodes"),
+            gettext_noop("Valid range is 1..9, set to 0 to send uncompressed."),
+			GUC_NO_SHOW_ALL | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+        },
+        &gp_motion_compress_level,
+        0, 0, 9, NULL, NULL
+	},
+
 	{
 		{"gp_interconnect_snd_queue_depth", PGC_USERSET, GP_ARRAY_TUNING,
             gettext_noop("Sets the maximum size of the send queue for each connection in the UDP interconnect"),
@@ -5648,6 +5788,27 @@ static struct config_int ConfigureNamesInt[] =
 		512, 0, INT_MAX, assign_gp_connections_per_thread, show_gp_connections_per_thread
 	},
 
+	{
+		{"gp_workermgr_idle_threads", PGC_USERSET, GP_ARRAY_TUNING,
+			gettext_noop("Sets the number of idle dispatch and worker threads each backend keeps."),
+			gettext_noop("Kept threads are reused by later queries instead of creating new ones."),
+			GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+		},
+		&gp_workermgr_idle_threads,
+		16, 0, 1024, NULL, NULL
+	},
+
+	{
+		{"gp_copy_dispatch_batch_size", PGC_USERSET, GP_ARRAY_TUNING,
+			gettext_noop("Sets the size of the batches of rows COPY FROM sends to each segment."),
+			gettext_noop("Batches are sent by a worker thread while the next rows are parsed. "
+						 "0 sends each row as soon as it is parsed."),
+			GUC_UNIT_KB | GUC_NOT_IN_SAMPLE | GUC_GPDB_ADDOPT
+		},
+		&gp_copy_dispatch_batch_size,
+		64, 0, 512 * 1024, NULL, NULL
+	},
+
 	{
 		{"gp_subtrans_warn_limit", PGC_POSTMASTER, RESOURCES,
 			gettext_noop("Sets the warning limit on number of subtransactions in a transaction."),
@@ -5878,6 +6039,48 @@ static struct config_int ConfigureNamesInt[] =
 		1, 0, 1, NULL, NULL
 	},
 
+	{
+		{"gp_hashjoin_runtime_filter", PGC_USERSET, GP_ARRAY_TUNING,
+		 gettext_noop("Push a bloom filter of the hash join inner keys down to the outer scan"),
+		 gettext_noop("Lets scans drop rows that cannot join before they are projected or joined"),
+		 GUC_NOT_IN_SAMPLE | GUC_NO_SHOW_ALL | GUC_GPDB_ADDOPT
+		},
+		&gp_hashjoin_runtime_filter,
+		0, 0, 1, NULL, NULL
+	},
+
+	{
+		{"gp_hashjoin_radix_partition", PGC_USERSET, GP_ARRAY_TUNING,
+		 gettext_noop("Partition the in-memory hash join table into cache-sized partitions"),
+		 gettext_noop("Outer rows are buffered and probed one partition at a time"),
+		 GUC_NOT_IN_SAMPLE | GUC_NO_SHOW_ALL | GUC_GPDB_ADDOPT
+		},
+		&gp_hashjoin_radix_partition,
+		0, 0, 1, NULL, NULL
+	},
+
+	{
+		{"gp_hashjoin_build_threads", PGC_USERSET, GP_ARRAY_TUNING,
+		 gettext_noop("Number of threads building the buckets of a hash join table"),
+		 gettext_noop("More than 1 radix-partitions the table, and links the tuples "
+					  "of its partitions into their buckets in parallel"),
+		 GUC_NOT_IN_SAMPLE | GUC_NO_SHOW_ALL | GUC_GPDB_ADDOPT
+		},
+		&gp_hashjoin_build_threads,
+		0, 0, 32, NULL, NULL
+	},
+
+	{
+		{"gp_mksort_threads", PGC_USERSET, GP_ARRAY_TUNING,
+		 gettext_noop("Number of threads sorting an in-memory sort"),
+		 gettext_noop("More than 1 sorts chunks of the input concurrently and merges "
+					  "them in parallel, for sorts on int4 keys that fit in memory"),
+		 GUC_NOT_IN_SAMPLE | GUC_NO_SHOW_ALL | GUC_GPDB_ADDOPT
+		},
+		&gp_mksort_threads,
+		0, 0, 32, NULL, NULL
+	},
+
 	{
 		{"gp_motion_slice_noop", PGC_USERSET, GP_ARRAY_TUNING,
 		 gettext_noop("Make motion nodes in certain slices noop"),
@@ -6700,6 +6903,18 @@ static struct config_real ConfigureNamesReal[] =
 		0, 0, DBL_MAX, NULL, NULL
 	},
 
+	{
+		{"gp_hashagg_stream_passthrough_ratio", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Sets the groups per input row above which the bottom stage "
+						 "of a two stage hashagg stops hashing."),
+			gettext_noop("Such a hashagg then passes each input row on as a partial group "
+						 "of its own.  Zero means never."),
+			GUC_GPDB_ADDOPT | GUC_NOT_IN_SAMPLE
+		},
+		&gp_hashagg_stream_passthrough_ratio,
+		0, 0, 1.0, NULL, NULL
+	},
+
 	{
 		{"gp_hashagg_rewrite_limit", PGC_USERSET, QUERY_TUNING_OTHER,
             gettext_noop("(Obsolete) Planner will not choose hashed aggregation if "
@@ -119,6 +119,9 @@
 #include "utils/tuplesort.h"
 #include "utils/pg_locale.h"
 #include "utils/builtins.h"
+#include "utils/date.h"
+#include "utils/numeric.h"
+#include "utils/timestamp.h"
 #include "utils/tuplesort_mk.h"
 #include "utils/string_wrapper.h"
 #include "utils/faultinjector.h"
@@ -154,6 +157,12 @@ typedef enum
 #define TAPE_BUFFER_OVERHEAD		(BLCKSZ * 3)
 #define MERGE_BUFFER_SIZE			(BLCKSZ * 32)
 
+/*
+ * Below this many tuples an in-memory sort is not worth spreading over
+ * gp_mksort_threads threads.
+ */
+#define MK_PARALLEL_MIN_ENTRIES		(1 << 16)
+
 // #define PRINT_SPILL_AND_MEMORY_MESSAGES
 
 /* 
@@ -279,6 +288,20 @@ struct Tuplesortstate_mk
 
     int currentRun;
 
+    /*
+     * Bounded spilling, for a LIMIT sort that ran out of memory before it
+     * had limit tuples.  No run needs more than limit tuples, and the
+     * limit-th tuple of any run bounds the result: a tuple sorting after it
+     * can be dropped instead of being spilled.  boundEntry holds a copy of
+     * the smallest such tuple seen so far, in sortcontext so that it counts
+     * against memAllowed, and is kept prepared at level 0.
+     */
+    bool boundedSpill;
+    bool hasBound;
+    int64 runTuples;			/* tuples written to the current run */
+    int64 boundDropped;			/* tuples dropped instead of spilled */
+    MKEntry boundEntry;
+
     /*
      * Unless otherwise noted, all pointer variables below are pointers to
      * arrays of length maxTapes, holding per-tape data.
@@ -483,6 +506,8 @@ static void readtup_datum(Tuplesortstate_mk *state, TuplesortPos_mk *pos, MKEntr
 
 static void tupsort_prepare_char(MKEntry *a, bool isChar);
 static int tupsort_compare_char(MKEntry *v1, MKEntry *v2, MKLvContext *lvctxt, MKContext *mkContext);
+static int tupsort_compare_normkey(MKEntry *v1, MKEntry *v2, MKLvContext *lvctxt, MKContext *mkContext);
+static void tupsort_choose_normalized_key(MKLvContext *sinfo);
 
 static Datum tupsort_fetch_datum_mtup(MKEntry *a, MKContext *mkctxt, MKLvContext *lvctxt, bool *isNullOut);
 static Datum tupsort_fetch_datum_itup(MKEntry *a, MKContext *mkctxt, MKLvContext *lvctxt, bool *isNullOut);
@@ -497,6 +522,11 @@ static void tuplesort_limit_sort(Tuplesortstate_mk *state);
 
 static void tupsort_refcnt(void *vp, int ref); 
 
+static bool tuplesort_beyond_bound(Tuplesortstate_mk *state, MKEntry *e);
+static void tuplesort_drop_entry(Tuplesortstate_mk *state, MKEntry *e);
+static void tuplesort_write_run_entry(Tuplesortstate_mk *state, LogicalTape *lt, MKEntry *e);
+static void tuplesort_end_run(Tuplesortstate_mk *state);
+
 /* Declare the following as extern so that older dtrace will not complain */
 extern void inittapes_mk(Tuplesortstate_mk *state, const char* rwfile_prefix);
 extern void dumptuples_mk(Tuplesortstate_mk *state, bool alltuples);
@@ -660,6 +690,7 @@ create_mksort_context(
     mkctxt->cpfr = tupsort_cpfr;
     mkctxt->freeTup = freeTupleFn;
     mkctxt->estimatedExtraForPrep = 0;
+    mkctxt->inWorker = false;
 
     lc_guess_strxfrm_scaling_factor(&mkctxt->strxfrmScaleFactor, &mkctxt->strxfrmConstantFactor);
 
@@ -711,6 +742,8 @@ create_mksort_context(
                 else if (sinfo->fmgrinfo.fn_addr == bttextcmp)
                     sinfo->lvtype = MKLV_TYPE_TEXT;
             }
+            if (gp_mk_sort_normalized_keys && sinfo->lvtype == MKLV_TYPE_NONE)
+                tupsort_choose_normalized_key(sinfo);
         }
         else
         {
@@ -1247,6 +1280,11 @@ puttuple_common(Tuplesortstate_mk *state, MKEntry *e)
              * Insert the tuple into the heap
              */
             Assert(state->mkheap); 
+            if (tuplesort_beyond_bound(state, e))
+            {
+                tuplesort_drop_entry(state, e);
+                break;
+            }
             tuplesort_heap_insert(state, e);
             break;
         default:
@@ -1273,10 +1311,14 @@ tuplesort_performsort_mk(Tuplesortstate_mk *state)
              * We were able to accumulate all the tuples within the allowed
              * amount of memory.  Just qsort 'em and we're done.
              */
-            if(state->mkctxt.limit == 0)
-                mk_qsort(state->entries, state->entry_count, &state->mkctxt);
-            else
+            if(state->mkctxt.limit != 0)
                 tuplesort_limit_sort(state);
+            else if(gp_mksort_threads > 1 &&
+                    state->entry_count >= MK_PARALLEL_MIN_ENTRIES &&
+                    mk_qsort_parallel_ok(&state->mkctxt))
+                mk_qsort_parallel(state->entries, state->entry_count, &state->mkctxt, gp_mksort_threads);
+            else
+                mk_qsort(state->entries, state->entry_count, &state->mkctxt);
 
             state->pos.current = 0;
             state->pos.eof_reached = false;
@@ -1299,6 +1341,10 @@ tuplesort_performsort_mk(Tuplesortstate_mk *state)
 
             dumptuples_mk(state, true);
 
+            if (state->boundedSpill)
+                elog(DEBUG1, "bounded sort dropped " INT64_FORMAT " tuples instead of spilling them",
+                     state->boundDropped);
+
 #ifdef PRINT_SPILL_AND_MEMORY_MESSAGES
             elog(INFO, "Done tuple dump.  Mem peak is now %ld", (long)MemoryContextGetPeakSpace(state->sortcontext));
 #endif // PRINT_SPILL_AND_MEMORY_MESSAGES
@@ -1790,6 +1836,15 @@ inittapes_mk(Tuplesortstate_mk *state, const char* rwfile_prefix)
     	 */
     	state->mkctxt.limitmask = 0;
 
+        /*
+         * A LIMIT sort over heap tuples can bound its runs.  Not for a shared
+         * sort, whose tapes are read by others.
+         */
+        state->boundedSpill = (gp_mk_sort_bounded_spill &&
+                               state->mkctxt.limit > 0 &&
+                               state->copytup == copytup_heap &&
+                               rwfile_prefix == NULL);
+
         state->mkheap = mkheap_from_array(state->entries, state->entry_allocsize, state->entry_count, &state->mkctxt);
         state->entries = NULL;
         state->entry_allocsize = 0;
@@ -2056,8 +2111,18 @@ mergeonerun_mk(Tuplesortstate_mk *state)
 
     Assert(state->mkheap);
 
+    /* A bounded sort needs no more than limit tuples of any merged run */
+    state->runTuples = 0;
     while (mkheap_putAndGet(state->mkheap, &e) >= 0)
+    {
+        if (state->boundedSpill && state->runTuples >= state->mkctxt.limit)
+        {
+            tuplesort_drop_entry(state, &e);
+            continue;
+        }
+        state->runTuples++;
         WRITETUP(state, lt, &e); 
+    }
 
     /*
      * When the heap empties, we're done.  Write an end-of-run marker on the
@@ -2320,11 +2385,7 @@ dumptuples_mk(Tuplesortstate_mk *state, bool alltuples)
     {
         if (mkheap_empty(state->mkheap)) 
         {
-            markrunend(state, state->tp_tapenum[state->destTape]);
-            state->currentRun++;
-            state->tp_runs[state->destTape]++;
-            state->tp_dummy[state->destTape]--; /* per Alg D step D2 */
-
+            tuplesort_end_run(state);
             break;
         }
 
@@ -2344,7 +2405,7 @@ dumptuples_mk(Tuplesortstate_mk *state, bool alltuples)
 
         Assert(!mke_is_empty(&e));
 
-        WRITETUP(state, lt, &e); 
+        tuplesort_write_run_entry(state, lt, &e);
 
         /*
          * If the heap is empty *or* top run number has changed, we've
@@ -2355,10 +2416,7 @@ dumptuples_mk(Tuplesortstate_mk *state, bool alltuples)
 #ifdef USE_ASSERT_CHECKING
             mkheap_verify_heap(state->mkheap, 0);
 #endif
-            markrunend(state, state->tp_tapenum[state->destTape]);
-            state->currentRun++;
-            state->tp_runs[state->destTape]++;
-            state->tp_dummy[state->destTape]--; /* per Alg D step D2 */
+            tuplesort_end_run(state);
 
             if (trace_sort)
                 PG_TRACE3(tuplesort__dumptuples, state->entry_count, state->currentRun, state->destTape);
@@ -2964,6 +3022,8 @@ int tupsort_compare_datum(MKEntry *v1, MKEntry *v2, MKLvContext *lvctxt, MKConte
                 int result = (i1 < i2) ? -1 : ((i1 == i2) ? 0 : 1);
                 return (lvctxt->sortfnkind == SORTFUNC_CMP) ? result : -result;
             }
+        case MKLV_TYPE_NORMKEY:
+            return tupsort_compare_normkey(v1, v2, lvctxt, context);
         default:
             return tupsort_compare_char(v1, v2, lvctxt, context);
     }
@@ -3103,6 +3163,270 @@ static int tupsort_compare_char(MKEntry *v1, MKEntry *v2, MKLvContext *lvctxt, M
     return (lvctxt->sortfnkind == SORTFUNC_CMP) ? result : -result;
 }
 
+/*
+ * Normalized keys.
+ *
+ * A level whose cmp function is one of a few built-in ones can be
+ * prepared into an unsigned 64-bit key that sorts like the datum, so most
+ * comparisons are a single integer compare instead of an fmgr call.  Keys
+ * of integers, floats, dates, timestamps and oids are exact.  Numeric keys
+ * hold the weight and first digits, and text keys (C locale only, where
+ * text compares bytewise) the first eight bytes; on equal lossy keys the
+ * original datums are fetched again and compared by the cmp function.
+ */
+#define MK_NORMKEY_SIGN_BIT		(UINT64CONST(1) << 63)
+
+static inline uint64
+mk_normalize_signed(int64 v)
+{
+    return ((uint64) v) ^ MK_NORMKEY_SIGN_BIT;
+}
+
+static inline uint64
+mk_normalize_double(double v)
+{
+    uint64 bits;
+
+    /* The cmp functions sort NaN above everything and treat -0 as 0 */
+    if (isnan(v))
+        return ~UINT64CONST(0);
+    if (v == 0.0)
+        v = 0.0;
+
+    memcpy(&bits, &v, sizeof(bits));
+    return (bits & MK_NORMKEY_SIGN_BIT) ? ~bits : (bits | MK_NORMKEY_SIGN_BIT);
+}
+
+static uint64
+mk_normalize_int2(Datum d)
+{
+    return mk_normalize_signed(DatumGetInt16(d));
+}
+
+static uint64
+mk_normalize_int8(Datum d)
+{
+    return mk_normalize_signed(DatumGetInt64(d));
+}
+
+static uint64
+mk_normalize_oid(Datum d)
+{
+    return (uint64) DatumGetObjectId(d);
+}
+
+static uint64
+mk_normalize_float4(Datum d)
+{
+    return mk_normalize_double((double) DatumGetFloat4(d));
+}
+
+static uint64
+mk_normalize_float8(Datum d)
+{
+    return mk_normalize_double(DatumGetFloat8(d));
+}
+
+static uint64
+mk_normalize_date(Datum d)
+{
+    return mk_normalize_signed(DatumGetDateADT(d));
+}
+
+static uint64
+mk_normalize_timestamp(Datum d)
+{
+#ifdef HAVE_INT64_TIMESTAMP
+    return mk_normalize_signed(DatumGetTimestamp(d));
+#else
+    return mk_normalize_double(DatumGetTimestamp(d));
+#endif
+}
+
+/*
+ * Numeric key: 2 bits of class (negative, zero, positive, NaN), then for
+ * nonzero values the biased weight and the first three base-10000 digits,
+ * inverted for negative values.
+ */
+#define MK_NUMERIC_DIGITS		3
+#define MK_NUMERIC_DIGIT_BITS	14
+#define MK_NUMERIC_PAYLOAD_BITS	(16 + MK_NUMERIC_DIGITS * MK_NUMERIC_DIGIT_BITS)
+
+static uint64
+mk_normalize_numeric(Datum d)
+{
+    char *p;
+    void *tofree = NULL;
+    int len;
+    int16 weight;
+    uint16 sign_dscale;
+    int ndigits;
+    int i;
+    uint64 payload;
+    uint64 result;
+
+    varattrib_untoast_ptr_len(d, &p, &len, &tofree);
+
+    /* p may be unaligned if the datum has a short header */
+    memcpy(&weight, p, sizeof(int16));
+    memcpy(&sign_dscale, p + sizeof(int16), sizeof(uint16));
+    ndigits = (len - (int) (sizeof(int16) + sizeof(uint16))) / sizeof(int16);
+
+    payload = (uint64) (uint16) (weight + 0x8000);
+    for (i = 0; i < MK_NUMERIC_DIGITS; i++)
+    {
+        int16 digit = 0;      /* a NumericDigit, 0 .. NBASE-1 */
+
+        if (i < ndigits)
+            memcpy(&digit, p + sizeof(int16) + sizeof(uint16) + i * sizeof(int16), sizeof(int16));
+        payload = (payload << MK_NUMERIC_DIGIT_BITS) | (uint64) digit;
+    }
+
+    if ((sign_dscale & NUMERIC_SIGN_MASK) == NUMERIC_POS)
+        result = ndigits == 0 ? (UINT64CONST(1) << 62) : ((UINT64CONST(2) << 62) | payload);
+    else if ((sign_dscale & NUMERIC_SIGN_MASK) == NUMERIC_NEG)
+        result = ~payload & ((UINT64CONST(1) << MK_NUMERIC_PAYLOAD_BITS) - 1);
+    else
+        result = ~UINT64CONST(0);
+
+    if (tofree)
+        pfree(tofree);
+
+    return result;
+}
+
+static uint64
+mk_normalize_text(Datum d)
+{
+    char *p;
+    void *tofree = NULL;
+    int len;
+    int i;
+    uint64 result = 0;
+
+    varattrib_untoast_ptr_len(d, &p, &len, &tofree);
+
+    /* Text has no zero bytes, so padding a short string with zeros keeps the order */
+    for (i = 0; i < (int) sizeof(uint64); i++)
+        result = (result << 8) | (i < len ? (uint64) (unsigned char) p[i] : 0);
+
+    if (tofree)
+        pfree(tofree);
+
+    return result;
+}
+
+static void
+tupsort_choose_normalized_key(MKLvContext *sinfo)
+{
+    PGFunction fn = sinfo->fmgrinfo.fn_addr;
+
+    if (sinfo->sortfnkind != SORTFUNC_CMP && sinfo->sortfnkind != SORTFUNC_REVCMP)
+        return;
+
+    sinfo->normLossy = false;
+
+    if (fn == btint2cmp)
+        sinfo->normalize = mk_normalize_int2;
+    else if (fn == btint8cmp)
+        sinfo->normalize = mk_normalize_int8;
+    else if (fn == btoidcmp)
+        sinfo->normalize = mk_normalize_oid;
+    else if (fn == btfloat4cmp)
+        sinfo->normalize = mk_normalize_float4;
+    else if (fn == btfloat8cmp)
+        sinfo->normalize = mk_normalize_float8;
+    else if (fn == date_cmp)
+        sinfo->normalize = mk_normalize_date;
+    else if (fn == timestamp_cmp)
+        sinfo->normalize = mk_normalize_timestamp;
+    else if (fn == numeric_cmp)
+    {
+        sinfo->normalize = mk_normalize_numeric;
+        sinfo->normLossy = true;
+    }
+    else if (fn == bttextcmp && lc_collate_is_c())
+    {
+        sinfo->normalize = mk_normalize_text;
+        sinfo->normLossy = true;
+    }
+    else
+        return;
+
+    sinfo->lvtype = MKLV_TYPE_NORMKEY;
+
+    /* The prepared datum is now the key itself, which cpfr must not copy as a pointer */
+    sinfo->typByVal = true;
+}
+
+static int tupsort_compare_normkey(MKEntry *v1, MKEntry *v2, MKLvContext *lvctxt, MKContext *mkContext)
+{
+    uint64 k1 = (uint64) v1->d;
+    uint64 k2 = (uint64) v2->d;
+    int result;
+
+    Assert(!mke_is_null(v1));
+    Assert(!mke_is_null(v2));
+
+    if (k1 != k2)
+        result = (k1 < k2) ? -1 : 1;
+    else if (!lvctxt->normLossy)
+        result = 0;
+    else
+    {
+        /* Only the prefixes were equal, so compare the original values */
+        Datum d1, d2;
+        bool isnull1, isnull2;
+
+        d1 = (mkContext->fetchForPrep)(v1, mkContext, lvctxt, &isnull1);
+        d2 = (mkContext->fetchForPrep)(v2, mkContext, lvctxt, &isnull2);
+
+        Assert(!isnull1);
+        Assert(!isnull2);
+
+        return inlineApplySortFunction(&lvctxt->fmgrinfo, lvctxt->sortfnkind,
+                d1, false, d2, false);
+    }
+
+    return (lvctxt->sortfnkind == SORTFUNC_CMP) ? result : -result;
+}
+
+/*
+ * Compare two entries on all levels.  Each level is prepared on a private
+ * copy, so the entries and whatever level they are prepared at are left alone.
+ */
+int tupsort_compare_entries(MKEntry *a, MKEntry *b, MKContext *mkctxt)
+{
+    MKEntry aa = *a;
+    MKEntry bb = *b;
+    int lv;
+    int c = 0;
+
+    Assert(mkctxt->fetchForPrep);
+
+    mke_clear_refc_copied(&aa);
+    mke_clear_refc_copied(&bb);
+
+    for (lv = 0; lv < mkctxt->total_lv; lv++)
+    {
+        MKLvContext *lvctxt = mkctxt->lvctxt + lv;
+
+        tupsort_prepare(&aa, mkctxt, lv);
+        tupsort_prepare(&bb, mkctxt, lv);
+
+        c = mke_get_nullbits(&aa) - mke_get_nullbits(&bb);
+        if (c == 0 && !mke_is_null(&aa))
+            c = tupsort_compare_datum(&aa, &bb, lvctxt, mkctxt);
+        if (c != 0)
+            break;
+    }
+
+    tupsort_cpfr(&aa, NULL, NULL);
+    tupsort_cpfr(&bb, NULL, NULL);
+
+    return c;
+}
+
 static int32 estimateMaxPrepareSizeForEntry(MKEntry *a, struct MKContext *mkContext)
 {
 	int result = 0;
@@ -3175,6 +3499,8 @@ void tupsort_prepare(MKEntry *a, MKContext *mkctxt, int lv)
         tupsort_prepare_char(a, true);
     else if (lvctxt->lvtype == MKLV_TYPE_TEXT)
         tupsort_prepare_char(a, false);
+    else if (lvctxt->lvtype == MKLV_TYPE_NORMKEY && !isnull)
+        a->d = (Datum) (lvctxt->normalize)(a->d);
 }
 
 /* "True" length (not counting trailing blanks) of a BpChar */
@@ -3483,20 +3809,106 @@ static void tuplesort_heap_insert(Tuplesortstate_mk *state, MKEntry *e)
     {
         LogicalTape *lt = LogicalTapeSetGetTape(state->tapeset, state->tp_tapenum[state->destTape]);
 
-        WRITETUP(state, lt, e);
+        tuplesort_write_run_entry(state, lt, e);
 
         if(!mkheap_run_match(state->mkheap, state->currentRun))
         {
-            markrunend(state, state->tp_tapenum[state->destTape]);
-            state->currentRun++;
-            state->tp_runs[state->destTape]++;
-            state->tp_dummy[state->destTape]--;
-
+            tuplesort_end_run(state);
             selectnewtape_mk(state);
         }
     }
 }
 
+/*
+ * Write the next tuple of the run being built.  A bounded sort drops it
+ * instead if the run already has limit tuples or the tuple sorts after
+ * the bound, and makes the limit-th tuple of the run the new bound if it
+ * is below the current one.
+ */
+static void tuplesort_write_run_entry(Tuplesortstate_mk *state, LogicalTape *lt, MKEntry *e)
+{
+    if (state->boundedSpill)
+    {
+        if (state->runTuples >= state->mkctxt.limit || tuplesort_beyond_bound(state, e))
+        {
+            tuplesort_drop_entry(state, e);
+            return;
+        }
+
+        if (++state->runTuples == state->mkctxt.limit &&
+            (!state->hasBound || tupsort_compare_entries(e, &state->boundEntry, &state->mkctxt) < 0))
+        {
+            uint32 tuplen = memtuple_get_size((MemTuple) e->ptr, NULL);
+            MemoryContext oldcontext = MemoryContextSwitchTo(state->sortcontext);
+
+            if (state->hasBound)
+            {
+                tupsort_cpfr(&state->boundEntry, NULL, NULL);
+                pfree(state->boundEntry.ptr);
+            }
+            mke_blank(&state->boundEntry);
+            state->boundEntry.ptr = palloc(tuplen);
+            memcpy(state->boundEntry.ptr, e->ptr, tuplen);
+            tupsort_prepare(&state->boundEntry, &state->mkctxt, 0);
+            state->hasBound = true;
+
+            MemoryContextSwitchTo(oldcontext);
+        }
+    }
+
+    WRITETUP(state, lt, e);
+}
+
+/*
+ * Close the run being built and count it on its tape.
+ */
+static void tuplesort_end_run(Tuplesortstate_mk *state)
+{
+    markrunend(state, state->tp_tapenum[state->destTape]);
+    state->currentRun++;
+    state->tp_runs[state->destTape]++;
+    state->tp_dummy[state->destTape]--; /* per Alg D step D2 */
+    state->runTuples = 0;
+}
+
+/*
+ * Does e sort after the bound?  This is asked of every tuple once a bound
+ * is set, so e is only prepared at level 0 (on a private copy, as in
+ * tupsort_compare_entries()), where the bound is kept prepared.  Only a tie
+ * there takes a comparison on all levels.
+ */
+static bool tuplesort_beyond_bound(Tuplesortstate_mk *state, MKEntry *e)
+{
+    MKContext *mkctxt = &state->mkctxt;
+    MKEntry ee;
+    int c;
+
+    if (!state->hasBound)
+        return false;
+
+    ee = *e;
+    mke_clear_refc_copied(&ee);
+    tupsort_prepare(&ee, mkctxt, 0);
+
+    c = mke_get_nullbits(&ee) - mke_get_nullbits(&state->boundEntry);
+    if (c == 0 && !mke_is_null(&ee))
+        c = tupsort_compare_datum(&ee, &state->boundEntry, mkctxt->lvctxt, mkctxt);
+
+    tupsort_cpfr(&ee, NULL, NULL);
+
+    if (c == 0)
+        c = tupsort_compare_entries(e, &state->boundEntry, mkctxt);
+
+    return c > 0;
+}
+
+static void tuplesort_drop_entry(Tuplesortstate_mk *state, MKEntry *e)
+{
+    tupsort_cpfr(e, NULL, &state->mkctxt.lvctxt[mke_get_lv(e)]);
+    state->mkctxt.freeTup(e);
+    state->boundDropped++;
+}
+
 static void tuplesort_limit_sort(Tuplesortstate_mk *state)
 {
     Assert(state->mkctxt.limit > 0);
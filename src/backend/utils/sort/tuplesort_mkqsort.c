@@ -15,6 +15,7 @@
 #include "utils/tuplesort_mk.h"
 
 #include "miscadmin.h"
+#include "cdb/workermgr.h"
 
 #ifdef MKQSORT_VERIFY 
 extern void mkqsort_verify(MKEntry *a, int l, int r, MKContext *mkctxt);
@@ -259,7 +260,8 @@ void mk_qsort_impl(MKEntry *a, int left, int right, int lv, bool lvdown, MKConte
 	Assert(ctxt);
 	Assert(lv < ctxt->total_lv);
 
-    CHECK_FOR_INTERRUPTS();
+	if (!ctxt->inWorker)
+		CHECK_FOR_INTERRUPTS();
 
 	if(right <= left)
 		return;
@@ -325,6 +327,256 @@ void mk_qsort_impl(MKEntry *a, int left, int right, int lv, bool lvdown, MKConte
 #endif
 }
 
+/*
+ * Parallel sort.
+ *
+ * The array is cut into one chunk per thread, the chunks are sorted
+ * concurrently by mk_qsort_impl, and the sorted runs are then merged
+ * pairwise, log2(nthreads) rounds, through a scratch array.  Within a
+ * round every merge is itself split among the threads at merge-path
+ * boundaries, so the last round, which merges half the array with the
+ * other half, is not left to a single thread.
+ *
+ * Threads cannot palloc, elog or call fmgr, so this is only done when
+ * every level is an int32 fetched by value from the tuple, and without
+ * unique or limit processing (see mk_qsort_parallel_ok).  On such levels
+ * tupsort_compare_entries(), which the merges use, neither allocates nor
+ * frees.
+ */
+typedef struct MKSortTask
+{
+	MKContext	ctxt;			/* private copy, with inWorker set */
+	MKEntry    *a;
+	int			left;
+	int			right;
+} MKSortTask;
+
+typedef struct MKMergeTask
+{
+	MKContext  *ctxt;
+	MKEntry    *a;				/* first run */
+	int			na;
+	MKEntry    *b;				/* second run, which follows the first */
+	int			nb;
+	MKEntry    *out;			/* merged output of na + nb entries */
+	int			kbegin;			/* this task produces out[kbegin, kend) */
+	int			kend;
+} MKMergeTask;
+
+bool
+mk_qsort_parallel_ok(MKContext *ctxt)
+{
+	int			lv;
+
+	if (ctxt->fetchForPrep == NULL || ctxt->limit != 0 ||
+		ctxt->unique || ctxt->enforceUnique)
+		return false;
+
+	for (lv = 0; lv < ctxt->total_lv; lv++)
+	{
+		if (ctxt->lvctxt[lv].lvtype != MKLV_TYPE_INT32)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * How many of the first k merged entries come from a?  Ties go to a, so
+ * the merge is stable.
+ */
+static int
+mk_merge_corank(MKMergeTask *task, int k)
+{
+	int			lo = Max(0, k - task->nb);
+	int			hi = Min(k, task->na);
+
+	while (lo < hi)
+	{
+		int			i = lo + (hi - lo) / 2;
+		int			j = k - i;
+
+		if (j > 0 && tupsort_compare_entries(task->a + i, task->b + j - 1, task->ctxt) <= 0)
+			lo = i + 1;
+		else
+			hi = i;
+	}
+
+	return lo;
+}
+
+static void
+mk_sort_task_run(Task task, struct WorkerMgrState *state)
+{
+	MKSortTask *sortTask = (MKSortTask *) task;
+
+	mk_qsort_impl(sortTask->a, sortTask->left, sortTask->right, 0, true, &sortTask->ctxt, false);
+}
+
+static void
+mk_merge_task_run(Task task, struct WorkerMgrState *state)
+{
+	MKMergeTask *mergeTask = (MKMergeTask *) task;
+	int			i = mk_merge_corank(mergeTask, mergeTask->kbegin);
+	int			iend = mk_merge_corank(mergeTask, mergeTask->kend);
+	int			j = mergeTask->kbegin - i;
+	int			jend = mergeTask->kend - iend;
+	MKEntry    *out = mergeTask->out + mergeTask->kbegin;
+
+	while (i < iend && j < jend)
+	{
+		if (tupsort_compare_entries(mergeTask->a + i, mergeTask->b + j, mergeTask->ctxt) <= 0)
+			*out++ = mergeTask->a[i++];
+		else
+			*out++ = mergeTask->b[j++];
+	}
+	while (i < iend)
+		*out++ = mergeTask->a[i++];
+	while (j < jend)
+		*out++ = mergeTask->b[j++];
+}
+
+/*
+ * Run the tasks on nthreads threads.  Returns false, having run nothing,
+ * if the threads could not be started.
+ */
+static bool
+mk_run_tasks(List *tasks, int nthreads, WorkerMgrTaskCallback func)
+{
+	struct WorkerMgrState *state = workermgr_create_workermgr_state(nthreads);
+	bool		ok = workermgr_submit_job(state, tasks, func);
+
+	if (ok)
+		workermgr_wait_job(state);
+	workermgr_free_workermgr_state(state);
+
+	return ok;
+}
+
+void
+mk_qsort_parallel(MKEntry *a, int n, MKContext *ctxt, int nthreads)
+{
+	MKEntry    *src = a;
+	MKEntry    *dst;
+	int		   *bounds;
+	int			nruns;
+	int			i;
+	List	   *tasks = NIL;
+
+	Assert(mk_qsort_parallel_ok(ctxt));
+
+	nthreads = Min(nthreads, n);
+	if (nthreads <= 1)
+	{
+		mk_qsort(a, n, ctxt);
+		return;
+	}
+
+	/* Cut the array into runs, bounds[i] .. bounds[i+1]-1 */
+	nruns = nthreads;
+	bounds = (int *) palloc((nruns + 1) * sizeof(int));
+	for (i = 0; i <= nruns; i++)
+		bounds[i] = (int) ((int64) n * i / nruns);
+
+	for (i = 0; i < nruns; i++)
+	{
+		MKSortTask *task = (MKSortTask *) palloc(sizeof(MKSortTask));
+
+		task->ctxt = *ctxt;
+		task->ctxt.inWorker = true;
+		task->a = a;
+		task->left = bounds[i];
+		task->right = bounds[i + 1] - 1;
+		tasks = lappend(tasks, task);
+	}
+
+	if (!mk_run_tasks(tasks, nthreads, mk_sort_task_run))
+	{
+		elog(LOG, "could not start %d sort threads, sorting serially", nthreads);
+		list_free_deep(tasks);
+		pfree(bounds);
+		mk_qsort(a, n, ctxt);
+		return;
+	}
+	list_free_deep(tasks);
+	tasks = NIL;
+
+	CHECK_FOR_INTERRUPTS();
+
+	dst = (MKEntry *) palloc(n * sizeof(MKEntry));
+
+	/* Merge neighbouring runs until one is left */
+	while (nruns > 1)
+	{
+		int			npairs = nruns / 2;
+		int			splits = Max(1, nthreads / npairs);
+		int			r;
+
+		for (r = 0; r + 1 < nruns; r += 2)
+		{
+			int			first = bounds[r];
+			int			na = bounds[r + 1] - first;
+			int			nb = bounds[r + 2] - bounds[r + 1];
+			int			s;
+
+			for (s = 0; s < splits; s++)
+			{
+				MKMergeTask *task = (MKMergeTask *) palloc(sizeof(MKMergeTask));
+
+				task->ctxt = ctxt;
+				task->a = src + first;
+				task->na = na;
+				task->b = src + bounds[r + 1];
+				task->nb = nb;
+				task->out = dst + first;
+				task->kbegin = (int) ((int64) (na + nb) * s / splits);
+				task->kend = (int) ((int64) (na + nb) * (s + 1) / splits);
+				tasks = lappend(tasks, task);
+			}
+		}
+
+		/* An odd run out is carried over as it is */
+		if (nruns % 2 != 0)
+			memcpy(dst + bounds[nruns - 1], src + bounds[nruns - 1],
+				   (n - bounds[nruns - 1]) * sizeof(MKEntry));
+
+		if (!mk_run_tasks(tasks, nthreads, mk_merge_task_run))
+		{
+			ListCell   *lc;
+
+			elog(LOG, "could not start %d sort threads, merging serially", nthreads);
+			foreach(lc, tasks)
+				mk_merge_task_run(lfirst(lc), NULL);
+		}
+		list_free_deep(tasks);
+		tasks = NIL;
+
+		CHECK_FOR_INTERRUPTS();
+
+		/* Runs 2r and 2r+1 are now run r */
+		for (r = 0; r < nruns; r += 2)
+			bounds[r / 2] = bounds[r];
+		nruns = (nruns + 1) / 2;
+		bounds[nruns] = n;
+
+		{
+			MKEntry    *tmp = src;
+
+			src = dst;
+			dst = tmp;
+		}
+	}
+
+	if (src != a)
+	{
+		memcpy(a, src, n * sizeof(MKEntry));
+		pfree(src);
+	}
+	else
+		pfree(dst);
+	pfree(bounds);
+}
+
 #ifdef MKQSORT_VERIFY 
 static int mkqsort_comp_entry_all_lv(MKEntry *a, MKEntry *b, MKContext *mkctxt)
 {
@@ -84,6 +84,10 @@ typedef struct ColumnChunkMetadata_4C
 	int64_t file_offset;
 
 	int64_t firstDataPage;
+
+	/* Byte offset to the dictionary page, 0 if chunk is not dictionary encoded */
+	int64_t dictionaryPageOffset;
+
 	long valueCount;
 
     /* total byte size of all compressed pages in this column chunk (including the headers) */
@@ -92,6 +96,16 @@ typedef struct ColumnChunkMetadata_4C
     /* total byte size of all uncompressed pages in this column chunk (including the headers) */
 	int64_t totalUncompressedSize;
 
+	/* statistics of this column chunk, other fields are valid only if hasStatistics */
+	bool hasStatistics;
+	int64_t nullCount;
+
+	/* PLAIN encoded min/max value, NULL if not collected for the type or all values are null */
+	uint8_t *minValue;
+	int32_t minValueLen;
+	uint8_t *maxValue;
+	int32_t maxValueLen;
+
 } ColumnChunkMetadata_4C;
 
 /* rowgroup metadata */
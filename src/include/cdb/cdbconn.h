@@ -13,6 +13,7 @@
 
 #include "gp-libpq-fe.h"               /* prerequisite for libpq-int.h */
 #include "gp-libpq-int.h"              /* PQExpBufferData */
+#include "cdb/cdbsrlz.h"                /* SERIALIZED_CACHE_MAX_SLOTS */
 
 
 /* --------------------------------------------------------------------------------------------------
@@ -51,6 +52,13 @@ typedef struct SegmentDatabaseDescriptor
     int4		            motionListener; /* interconnect listener port */
     int4					backendPid;
     char                   *whoami;         /* QE identifier for msgs */
+
+    /*
+     * Generation of the plan the QE holds in each slot of its plan cache, or
+     * 0; see serializeNodeCached().  Set once the QE has finished a query it
+     * was sent the plan with, cleared on any error of the QE.
+     */
+    uint64                  planCacheGeneration[SERIALIZED_CACHE_MAX_SLOTS];
 } SegmentDatabaseDescriptor;
 
 
@@ -19,6 +19,8 @@
 #include "cdb/dispatcher.h"
 
 struct DispatchExecutors;
+struct WorkerMgrState;
+struct CdbCopySendTask;
 
 #define COPYOUT_CHUNK_SIZE 16 * 1024
 
@@ -55,6 +57,16 @@ typedef struct CdbCopy
 	PartitionNode *partitions;
 	List		  *ao_segnos;
 	HTAB		  *aotupcounts; /* hash of ao relation id to processed tuple count */
+
+	/*
+	 * COPY FROM data is batched per segment (gp_copy_dispatch_batch_size),
+	 * and a full batch is sent by a worker thread while the next rows are
+	 * parsed. At most one batch is in flight at a time.
+	 */
+	StringInfoData *send_bufs;		/* rows not yet sent, per segment */
+	struct CdbCopySendTask *send_task;	/* batch handed to the worker */
+	struct WorkerMgrState *send_state;
+	bool		send_pending;		/* send_task is still being sent */
 } CdbCopy;
 
 
@@ -67,5 +79,6 @@ void		cdbCopySendData(CdbCopy *c, int target_seg, const char *buffer, int nbytes
 void		cdbCopySendDataSingle(CdbCopy *c, int target_seg, const char *buffer, int nbytes);
 bool		cdbCopyGetData(CdbCopy *c, bool cancel, uint64 *rows_processed);
 int			cdbCopyEnd(CdbCopy *c);
+void		AtAbort_CdbCopy(void);
 
 #endif   /* CDBCOPY_H */
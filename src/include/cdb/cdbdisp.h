@@ -36,6 +36,9 @@ typedef struct DispatchCommandQueryParms
 	int			serializedQuerytreelen;
 	char		*serializedPlantree;
 	int			serializedPlantreelen;
+	/* sent instead of the plan to qExecs that hold it in their plan cache */
+	char		*serializedPlantreeRef;
+	int			serializedPlantreeReflen;
 	char		*serializedParams;
 	int			serializedParamslen;
 	char		*serializedSliceInfo;
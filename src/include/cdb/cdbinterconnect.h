@@ -399,6 +399,25 @@ typedef struct MotionNodeEntry
 	 */
 	htup_fifo       ready_tuples;
 
+	/*
+	 * Batches of tuples waiting to be sent when gp_motion_batch_size > 1,
+	 * one per route plus one for broadcasts; NULL until the first one is
+	 * needed.  Their size is bounded, see MOTION_BATCHES_MAX_BYTES.
+	 */
+	SerTupBatch    *send_batches;
+	int             num_send_batches;
+	int             send_batches_bytes;	/* bytes of values in them */
+
+	/*
+	 * Payload compression when gp_motion_compress_level > 0: the bytes seen
+	 * over the current window of attempts, and whether compression has been
+	 * turned off for this node because it didn't save enough.
+	 */
+	int             compress_window_attempts;
+	uint64          compress_window_raw_bytes;
+	uint64          compress_window_bytes;
+	bool            compress_disabled;
+
 	/*
 	 * Variable that records the total number of senders to this motion node.
 	 * This is expected to always be (number of qExecs).
@@ -424,6 +443,8 @@ typedef struct MotionNodeEntry
 	uint64          stat_total_chunks_sent; /* Tuple-chunks sent. */
 	uint64          stat_total_bytes_sent;  /* Bytes sent, including headers. */
 	uint64          stat_tuple_bytes_sent;  /* Bytes of pure tuple-data sent. */
+	uint64          stat_compress_raw_bytes;	/* Tuple-data bytes compressed, */
+	uint64          stat_compress_bytes;	/* and what they compressed to. */
 
 	uint64          stat_total_chunks_recvd;                /* Tuple-chunks received. */
 	uint64          stat_total_bytes_recvd; /* Bytes received, including headers. */
@@ -510,6 +531,12 @@ typedef struct ChunkTransportState
 	TupleChunkListItem (*RecvTupleChunkFromAny)(MotionLayerState *mlStates, struct ChunkTransportState *transportStates, int16 motNodeID, int16 *srcRoute);
 	void (*doSendStopMessage)(struct ChunkTransportState *transportStates, int16 motNodeID);
 	void (*SendEos)(MotionLayerState *mlStates, struct ChunkTransportState *transportStates, int motNodeID, TupleChunkListItem tcItem);
+
+	/*
+	 * Send whatever SendChunk deferred, called at the end of each send call.
+	 * NULL if the transport sends right away.
+	 */
+	void (*FlushChunks)(struct ChunkTransportState *transportStates);
 } ChunkTransportState;
 
 extern void dumpICBufferList(ICBufferList *list, const char *fname);
@@ -12,6 +12,7 @@
 #define CDBMOTION_H
 
 #include "access/htup.h"
+#include "executor/tuptable.h"
 #include "cdb/htupfifo.h"
 #include "cdb/cdbselect.h"
 #include "cdb/cdbinterconnect.h"
@@ -102,6 +103,16 @@ extern SendReturnCode SendTuple(MotionLayerState *mlStates,
 								HeapTuple tuple,
 								int16 targetRoute);
 
+/* Like SendTuple(), but adds the tuple in slot to the columnar batch of
+ * targetRoute, which is sent when it holds gp_motion_batch_size tuples or
+ * at end-of-stream.
+ */
+extern SendReturnCode SendTupleSlot(MotionLayerState *mlStates,
+									ChunkTransportState *transportStates,
+									int16 motNodeID,
+									TupleTableSlot *slot,
+									int16 targetRoute);
+
 
 /* Send or broadcast an END_OF_STREAM token to the corresponding motion-node
  * on other segments.
@@ -39,6 +39,13 @@ typedef struct ParquetScanDescData {
 	/*the projection of columns, which column need to be scanned*/
 	bool 				*proj;
 
+	/*
+	 * scan keys derived from the scan's quals, used to skip row groups
+	 * by column chunk statistics
+	 */
+	ScanKey				pqs_scanKeys;
+	int					pqs_numScanKeys;
+
 	/* synthetic system attributes */
 	ItemPointerData 	cdb_fake_ctid;
 	int64 				cur_seg_row;
@@ -118,7 +125,8 @@ extern ParquetScanDesc parquet_beginscan(
 		Relation relation,
 		Snapshot parquetMetaDataSnapshot,
 		TupleDesc relationTupleDesc,
-		bool *proj);
+		bool *proj,
+		List *qual);
 
 extern void parquet_rescan(
 		ParquetScanDesc scan);
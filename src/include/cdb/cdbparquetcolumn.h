@@ -12,6 +12,9 @@
 
 #define DAFAULT_DATAPAGE_NUM_PER_COLUMNCHUNK 10
 
+/* number of values decoded at a time by ParquetColumnReader_readBatch */
+#define PARQUET_READ_BATCH_SIZE 1024
+
 /*
  * we call it CurrentDefinitionLevel because definition level is used to
  * determine whether the current value is null, the MACRO is used before
@@ -43,7 +46,9 @@ typedef struct ParquetColumnReader
 
     /*
      * dataBuffer stores column chunk's raw data read from file.
-     * This buffer is reused accross multiple row group.
+     * This buffer is reused accross multiple row group. It is not used for
+     * a chunk read as part of a coalesced range, whose pages point into the
+     * row group reader's buffer of that range instead.
      */
 	char 							*dataBuffer;
 	int32							dataLen;
@@ -62,18 +67,66 @@ typedef struct ParquetColumnReader
     char                            *pageBuffer;
     int32                           pageBufferLen;
 
+    /*
+     * Dictionary page of current column chunk, `dictionaryPage.header` is
+     * NULL if the chunk is not dictionary encoded. The page is decoded into
+     * `dictionary` when the first dictionary encoded value is read. Entries
+     * of varlena types point into `dictionaryBuffer` (compressed chunk) or
+     * `dataBuffer` (uncompressed chunk).
+     */
+    struct ParquetDataPage_S        dictionaryPage;
+    Datum                           *dictionary;
+    int                             dictionarySize;
+    int                             dictionaryCapacity;
+    char                            *dictionaryBuffer;
+    int32                           dictionaryBufferLen;
+
 	/*buffer reused for embedded type, avoid palloc each time for each tuple*/
     void                            *geoval;
+
+    /*
+     * Values decoded by ParquetColumnReader_readBatch, consumed one by one
+     * by ParquetRowGroupReader_ScanNextTuple. `levelBuffer` is scratch space
+     * for definition levels of a batch.
+     */
+    Datum                           *batchValues;
+    bool                            *batchNulls;
+    int                             *levelBuffer;
+    int                             batchCount;
+    int                             batchPos;
+
+    /* number of values to skip before reading next value */
+    int                             skipCount;
 } ParquetColumnReader;
 
 
+extern int64 ParquetColumnChunkOffset(
+		struct ColumnChunkMetadata_4C *columnChunkMetadata);
+
+extern void ParquetExecutorReadFileRange(
+		File file,
+		int64 offset,
+		char *buffer,
+		int64 length,
+		const char *colName);
+
 extern void ParquetExecutorReadColumn(
 		ParquetColumnReader *columnReaders,
-		File file);
+		File file,
+		char *chunkData);
 
 extern void ParquetColumnReader_readValue(ParquetColumnReader *columnReader,
 		Datum *value, bool *null, int hawqTypeID);
 
+extern bool ParquetColumnReader_canReadBatch(ParquetColumnReader *columnReader,
+		int hawqTypeID);
+
+extern int ParquetColumnReader_readBatch(ParquetColumnReader *columnReader,
+		Datum *values, bool *nulls, int count, int hawqTypeID);
+
+extern void ParquetColumnReader_skipValues(ParquetColumnReader *columnReader,
+		int count, int hawqTypeID);
+
 extern void ParquetColumnReader_readPoint(ParquetColumnReader readers[], Datum *value, bool *null);
 extern void ParquetColumnReader_readLSEG(ParquetColumnReader readers[], Datum *value, bool *null);
 extern void ParquetColumnReader_readPATH(ParquetColumnReader readers[], Datum *value, bool *null);
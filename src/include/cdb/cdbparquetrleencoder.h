@@ -155,4 +155,9 @@ extern void RLEDecoder_Init(RLEDecoder *decoder, int bitWidth, uint8_t *in, int
 
 extern int  RLEDecoder_ReadInt(RLEDecoder *decoder);
 
+/*
+ * Read `count` values into `values`, a whole run is copied at a time.
+ */
+extern void RLEDecoder_ReadInts(RLEDecoder *decoder, int *values, int count);
+
 #endif /* CDBPARQUETRLEENCODER_H_ */
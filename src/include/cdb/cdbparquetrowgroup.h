@@ -13,8 +13,17 @@
 #include "cdb/cdbparquetcolumn.h"
 #include "access/filesplit.h"
 #include "access/htup.h"
+#include "access/skey.h"
 #include "executor/tuptable.h"
 
+/*
+ * Projected column chunks separated by at most PARQUET_COALESCE_MAX_GAP
+ * bytes are read with one ranged read, up to PARQUET_COALESCE_MAX_SIZE
+ * bytes per range.
+ */
+#define PARQUET_COALESCE_MAX_GAP	(1024 * 1024)
+#define PARQUET_COALESCE_MAX_SIZE	(64 * 1024 * 1024)
+
 typedef struct ParquetRowGroupReader
 {
 	MemoryContext		memoryContext;
@@ -23,6 +32,19 @@ typedef struct ParquetRowGroupReader
 	int					rowRead;
 	ParquetColumnReader	*columnReaders;
 	int					columnReaderCount;
+	/*
+	 * Attributes evaluated against scan keys before other columns are
+	 * read, NULL if late materialization is not used.
+	 */
+	bool				*keyAttrs;
+	bool				keyAttrsInited;
+	/*
+	 * Buffers of coalesced reads, one per range of the row group, reused
+	 * accross row groups. The pages of the chunks in a range point into
+	 * its buffer, which is why a range is not copied to its column readers.
+	 */
+	char				**coalesceBuffers;
+	int64				*coalesceBufferLens;
 	/* synthetic system attributes */
 	ItemPointerData 	cdb_fake_ctid;
 } ParquetRowGroupReader;
@@ -38,7 +60,8 @@ ParquetRowGroupReader_Init(
 bool ParquetRowGroupReader_GetRowGroupInfo(
     FileSplit split, ParquetStorageRead *storageRead,
     ParquetRowGroupReader *rowGroupReader, bool *projs, TupleDesc hawqTupleDesc,
-    int *hawqAttrToParquetColChunks, bool toCloseFile);
+    int *hawqAttrToParquetColChunks, ScanKey scanKeys, int numScanKeys,
+    bool toCloseFile);
 
 /* Get contents of row group*/
 void
@@ -52,6 +75,8 @@ ParquetRowGroupReader_ScanNextTuple(
 	ParquetRowGroupReader 	*rowGroupReader,
 	int						*hawqAttrToParquetColNum,
 	bool 					*projs,
+	ScanKey					scanKeys,
+	int						numScanKeys,
 	TupleTableSlot 			*slot);
 
 /* Finish scanning current row group*/
@@ -98,6 +98,19 @@ struct ParquetDataPage_S
 	uint8_t						*values_buffer;
     int                         values_buffer_capacity; /* palloced size for values_buffer */
 
+	/*
+	 * For dictionary encoded page (header->encoding is PLAIN_DICTIONARY), values
+	 * are accumulated as indices into the column chunk's dictionary, and are
+	 * RLE/bitpack encoded when the page is finalized.
+	 */
+	int32_t						*dict_indices;
+	int							dict_indices_count;
+	int							dict_indices_capacity;
+	int32_t						dict_max_index;
+
+	/* For read, decodes dictionary indices of a dictionary encoded page */
+	RLEDecoder					*dict_indices_reader;
+
     /*
      * For write, this is the page data to write, may be compressed.
      * For read, this is the page data to read, may be decompressed.
@@ -145,6 +158,26 @@ struct ParquetColumnChunk_S
     char    					*compresstype;
     int     					compresslevel;
 
+	/*
+	 * Dictionary page of this column chunk, NULL if the column is not dictionary
+	 * encoded. Its values_buffer accumulates PLAIN encoded distinct values, and
+	 * its header->num_values is the number of dictionary entries.
+	 *
+	 * dictionaryOffsets records where each entry starts in values_buffer, and
+	 * dictionaryHash is an open addressing hash table over the entries, storing
+	 * entry index + 1 (0 for an empty slot).
+	 */
+	ParquetDataPage				dictionaryPage;
+	int							*dictionaryOffsets;
+	int							*dictionaryHash;
+	int							dictionaryHashSize;
+
+	/*
+	 * Set when the dictionary exceeds pageSizeLimit. Pages already encoded with
+	 * the dictionary are kept, new pages of the chunk fall back to PLAIN.
+	 */
+	bool						dictionaryFallback;
+
 	File 						parquetFile;
 };
 
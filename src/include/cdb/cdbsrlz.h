@@ -19,7 +19,26 @@
 extern char *WriteBackCatalogs;
 extern int32 WriteBackCatalogLen;
 
+/*
+ * Header of a serialized plan sent through the dispatcher's plan cache; see
+ * serializeNodeCached().  The kinds are negative, so they can't be mistaken
+ * for the uncompressed length that starts a plain serialized string.
+ */
+#define SERIALIZED_CACHE_STORE		(-1)	/* keep the string that follows */
+#define SERIALIZED_CACHE_REF		(-2)	/* use the string kept in slot */
+#define SERIALIZED_CACHE_MAX_SLOTS	64
+
+typedef struct SerializedCacheHeader
+{
+	int32		kind;
+	int32		slot;
+	uint64		generation;
+} SerializedCacheHeader;
+
 extern char *serializeNode(Node *node, int *size, int *uncompressed_size);
+extern char *serializeNodeCached(Node *node, int *size, int *uncompressed_size,
+								 SerializedCacheHeader *ref);
+extern const char *receiveSerializedCached(const char *strNode, int *size);
 extern Node *deserializeNode(const char *strNode, int size);
 
 #endif   /* CDBSRLZ_H */
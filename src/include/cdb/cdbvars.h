@@ -364,6 +364,25 @@ extern int	gp_connections_per_thread; /* GUC var - server operating mode.  */
 extern bool assign_gp_connections_per_thread(int newval, bool doit, GucSource source);
 extern const char *show_gp_connections_per_thread(void);
 
+/*
+ * Parameter gp_workermgr_idle_threads
+ *
+ * The threads that dispatch to qExecs, and the other worker manager threads,
+ * are kept in a per-backend pool and reused by later jobs.  This is the
+ * number of idle threads the pool keeps; 0 makes every thread exit when its
+ * task is done.
+ */
+extern int	gp_workermgr_idle_threads;
+
+/*
+ * Parameter gp_copy_dispatch_batch_size
+ *
+ * COPY FROM on the QD gathers the rows for each segment into batches of this
+ * many kilobytes, which a worker thread sends while the QD parses the next
+ * rows.  0 sends every row as soon as it is parsed.
+ */
+extern int	gp_copy_dispatch_batch_size;
+
 /*
  * If number of subtransactions within a transaction exceed this limit,
  * then a warning is given to the user.
@@ -437,6 +456,42 @@ extern const char *gpvars_show_gp_interconnect_fc_method(void);
  */
 extern int	Gp_interconnect_queue_depth;
 
+/*
+ * Parameter Gp_interconnect_rx_batch_size
+ *
+ * The maximum number of packets the receive thread of the
+ * UDP-interconnect gets with one recvmmsg() call, on platforms which
+ * have it. 1 means one recvfrom() per packet.
+ */
+extern int	Gp_interconnect_rx_batch_size;
+
+/*
+ * Parameter Gp_interconnect_tx_batch_size
+ *
+ * The maximum number of data packets the UDP-interconnect sends with one
+ * sendmmsg() call, on platforms which have it. 1 means one sendto() per
+ * packet.
+ */
+extern int	Gp_interconnect_tx_batch_size;
+
+/*
+ * Parameter gp_motion_batch_size
+ *
+ * The number of tuples a motion sender packs column-wise into one batch
+ * per route before sending it.  0 or 1 sends tuples one at a time.
+ * Receivers accept both formats.
+ */
+extern int	gp_motion_batch_size;
+
+/*
+ * Parameter gp_motion_compress_level
+ *
+ * The zlib level motion senders compress tuples and batches of at least
+ * a few KB with, 0 sends them uncompressed.  A motion node stops
+ * compressing when it doesn't pay off.  Receivers accept both formats.
+ */
+extern int	gp_motion_compress_level;
+
 /*
  * Parameter Gp_interconnect_snd_queue_depth
  *
@@ -859,6 +914,8 @@ extern bool gp_enable_sort_distinct;
 /* Greenplum MK Sort */
 extern bool gp_enable_mk_sort;
 extern bool gp_enable_motion_mk_sort;
+extern bool gp_mk_sort_normalized_keys;
+extern bool gp_mk_sort_bounded_spill;
 
 #ifdef USE_ASSERT_CHECKING
 extern bool gp_mk_sort_check;
@@ -915,6 +972,13 @@ extern int gp_segworker_relative_priority;
 /*  Max size of dispatched plans; 0 if no limit */
 extern int gp_max_plan_size;
 
+/*
+ * Number of serialized plans the QD keeps, together with the cached QEs it
+ * sent them to, so that a repeated plan is not compressed and sent again;
+ * 0 if none.
+ */
+extern int gp_dispatch_plan_cache_slots;
+
 /* The maximum number of times on average that the hybrid hashed aggregation
  * algorithm will plan to spill an input row to disk before including it in
  * an aggregation.  Increasing this parameter will cause the planner to choose
@@ -931,6 +995,13 @@ extern bool gp_hashagg_recalc_density;
 /* If we use two stage hashagg, we can stream the bottom half */
 extern bool gp_hashagg_streambottom;
 
+/* Hashagg uses an open-addressing hash table instead of hash chains */
+extern bool gp_hashagg_open_addressing;
+
+/* A streaming hashagg whose groups exceed this fraction of its input tuples
+ * stops hashing, and passes each input tuple on as a group of its own. */
+extern double gp_hashagg_stream_passthrough_ratio;
+
 /* The default number of batches to use when the hybrid hashed aggregation
  * algorithm (re-)spills in-memory groups to disk.
  */
@@ -944,6 +1015,18 @@ extern int gp_hashagg_spillbatch_max;
 /* Hashjoin use bloom filter */
 extern int gp_hashjoin_bloomfilter;
 
+/* Hashjoin push a bloom filter down to the outer scan */
+extern int gp_hashjoin_runtime_filter;
+
+/* Hashjoin radix-partition its in-memory table, and probe it partition-wise */
+extern int gp_hashjoin_radix_partition;
+
+/* Hashjoin number of threads linking a radix-partitioned table's buckets */
+extern int gp_hashjoin_build_threads;
+
+/* Number of threads sorting an in-memory mk sort */
+extern int gp_mksort_threads;
+
 /* Get statistics for partitioned parent from a child */
 extern bool 	gp_statistics_pullup_from_child_partition;
 
@@ -974,6 +1057,7 @@ extern bool force_bitmap_table_scan;
 extern int gp_hashagg_compress_spill_files;
 extern int gp_workfile_compress_algorithm;
 extern bool gp_workfile_checksumming;
+extern bool gp_workfile_async_io;
 extern bool gp_workfile_caching;
 extern bool gp_metadata_versioning;
 extern double gp_workfile_limit_per_segment;
@@ -21,6 +21,12 @@ typedef enum TupleChunkType
 	TC_PARTIAL_END,				/* Contains the final portion of a tuple. */
 	TC_END_OF_STREAM,			/* Indicates "end of tuples" from this source. */
 	TC_EMPTY,					/* Empty tuple */
+	TC_BATCH_WHOLE,				/* Contains a whole batch of tuples. */
+	TC_BATCH_START,				/* Contains the starting portion of a batch,
+								 * followed by TC_PARTIAL_MID/END chunks. */
+	TC_COMPRESSED_WHOLE,		/* Contains a whole compressed tuple or batch. */
+	TC_COMPRESSED_START,		/* Contains the starting portion of a compressed
+								 * tuple or batch. */
 	TC_MAXVAL					/* For range checks on type values. */
 } TupleChunkType;
 
@@ -10,6 +10,7 @@
 
 
 #include "access/heapam.h"
+#include "cdb/htupfifo.h"
 #include "cdb/tupchunklist.h"
 #include "lib/stringinfo.h"
 #include "utils/lsyscache.h"
@@ -77,8 +78,38 @@ typedef struct SerTupInfo
 	/* Preallocated space for deformtuple and formtuple. */
 	Datum	   *values;
 	bool	   *nulls;
+
+	/* Scratch space of CompressChunkList(), allocated on first use. */
+	StringInfoData compressRaw;
+	StringInfoData compressBuf;
 }	SerTupInfo;
 
+/*
+ * A batch of tuples waiting to be sent to one route, kept column-wise.
+ *
+ * On the wire a batch is a TupSerBatchHeader followed by one section per
+ * attribute: an optional null bitmap (heap-tuple convention, a set bit
+ * means not null), then either the fixed-width values as a raw array of
+ * attlen bytes per tuple, or for varlena and cstring attributes the
+ * start offset of each value followed by the values themselves.  The
+ * receiver forms the tuples straight from these arrays, with no per-tuple
+ * header and no send/recv function calls.
+ */
+typedef struct SerTupBatchColumn
+{
+	StringInfoData nulls;		/* null bitmap, one bit per tuple */
+	bool		hasnulls;		/* any bit cleared in nulls? */
+	StringInfoData offsets;		/* var-width: uint32 offset of each value */
+	StringInfoData data;		/* the values */
+}	SerTupBatchColumn;
+
+typedef struct SerTupBatch
+{
+	int			ntuples;		/* tuples in the batch */
+	int			nbytes;			/* bytes of values in the batch */
+	SerTupBatchColumn *columns; /* one per attribute */
+}	SerTupBatch;
+
 /* Populate a SerTupInfo struct with information looked up from the specified
  * tuple-descriptor.
  */
@@ -101,4 +132,29 @@ extern HeapTuple DeserializeTuple(SerTupInfo * pSerInfo, StringInfo serialTup);
  */
 extern HeapTuple CvtChunksToHeapTup(TupleChunkList tclist, SerTupInfo * pSerInfo);
 
+/* Set up and free the column buffers of a batch. */
+extern void InitSerTupBatch(SerTupInfo *pSerInfo, SerTupBatch *batch);
+extern void CleanupSerTupBatch(SerTupInfo *pSerInfo, SerTupBatch *batch);
+
+/* Copy a tuple's attribute values into a batch. */
+extern void AddTupleToBatch(SerTupInfo *pSerInfo, SerTupBatch *batch, Datum *values, bool *nulls);
+
+/* Convert a batch into chunks ready to send out, and empty the batch. */
+extern void SerializeBatchIntoChunks(SerTupBatch *batch, SerTupInfo *pSerInfo, TupleChunkList tcList);
+
+/* Convert the chunks of a serialized batch into HeapTuples, appended to
+ * fifo.  Returns the number of tuples.
+ */
+extern int	CvtChunksToHeapTupBatch(TupleChunkList tcList, SerTupInfo *pSerInfo, htup_fifo fifo);
+
+/* Replace the payload of a tuple or batch chunk list with its compressed
+ * form.  Returns false, leaving the list alone, if that would not save space.
+ */
+extern bool CompressChunkList(TupleChunkList tcList, SerTupInfo *pSerInfo, int level);
+
+/* Convert the chunks of a compressed tuple or batch into HeapTuples, appended
+ * to fifo.  Returns the number of tuples.
+ */
+extern int	CvtChunksToHeapTupCompressed(TupleChunkList tcList, SerTupInfo *pSerInfo, htup_fifo fifo);
+
 #endif   /* TUPSER_H */
@@ -277,4 +277,9 @@ extern void truncateEol(StringInfo buf, EolType	eol_type);
 extern void setEncodingConversionProc(CopyState cstate, int client_encoding, bool iswritable);
 extern void CopyEolStrToType(CopyState cstate);
 
+/* in copyscan.c */
+typedef char *(*CopyScanCharsFunc) (const char *s, const char *end,
+									char c1, char c2, char c3);
+extern CopyScanCharsFunc copyScanChars;
+
 #endif   /* COPY_H */
@@ -48,6 +48,16 @@ typedef struct HashAggEntry
 	bool is_primodial; /* indicate if this entry is there before spilling. */
 } HashAggEntry;
 
+/* A slot of the open-addressing hash table, see gp_hashagg_open_addressing.
+ * The hash value is kept next to the entry pointer, so that probing only
+ * dereferences entries whose hash value matches.
+ */
+typedef struct HashAggSlot
+{
+	HashKey hashvalue;
+	HashAggEntry *entry; /* NULL if the slot is free */
+} HashAggSlot;
+
 /* A SpillFile controls access to a temporary file used to hold  
  * transition tuples spilled from the hash table in order to free 
  * up space.
@@ -165,6 +175,21 @@ typedef struct HashAggTable
 	HashAggEntry  **buckets;
 	uint64 *bloom;
 
+	/* With gp_hashagg_open_addressing, an array of nbuckets slots probed
+	 * linearly replaces buckets and bloom, which are NULL. */
+	HashAggSlot *slots;
+	unsigned nslots_used; /* slots holding an entry */
+	unsigned max_slots_used; /* the table is full when this many are used */
+	unsigned slot_hash_bit; /* hash values are shifted by this to find a slot */
+
+	/* Per grouping key: can equal values be told by comparing Datums? */
+	bool *eq_byval;
+
+	/* Streaming: input tuples since the table was last emptied, and whether
+	 * hashing has been given up on (see gp_hashagg_stream_passthrough_ratio). */
+	uint64 num_fill_tuples;
+	bool passthrough;
+
 	/* Overflow batches */
 	SpillSet       *spill_set;
 	/* Representation of all workfile names, used by the workfile manager */
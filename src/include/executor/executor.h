@@ -291,6 +291,15 @@ extern Datum ExecEvalFunctionArgToConst(FuncExpr *fexpr, int argno, bool *isnull
 extern void GetNeededColumnsForScan(Node *expr, bool *mask, int n);
 extern bool isJoinExprNull(List *joinExpr, ExprContext *econtext);
 
+/*
+ * prototypes from functions in execFastQual.c
+ */
+typedef struct FastQualProgram FastQualProgram;
+
+extern FastQualProgram *ExecBuildFastQual(List *qual, MemoryContext cxt);
+extern bool ExecFastQual(FastQualProgram *prog, ExprContext *econtext);
+extern void ExecResetFastQual(ScanState *node);
+
 /*
  * prototypes from functions in execScan.c
  */
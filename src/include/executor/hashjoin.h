@@ -78,6 +78,77 @@ typedef struct HashJoinTupleData
 #define HJTUPLE_MINTUPLE(hjtup)  \
 	((MemTuple) ((char *) (hjtup) + HJTUPLE_OVERHEAD))
 
+/*
+ * Radix-partitioned hash table (gp_hashjoin_radix_partition)
+ *
+ * nbuckets is a power of 2 and the top radix_bits bits of a bucket number
+ * select the partition, so the buckets of a partition are adjacent.  The
+ * tuples of a partition are packed into chunks of its own, so a partition
+ * of about HJ_RADIX_PARTITION_BYTES stays in cache while it is probed.
+ * Outer tuples are buffered and sorted by partition before probing, see
+ * ExecHashJoinOuterBufferedTuple().
+ *
+ * The bucket number of a partitioned table is taken from the hash value
+ * rehashed with HJ_RADIX_HASH_SEED, see ExecHashGetRadixBucket(): the low
+ * bits of some hash functions (hashint4 is ~key) are too regular to pick
+ * both a partition and a bucket, and the batch number uses hash_uint32() of
+ * the plain value.  The outer buffer is charged to spaceAllowed.
+ *
+ * With gp_hashjoin_build_threads > 1, inserting a tuple only copies it into
+ * its partition's chunks.  Once the batch is loaded, worker threads link
+ * the tuples of disjoint sets of partitions into their buckets.
+ */
+#define HJ_RADIX_PARTITION_BYTES	(256 * 1024)
+#define HJ_RADIX_MAX_BITS			10
+#define HJ_RADIX_HASH_SEED			0x9e3779b9
+#define HJ_RADIX_PARTITION(hashtable, bucketno) \
+	((bucketno) >> (hashtable)->radix_shift)
+
+/* Outer tuples buffered per partition, and at most this many bytes */
+#define HJ_RADIX_OUTER_TUPLES_PER_PARTITION	8
+#define HJ_RADIX_OUTER_MIN_TUPLES			1024
+#define HJ_RADIX_OUTER_BUFFER_BYTES			(4 * 1024 * 1024)
+
+/* Fewer tuples than this are linked without starting threads */
+#define HJ_BUILD_THREAD_MIN_TUPLES			65536
+
+typedef struct HashJoinChunkData
+{
+	struct HashJoinChunkData *next;	/* next chunk of the same partition */
+	Size		maxlen;			/* bytes of tuple space */
+	Size		used;			/* bytes of tuple space in use */
+	/* HashJoinTuples follow, each on a MAXALIGN boundary */
+} HashJoinChunkData;
+
+typedef struct HashJoinChunkData *HashJoinChunk;
+
+#define HJ_CHUNK_SIZE			(32 * 1024)
+#define HJ_CHUNK_HEADER_SIZE	MAXALIGN(sizeof(HashJoinChunkData))
+#define HJ_CHUNK_DATA(chunk)	((char *) (chunk) + HJ_CHUNK_HEADER_SIZE)
+
+/*
+ * Outer tuples of the current batch waiting to be probed.  Tuples are
+ * copied in as they arrive, then sorted by partition and handed out.
+ */
+typedef struct HashJoinOuterBufferData
+{
+	MemoryContext cxt;			/* holds the copied tuples */
+	int			capacity;		/* max number of tuples */
+	Size		space;			/* bytes of tuples being collected */
+	bool		atend;			/* the batch has no more outer tuples */
+
+	int			ncollected;		/* tuples being collected */
+	MemTuple   *tuples;			/* [capacity], in arrival order */
+	uint32	   *hashvalues;
+
+	int			nsorted;		/* tuples being handed out */
+	int			next;			/* next of them to hand out */
+	MemTuple   *sorted_tuples;	/* [capacity], in partition order */
+	uint32	   *sorted_hashvalues;
+
+	int		   *partstart;		/* [npartitions + 1], counting sort */
+} HashJoinOuterBufferData;
+
 
 /* Statistics collection workareas for EXPLAIN ANALYZE */
 typedef struct HashJoinBatchStats
@@ -152,6 +223,15 @@ typedef struct HashJoinTableData
 	uint64     				  *bloom; /* bloom[i] is bloomfilter for buckets[i] */
 	/* buckets array is per-batch storage, as are all the tuples */
 
+	int			radix_bits;		/* log2 of # of radix partitions; 0 if not
+								 * partitioned */
+	int			radix_shift;	/* bucketno >> radix_shift is the partition */
+	Size		radix_outer_bytes;	/* max bytes of buffered outer tuples */
+	HashJoinChunk *partchunks;	/* chunk list of each partition, per-batch */
+	bool		linkDeferred;	/* tuples are linked into their buckets only
+								 * by ExecHashTableLinkPartitions() */
+	struct HashJoinOuterBufferData *outerBuffer;	/* lives in hashCxt */
+
 	int			nbatch;			/* number of batches */
 	int			curbatch;		/* current batch #; 0 during 1st pass */
 
@@ -192,4 +272,30 @@ typedef struct HashJoinTableData
 
 } HashJoinTableData;
 
+/*
+ * HashJoinRuntimeFilterData
+ *
+ * A Bloom filter over the hash values of the inner join keys, set two bits
+ * per inner tuple as the Hash node builds the table.  A hash join pushes it
+ * down to an outer scan on the same slice, which evaluates the outer join
+ * keys over its scan tuples with the join's hash functions and drops rows
+ * whose bits are not set, before projecting them.  A filter that turns out
+ * too full, or drops too few rows, is switched off.
+ */
+typedef struct HashJoinRuntimeFilterData
+{
+	bool		ready;			/* built, may be checked by the scan */
+	bool		disabled;		/* not selective enough, never check again */
+	uint64	   *bits;
+	uint32		nbits_mask;		/* number of bits - 1, a power of 2 - 1 */
+	double		ninserted;		/* inner hash values added */
+
+	List	   *hashkeys;		/* outer keys, as ExprStates over scan tuples */
+	FmgrInfo   *hashfunctions;	/* as in HashJoinTableData */
+	bool	   *hashStrict;
+
+	uint64		nchecked;		/* outer rows checked */
+	uint64		ndropped;		/* outer rows dropped */
+} HashJoinRuntimeFilterData;
+
 #endif   /* HASHJOIN_H */
@@ -41,13 +41,23 @@ extern void ExecHashGetBucketAndBatch(HashJoinTable hashtable,
 						  uint32 hashvalue,
 						  int *bucketno,
 						  int *batchno);
+extern int ExecHashGetRadixBucket(HashJoinTable hashtable, uint32 hashvalue);
 extern HashJoinTuple ExecScanHashBucket(HashState *hashState, HashJoinState *hjstate,
 				   ExprContext *econtext);
 extern void ExecHashTableReset(HashState *hashState, HashJoinTable hashtable);
+extern void ExecHashTableLinkPartitions(HashJoinTable hashtable);
 extern void ExecHashTableExplainInit(HashState *hashState, HashJoinState *hjstate,
                                      HashJoinTable  hashtable);
 extern void ExecHashTableExplainBatchEnd(HashState *hashState, HashJoinTable hashtable);
 
+extern HashJoinRuntimeFilter ExecHashRuntimeFilterCreate(List *hashOperators,
+							List *hashkeys, double ntuples,
+							uint64 operatorMemKB);
+extern void ExecHashRuntimeFilterReset(HashJoinRuntimeFilter filter);
+extern void ExecHashRuntimeFilterFinish(HashJoinRuntimeFilter filter);
+extern bool ExecHashRuntimeFilterCheck(HashJoinRuntimeFilter filter,
+						   ExprContext *econtext);
+
 enum 
 {
 	GPMON_HASH_SPILLBATCH = GPMON_QEXEC_M_NODE_START,
@@ -173,18 +173,23 @@ typedef struct ExprContext
  *                The planner very often produces tlists that consist entirely of
  *                simple Var references (lower levels of a plan tree almost always
  *                look like that).  So we have an optimization to handle that case
- *                with minimum overhead.
+ *                with minimum overhead.  Simple Var references in other tlists
+ *                are handled the same way, leaving only the other entries to
+ *                the expression evaluator.
  *
  *                targetlist                target list for projection
  *                exprContext                expression context in which to evaluate targetlist
  *                slot                        slot to place projection result in
  *                itemIsDone                workspace for ExecProject
- *                isVarList                TRUE if simple-Var-list optimization applies
+ *                isVarList                TRUE if all entries are simple Vars
  *                varSlotOffsets        array indicating which slot each simple Var is from
  *                varNumbers                array indicating attr numbers of simple Vars
+ *                varOutputCols        array indicating output columns of simple Vars
  *                lastInnerVar        highest attnum from inner tuple slot (0 if none)
  *                lastOuterVar        highest attnum from outer tuple slot (0 if none)
  *                lastScanVar                highest attnum from scan tuple slot (0 if none)
+ *                numSimpleVars        number of simple Vars
+ *                exprList                ExprStates of the entries that are not simple Vars
  * ----------------
  */
 typedef struct ProjectionInfo
@@ -200,6 +205,9 @@ typedef struct ProjectionInfo
         int                pi_lastInnerVar;
         int                pi_lastOuterVar;
         int                pi_lastScanVar;
+        int                pi_numSimpleVars;
+        int                *pi_varOutputCols;
+        List                *pi_exprList;
 } ProjectionInfo;
 
 /* ----------------
@@ -1500,6 +1508,20 @@ typedef struct ScanState
 	/* The type of the table that is being scanned */
 	TableType tableType;
 
+	/*
+	 * Bloom filter of a parent hash join's inner keys, checked by ExecScan()
+	 * to drop rows that cannot join; NULL if none was pushed down.
+	 */
+	struct HashJoinRuntimeFilterData *ss_runtimeFilter;
+
+	/*
+	 * ps.qual compiled by ExecBuildFastQual() for ExecScan(), and the qual
+	 * list it was built from; ss_fastQual is NULL if nothing compiled.
+	 * Whoever rebuilds ps.qual must call ExecResetFastQual().
+	 */
+	struct FastQualProgram *ss_fastQual;
+	List	   *ss_fastQualSource;
+
 } ScanState;
 
 /*
@@ -2060,6 +2082,7 @@ typedef struct MergeJoinState
 /* these structs are defined in executor/hashjoin.h: */
 typedef struct HashJoinTupleData *HashJoinTuple;
 typedef struct HashJoinTableData *HashJoinTable;
+typedef struct HashJoinRuntimeFilterData *HashJoinRuntimeFilter;
 
 typedef struct HashJoinState
 {
@@ -2095,6 +2118,9 @@ typedef struct HashJoinState
         /* number of batches when we loaded from the state. -1 means not loaded yet */
         int nbatch_loaded_state;
 
+        /* filter pushed down to the outer scan, or NULL; see gp_hashjoin_runtime_filter */
+        HashJoinRuntimeFilter hj_runtimeFilter;
+
 } HashJoinState;
 
 
@@ -2379,6 +2405,7 @@ typedef struct HashState
         bool		hs_quit_if_hashkeys_null;	/* quit building hash table if hashkeys are all null */
         bool		hs_hashkeys_null;				 /* found an instance wherein hashkeys are all null */
         /* hashkeys is same as parent's hj_InnerHashKeys */
+        HashJoinRuntimeFilter hs_runtimeFilter;	/* filled in as the table is built, or NULL */
 } HashState;
 
 /* ----------------
@@ -12,6 +12,7 @@
 #define BFZ_BUFFER_SIZE		(1<<14)
 
 struct bfz;
+struct bfz_async;
 
 struct bfz_freeable_stuff
 {
@@ -33,6 +34,14 @@ struct bfz_freeable_stuff
 	void (*write_ex) (struct bfz * thiz, const char *buffer, int size);
 	void (*close_ex) (struct bfz * thiz);
 
+/*
+ * Variants of read_ex and write_ex that are safe to call from the
+ * background I/O thread: they never elog, but return -1 and leave
+ * errno set on failure. read_raw returns the number of bytes read.
+ */
+	int (*read_raw) (struct bfz * thiz, char *buffer, int size);
+	int (*write_raw) (struct bfz * thiz, const char *buffer, int size);
+
 	char buffer[BFZ_BUFFER_SIZE];
 };
 
@@ -62,6 +71,12 @@ typedef struct bfz
 
 	int64 tot_bytes;
 
+	/*
+	 * Block being written behind or read ahead by the background I/O
+	 * thread, or NULL if this file does synchronous I/O.
+	 */
+	struct bfz_async *async;
+
 }	bfz_t;
 
 /* These functions are internal to bfz. */
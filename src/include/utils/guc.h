@@ -160,6 +160,7 @@ extern int  gp_max_local_distributed_cache;
 extern bool gp_local_distributed_cache_stats;
 extern bool gp_appendonly_verify_block_checksums;
 extern bool gp_appendonly_verify_write_block;
+extern int	gp_appendonly_read_ahead_blocks;
 extern bool gp_heap_require_relhasoids_match;
 extern bool	Debug_appendonly_rezero_quicklz_compress_scratch;
 extern bool	Debug_appendonly_rezero_quicklz_decompress_scratch;
@@ -432,6 +433,25 @@ extern bool	optimizer_partition_selection_log;
  */
 extern bool gp_parquet_insert_sort;
 
+/*
+ * Write parquet column chunks with dictionary encoding. A chunk falls
+ * back to PLAIN encoding once its dictionary exceeds the page size.
+ */
+extern bool gp_parquet_dictionary_encoding;
+
+/*
+ * In parquet scans, evaluate `column op const` quals on fixed length
+ * columns first, and skip other columns of rows they reject.
+ */
+extern bool gp_parquet_late_materialization;
+
+/*
+ * In scans, evaluate comparisons of columns with constants, IN-lists and
+ * IS NULL tests on integer, float, date, timestamp and text columns
+ * directly instead of through ExecQual().
+ */
+extern bool gp_enable_fast_qual;
+
 #if USE_EMAIL
 extern char  *gp_email_smtp_server;
 extern char  *gp_email_smtp_userid;
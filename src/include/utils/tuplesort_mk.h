@@ -213,8 +213,15 @@ typedef enum MKLvType
     MKLV_TYPE_INT32, /* this level contains int32 values */
     MKLV_TYPE_CHAR,  /* this level contains char (blank padded) values */
     MKLV_TYPE_TEXT,  /* this level contains text values */
+    MKLV_TYPE_NORMKEY, /* this level is compared on a normalized key, see MKLvContext.normalize */
 } MKLvType;
 
+/*
+ * Map a datum to an unsigned 64-bit key that orders like the datum under the
+ * level's cmp function.  A lossy key only orders; equal keys need a full compare.
+ */
+typedef uint64 (*MKNormalizeKey) (Datum d);
+
 typedef struct MKLvContext
 {
 	/* Is the type of datums in this level passed by value instead of reference */
@@ -229,6 +236,10 @@ typedef struct MKLvContext
     SortFunctionKind sortfnkind;
     FmgrInfo fmgrinfo;
 
+    /* for MKLV_TYPE_NORMKEY: how prepare computes the key, and whether it can tie for different values */
+    MKNormalizeKey normalize;
+    bool normLossy;
+
     /* should null sort first (low) in this level */
     bool nullfirst;
 
@@ -288,6 +299,9 @@ typedef struct MKContext {
 
     /* enforce Unique, for index build */
     bool enforceUnique;
+
+    /* Sorting in a worker thread: must not check for interrupts or otherwise touch backend state */
+    bool inWorker;
 } MKContext;
 
 /**
@@ -308,6 +322,7 @@ static inline void mk_prepare_array(MKEntry *a, int i, int j, int32 lv, struct M
 
 extern void tupsort_cpfr(MKEntry *dst, MKEntry *src, MKLvContext *ctxt);
 extern int tupsort_compare_datum(MKEntry *v1, MKEntry *v2, MKLvContext *ctxt, MKContext *mkContext);
+extern int tupsort_compare_entries(MKEntry *a, MKEntry *b, MKContext *mkctxt);
 
 extern void create_mksort_context(
         MKContext *mkctxt,
@@ -324,6 +339,13 @@ static inline void mk_qsort(MKEntry* a, int n, MKContext *ctxt)
     mk_qsort_impl(a, 0, n-1, 0, true, ctxt, false);
 }
 
+/*
+ * Sort with up to nthreads threads.  Only valid when every level can be
+ * fetched and compared without backend services; see mk_qsort_parallel_ok.
+ */
+extern bool mk_qsort_parallel_ok(MKContext *ctxt);
+extern void mk_qsort_parallel(MKEntry *a, int n, MKContext *ctxt, int nthreads);
+
 /* MK Heap stuff */
 typedef bool (*MKFlagPtrReader) (void *ctxt, MKEntry *e);
 typedef struct MKHeapReader
@@ -0,0 +1,1372 @@
+--
+-- COPY FROM finds delimiters, quotes and escapes many bytes at a time.  Load
+-- fields longer than 32 bytes with those characters at every offset from 0
+-- to 69, across the 16 and 32 byte steps of the search, in text and CSV
+-- format, and check every field read.
+--
+CREATE TABLE cs_text (id int, pos int, code int, a text, b text) DISTRIBUTED BY (id);
+CREATE TABLE cs_pipe (id int, pos int, code int, a text, b text) DISTRIBUTED BY (id);
+CREATE TABLE cs_csv (id int, pos int, code int, a text, b text) DISTRIBUTED BY (id);
+CREATE TABLE cs_csvesc (id int, pos int, code int, a text, b text) DISTRIBUTED BY (id);
+COPY cs_text FROM stdin;
+0	0	0	\N	end0
+1	0	9	\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end1
+2	1	9	x\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end2
+3	2	9	xx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end3
+4	3	9	xxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end4
+5	4	9	xxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end5
+6	5	9	xxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end6
+7	6	9	xxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end7
+8	7	9	xxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end8
+9	8	9	xxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end9
+10	9	9	xxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end10
+11	10	9	xxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end11
+12	11	9	xxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end12
+13	12	9	xxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end13
+14	13	9	xxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end14
+15	14	9	xxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end15
+16	15	9	xxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end16
+17	16	9	xxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end17
+18	17	9	xxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end18
+19	18	9	xxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end19
+20	19	9	xxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end20
+21	20	9	xxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end21
+22	21	9	xxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end22
+23	22	9	xxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end23
+24	23	9	xxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end24
+25	24	9	xxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end25
+26	25	9	xxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end26
+27	26	9	xxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end27
+28	27	9	xxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end28
+29	28	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end29
+30	29	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end30
+31	30	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end31
+32	31	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end32
+33	32	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end33
+34	33	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end34
+35	34	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end35
+36	35	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end36
+37	36	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end37
+38	37	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end38
+39	38	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end39
+40	39	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end40
+41	40	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end41
+42	41	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end42
+43	42	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end43
+44	43	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end44
+45	44	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end45
+46	45	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end46
+47	46	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end47
+48	47	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end48
+49	48	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end49
+50	49	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end50
+51	50	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end51
+52	51	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end52
+53	52	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end53
+54	53	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end54
+55	54	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end55
+56	55	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end56
+57	56	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end57
+58	57	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end58
+59	58	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end59
+60	59	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end60
+61	60	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end61
+62	61	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end62
+63	62	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end63
+64	63	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end64
+65	64	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end65
+66	65	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end66
+67	66	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end67
+68	67	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end68
+69	68	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end69
+70	69	9	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\tyyyyyyyyyyyyyyyy\tzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end70
+71	0	92	\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end71
+72	1	92	x\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end72
+73	2	92	xx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end73
+74	3	92	xxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end74
+75	4	92	xxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end75
+76	5	92	xxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end76
+77	6	92	xxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end77
+78	7	92	xxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end78
+79	8	92	xxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end79
+80	9	92	xxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end80
+81	10	92	xxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end81
+82	11	92	xxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end82
+83	12	92	xxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end83
+84	13	92	xxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end84
+85	14	92	xxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end85
+86	15	92	xxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end86
+87	16	92	xxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end87
+88	17	92	xxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end88
+89	18	92	xxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end89
+90	19	92	xxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end90
+91	20	92	xxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end91
+92	21	92	xxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end92
+93	22	92	xxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end93
+94	23	92	xxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end94
+95	24	92	xxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end95
+96	25	92	xxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end96
+97	26	92	xxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end97
+98	27	92	xxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end98
+99	28	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end99
+100	29	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end100
+101	30	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end101
+102	31	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end102
+103	32	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end103
+104	33	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end104
+105	34	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end105
+106	35	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end106
+107	36	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end107
+108	37	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end108
+109	38	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end109
+110	39	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end110
+111	40	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end111
+112	41	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end112
+113	42	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end113
+114	43	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end114
+115	44	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end115
+116	45	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end116
+117	46	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end117
+118	47	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end118
+119	48	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end119
+120	49	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end120
+121	50	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end121
+122	51	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end122
+123	52	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end123
+124	53	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end124
+125	54	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end125
+126	55	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end126
+127	56	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end127
+128	57	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end128
+129	58	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end129
+130	59	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end130
+131	60	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end131
+132	61	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end132
+133	62	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end133
+134	63	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end134
+135	64	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end135
+136	65	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end136
+137	66	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end137
+138	67	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end138
+139	68	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end139
+140	69	92	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end140
+141	0	10	\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end141
+142	1	10	x\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end142
+143	2	10	xx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end143
+144	3	10	xxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end144
+145	4	10	xxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end145
+146	5	10	xxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end146
+147	6	10	xxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end147
+148	7	10	xxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end148
+149	8	10	xxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end149
+150	9	10	xxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end150
+151	10	10	xxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end151
+152	11	10	xxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end152
+153	12	10	xxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end153
+154	13	10	xxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end154
+155	14	10	xxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end155
+156	15	10	xxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end156
+157	16	10	xxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end157
+158	17	10	xxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end158
+159	18	10	xxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end159
+160	19	10	xxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end160
+161	20	10	xxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end161
+162	21	10	xxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end162
+163	22	10	xxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end163
+164	23	10	xxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end164
+165	24	10	xxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end165
+166	25	10	xxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end166
+167	26	10	xxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end167
+168	27	10	xxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end168
+169	28	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end169
+170	29	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end170
+171	30	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end171
+172	31	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end172
+173	32	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end173
+174	33	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end174
+175	34	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end175
+176	35	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end176
+177	36	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end177
+178	37	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end178
+179	38	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end179
+180	39	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end180
+181	40	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end181
+182	41	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end182
+183	42	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end183
+184	43	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end184
+185	44	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end185
+186	45	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end186
+187	46	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end187
+188	47	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end188
+189	48	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end189
+190	49	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end190
+191	50	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end191
+192	51	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end192
+193	52	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end193
+194	53	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end194
+195	54	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end195
+196	55	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end196
+197	56	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end197
+198	57	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end198
+199	58	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end199
+200	59	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end200
+201	60	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end201
+202	61	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end202
+203	62	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end203
+204	63	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end204
+205	64	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end205
+206	65	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end206
+207	66	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end207
+208	67	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end208
+209	68	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end209
+210	69	10	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end210
+211	0	13	\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end211
+212	1	13	x\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end212
+213	2	13	xx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end213
+214	3	13	xxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end214
+215	4	13	xxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end215
+216	5	13	xxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end216
+217	6	13	xxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end217
+218	7	13	xxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end218
+219	8	13	xxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end219
+220	9	13	xxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end220
+221	10	13	xxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end221
+222	11	13	xxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end222
+223	12	13	xxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end223
+224	13	13	xxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end224
+225	14	13	xxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end225
+226	15	13	xxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end226
+227	16	13	xxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end227
+228	17	13	xxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end228
+229	18	13	xxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end229
+230	19	13	xxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end230
+231	20	13	xxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end231
+232	21	13	xxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end232
+233	22	13	xxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end233
+234	23	13	xxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end234
+235	24	13	xxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end235
+236	25	13	xxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end236
+237	26	13	xxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end237
+238	27	13	xxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end238
+239	28	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end239
+240	29	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end240
+241	30	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end241
+242	31	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end242
+243	32	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end243
+244	33	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end244
+245	34	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end245
+246	35	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end246
+247	36	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end247
+248	37	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end248
+249	38	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end249
+250	39	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end250
+251	40	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end251
+252	41	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end252
+253	42	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end253
+254	43	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end254
+255	44	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end255
+256	45	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end256
+257	46	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end257
+258	47	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end258
+259	48	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end259
+260	49	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end260
+261	50	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end261
+262	51	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end262
+263	52	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end263
+264	53	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end264
+265	54	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end265
+266	55	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end266
+267	56	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end267
+268	57	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end268
+269	58	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end269
+270	59	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end270
+271	60	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end271
+272	61	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end272
+273	62	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end273
+274	63	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end274
+275	64	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end275
+276	65	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end276
+277	66	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end277
+278	67	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end278
+279	68	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end279
+280	69	13	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\ryyyyyyyyyyyyyyyy\rzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end280
+281	0	44	,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end281
+282	1	44	x,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end282
+283	2	44	xx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end283
+284	3	44	xxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end284
+285	4	44	xxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end285
+286	5	44	xxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end286
+287	6	44	xxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end287
+288	7	44	xxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end288
+289	8	44	xxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end289
+290	9	44	xxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end290
+291	10	44	xxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end291
+292	11	44	xxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end292
+293	12	44	xxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end293
+294	13	44	xxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end294
+295	14	44	xxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end295
+296	15	44	xxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end296
+297	16	44	xxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end297
+298	17	44	xxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end298
+299	18	44	xxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end299
+300	19	44	xxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end300
+301	20	44	xxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end301
+302	21	44	xxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end302
+303	22	44	xxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end303
+304	23	44	xxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end304
+305	24	44	xxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end305
+306	25	44	xxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end306
+307	26	44	xxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end307
+308	27	44	xxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end308
+309	28	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end309
+310	29	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end310
+311	30	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end311
+312	31	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end312
+313	32	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end313
+314	33	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end314
+315	34	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end315
+316	35	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end316
+317	36	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end317
+318	37	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end318
+319	38	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end319
+320	39	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end320
+321	40	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end321
+322	41	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end322
+323	42	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end323
+324	43	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end324
+325	44	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end325
+326	45	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end326
+327	46	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end327
+328	47	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end328
+329	48	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end329
+330	49	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end330
+331	50	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end331
+332	51	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end332
+333	52	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end333
+334	53	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end334
+335	54	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end335
+336	55	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end336
+337	56	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end337
+338	57	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end338
+339	58	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end339
+340	59	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end340
+341	60	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end341
+342	61	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end342
+343	62	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end343
+344	63	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end344
+345	64	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end345
+346	65	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end346
+347	66	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end347
+348	67	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end348
+349	68	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end349
+350	69	44	xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz	end350
+\.
+COPY cs_pipe FROM stdin WITH DELIMITER '|';
+0|0|0|\N|end0
+1|0|124|\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end1
+2|1|124|x\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end2
+3|2|124|xx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end3
+4|3|124|xxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end4
+5|4|124|xxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end5
+6|5|124|xxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end6
+7|6|124|xxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end7
+8|7|124|xxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end8
+9|8|124|xxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end9
+10|9|124|xxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end10
+11|10|124|xxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end11
+12|11|124|xxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end12
+13|12|124|xxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end13
+14|13|124|xxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end14
+15|14|124|xxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end15
+16|15|124|xxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end16
+17|16|124|xxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end17
+18|17|124|xxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end18
+19|18|124|xxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end19
+20|19|124|xxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end20
+21|20|124|xxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end21
+22|21|124|xxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end22
+23|22|124|xxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end23
+24|23|124|xxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end24
+25|24|124|xxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end25
+26|25|124|xxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end26
+27|26|124|xxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end27
+28|27|124|xxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end28
+29|28|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end29
+30|29|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end30
+31|30|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end31
+32|31|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end32
+33|32|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end33
+34|33|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end34
+35|34|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end35
+36|35|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end36
+37|36|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end37
+38|37|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end38
+39|38|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end39
+40|39|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end40
+41|40|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end41
+42|41|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end42
+43|42|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end43
+44|43|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end44
+45|44|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end45
+46|45|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end46
+47|46|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end47
+48|47|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end48
+49|48|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end49
+50|49|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end50
+51|50|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end51
+52|51|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end52
+53|52|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end53
+54|53|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end54
+55|54|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end55
+56|55|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end56
+57|56|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end57
+58|57|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end58
+59|58|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end59
+60|59|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end60
+61|60|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end61
+62|61|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end62
+63|62|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end63
+64|63|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end64
+65|64|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end65
+66|65|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end66
+67|66|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end67
+68|67|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end68
+69|68|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end69
+70|69|124|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\|yyyyyyyyyyyyyyyy\|zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end70
+71|0|92|\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end71
+72|1|92|x\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end72
+73|2|92|xx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end73
+74|3|92|xxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end74
+75|4|92|xxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end75
+76|5|92|xxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end76
+77|6|92|xxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end77
+78|7|92|xxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end78
+79|8|92|xxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end79
+80|9|92|xxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end80
+81|10|92|xxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end81
+82|11|92|xxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end82
+83|12|92|xxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end83
+84|13|92|xxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end84
+85|14|92|xxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end85
+86|15|92|xxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end86
+87|16|92|xxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end87
+88|17|92|xxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end88
+89|18|92|xxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end89
+90|19|92|xxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end90
+91|20|92|xxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end91
+92|21|92|xxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end92
+93|22|92|xxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end93
+94|23|92|xxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end94
+95|24|92|xxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end95
+96|25|92|xxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end96
+97|26|92|xxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end97
+98|27|92|xxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end98
+99|28|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end99
+100|29|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end100
+101|30|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end101
+102|31|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end102
+103|32|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end103
+104|33|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end104
+105|34|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end105
+106|35|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end106
+107|36|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end107
+108|37|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end108
+109|38|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end109
+110|39|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end110
+111|40|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end111
+112|41|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end112
+113|42|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end113
+114|43|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end114
+115|44|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end115
+116|45|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end116
+117|46|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end117
+118|47|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end118
+119|48|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end119
+120|49|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end120
+121|50|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end121
+122|51|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end122
+123|52|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end123
+124|53|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end124
+125|54|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end125
+126|55|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end126
+127|56|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end127
+128|57|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end128
+129|58|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end129
+130|59|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end130
+131|60|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end131
+132|61|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end132
+133|62|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end133
+134|63|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end134
+135|64|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end135
+136|65|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end136
+137|66|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end137
+138|67|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end138
+139|68|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end139
+140|69|92|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end140
+141|0|9|	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end141
+142|1|9|x	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end142
+143|2|9|xx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end143
+144|3|9|xxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end144
+145|4|9|xxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end145
+146|5|9|xxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end146
+147|6|9|xxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end147
+148|7|9|xxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end148
+149|8|9|xxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end149
+150|9|9|xxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end150
+151|10|9|xxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end151
+152|11|9|xxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end152
+153|12|9|xxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end153
+154|13|9|xxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end154
+155|14|9|xxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end155
+156|15|9|xxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end156
+157|16|9|xxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end157
+158|17|9|xxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end158
+159|18|9|xxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end159
+160|19|9|xxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end160
+161|20|9|xxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end161
+162|21|9|xxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end162
+163|22|9|xxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end163
+164|23|9|xxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end164
+165|24|9|xxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end165
+166|25|9|xxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end166
+167|26|9|xxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end167
+168|27|9|xxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end168
+169|28|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end169
+170|29|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end170
+171|30|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end171
+172|31|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end172
+173|32|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end173
+174|33|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end174
+175|34|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end175
+176|35|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end176
+177|36|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end177
+178|37|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end178
+179|38|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end179
+180|39|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end180
+181|40|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end181
+182|41|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end182
+183|42|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end183
+184|43|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end184
+185|44|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end185
+186|45|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end186
+187|46|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end187
+188|47|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end188
+189|48|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end189
+190|49|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end190
+191|50|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end191
+192|51|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end192
+193|52|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end193
+194|53|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end194
+195|54|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end195
+196|55|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end196
+197|56|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end197
+198|57|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end198
+199|58|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end199
+200|59|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end200
+201|60|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end201
+202|61|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end202
+203|62|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end203
+204|63|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end204
+205|64|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end205
+206|65|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end206
+207|66|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end207
+208|67|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end208
+209|68|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end209
+210|69|9|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx	yyyyyyyyyyyyyyyy	zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end210
+211|0|10|\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end211
+212|1|10|x\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end212
+213|2|10|xx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end213
+214|3|10|xxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end214
+215|4|10|xxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end215
+216|5|10|xxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end216
+217|6|10|xxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end217
+218|7|10|xxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end218
+219|8|10|xxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end219
+220|9|10|xxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end220
+221|10|10|xxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end221
+222|11|10|xxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end222
+223|12|10|xxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end223
+224|13|10|xxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end224
+225|14|10|xxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end225
+226|15|10|xxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end226
+227|16|10|xxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end227
+228|17|10|xxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end228
+229|18|10|xxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end229
+230|19|10|xxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end230
+231|20|10|xxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end231
+232|21|10|xxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end232
+233|22|10|xxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end233
+234|23|10|xxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end234
+235|24|10|xxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end235
+236|25|10|xxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end236
+237|26|10|xxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end237
+238|27|10|xxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end238
+239|28|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end239
+240|29|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end240
+241|30|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end241
+242|31|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end242
+243|32|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end243
+244|33|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end244
+245|34|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end245
+246|35|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end246
+247|36|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end247
+248|37|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end248
+249|38|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end249
+250|39|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end250
+251|40|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end251
+252|41|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end252
+253|42|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end253
+254|43|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end254
+255|44|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end255
+256|45|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end256
+257|46|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end257
+258|47|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end258
+259|48|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end259
+260|49|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end260
+261|50|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end261
+262|51|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end262
+263|52|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end263
+264|53|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end264
+265|54|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end265
+266|55|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end266
+267|56|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end267
+268|57|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end268
+269|58|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end269
+270|59|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end270
+271|60|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end271
+272|61|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end272
+273|62|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end273
+274|63|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end274
+275|64|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end275
+276|65|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end276
+277|66|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end277
+278|67|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end278
+279|68|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end279
+280|69|10|xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\nyyyyyyyyyyyyyyyy\nzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz|end280
+\.
+COPY cs_csv FROM stdin CSV;
+0,0,0,,end0
+1,0,44,",yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end1
+2,1,44,"x,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end2
+3,2,44,"xx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end3
+4,3,44,"xxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end4
+5,4,44,"xxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end5
+6,5,44,"xxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end6
+7,6,44,"xxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end7
+8,7,44,"xxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end8
+9,8,44,"xxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end9
+10,9,44,"xxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end10
+11,10,44,"xxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end11
+12,11,44,"xxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end12
+13,12,44,"xxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end13
+14,13,44,"xxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end14
+15,14,44,"xxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end15
+16,15,44,"xxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end16
+17,16,44,"xxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end17
+18,17,44,"xxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end18
+19,18,44,"xxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end19
+20,19,44,"xxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end20
+21,20,44,"xxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end21
+22,21,44,"xxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end22
+23,22,44,"xxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end23
+24,23,44,"xxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end24
+25,24,44,"xxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end25
+26,25,44,"xxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end26
+27,26,44,"xxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end27
+28,27,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end28
+29,28,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end29
+30,29,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end30
+31,30,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end31
+32,31,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end32
+33,32,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end33
+34,33,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end34
+35,34,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end35
+36,35,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end36
+37,36,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end37
+38,37,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end38
+39,38,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end39
+40,39,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end40
+41,40,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end41
+42,41,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end42
+43,42,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end43
+44,43,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end44
+45,44,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end45
+46,45,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end46
+47,46,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end47
+48,47,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end48
+49,48,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end49
+50,49,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end50
+51,50,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end51
+52,51,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end52
+53,52,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end53
+54,53,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end54
+55,54,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end55
+56,55,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end56
+57,56,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end57
+58,57,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end58
+59,58,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end59
+60,59,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end60
+61,60,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end61
+62,61,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end62
+63,62,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end63
+64,63,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end64
+65,64,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end65
+66,65,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end66
+67,66,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end67
+68,67,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end68
+69,68,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end69
+70,69,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end70
+71,0,34,"""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end71
+72,1,34,"x""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end72
+73,2,34,"xx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end73
+74,3,34,"xxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end74
+75,4,34,"xxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end75
+76,5,34,"xxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end76
+77,6,34,"xxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end77
+78,7,34,"xxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end78
+79,8,34,"xxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end79
+80,9,34,"xxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end80
+81,10,34,"xxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end81
+82,11,34,"xxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end82
+83,12,34,"xxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end83
+84,13,34,"xxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end84
+85,14,34,"xxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end85
+86,15,34,"xxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end86
+87,16,34,"xxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end87
+88,17,34,"xxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end88
+89,18,34,"xxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end89
+90,19,34,"xxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end90
+91,20,34,"xxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end91
+92,21,34,"xxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end92
+93,22,34,"xxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end93
+94,23,34,"xxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end94
+95,24,34,"xxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end95
+96,25,34,"xxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end96
+97,26,34,"xxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end97
+98,27,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end98
+99,28,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end99
+100,29,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end100
+101,30,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end101
+102,31,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end102
+103,32,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end103
+104,33,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end104
+105,34,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end105
+106,35,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end106
+107,36,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end107
+108,37,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end108
+109,38,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end109
+110,39,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end110
+111,40,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end111
+112,41,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end112
+113,42,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end113
+114,43,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end114
+115,44,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end115
+116,45,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end116
+117,46,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end117
+118,47,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end118
+119,48,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end119
+120,49,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end120
+121,50,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end121
+122,51,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end122
+123,52,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end123
+124,53,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end124
+125,54,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end125
+126,55,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end126
+127,56,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end127
+128,57,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end128
+129,58,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end129
+130,59,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end130
+131,60,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end131
+132,61,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end132
+133,62,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end133
+134,63,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end134
+135,64,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end135
+136,65,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end136
+137,66,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end137
+138,67,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end138
+139,68,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end139
+140,69,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx""yyyyyyyyyyyyyyyy""zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end140
+141,0,10,"
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end141
+142,1,10,"x
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end142
+143,2,10,"xx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end143
+144,3,10,"xxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end144
+145,4,10,"xxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end145
+146,5,10,"xxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end146
+147,6,10,"xxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end147
+148,7,10,"xxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end148
+149,8,10,"xxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end149
+150,9,10,"xxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end150
+151,10,10,"xxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end151
+152,11,10,"xxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end152
+153,12,10,"xxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end153
+154,13,10,"xxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end154
+155,14,10,"xxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end155
+156,15,10,"xxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end156
+157,16,10,"xxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end157
+158,17,10,"xxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end158
+159,18,10,"xxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end159
+160,19,10,"xxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end160
+161,20,10,"xxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end161
+162,21,10,"xxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end162
+163,22,10,"xxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end163
+164,23,10,"xxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end164
+165,24,10,"xxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end165
+166,25,10,"xxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end166
+167,26,10,"xxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end167
+168,27,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end168
+169,28,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end169
+170,29,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end170
+171,30,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end171
+172,31,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end172
+173,32,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end173
+174,33,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end174
+175,34,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end175
+176,35,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end176
+177,36,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end177
+178,37,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end178
+179,38,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end179
+180,39,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end180
+181,40,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end181
+182,41,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end182
+183,42,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end183
+184,43,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end184
+185,44,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end185
+186,45,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end186
+187,46,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end187
+188,47,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end188
+189,48,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end189
+190,49,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end190
+191,50,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end191
+192,51,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end192
+193,52,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end193
+194,53,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end194
+195,54,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end195
+196,55,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end196
+197,56,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end197
+198,57,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end198
+199,58,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end199
+200,59,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end200
+201,60,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end201
+202,61,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end202
+203,62,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end203
+204,63,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end204
+205,64,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end205
+206,65,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end206
+207,66,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end207
+208,67,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end208
+209,68,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end209
+210,69,10,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx
+yyyyyyyyyyyyyyyy
+zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end210
+211,0,92,"\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end211
+212,1,92,"x\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end212
+213,2,92,"xx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end213
+214,3,92,"xxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end214
+215,4,92,"xxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end215
+216,5,92,"xxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end216
+217,6,92,"xxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end217
+218,7,92,"xxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end218
+219,8,92,"xxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end219
+220,9,92,"xxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end220
+221,10,92,"xxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end221
+222,11,92,"xxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end222
+223,12,92,"xxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end223
+224,13,92,"xxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end224
+225,14,92,"xxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end225
+226,15,92,"xxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end226
+227,16,92,"xxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end227
+228,17,92,"xxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end228
+229,18,92,"xxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end229
+230,19,92,"xxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end230
+231,20,92,"xxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end231
+232,21,92,"xxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end232
+233,22,92,"xxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end233
+234,23,92,"xxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end234
+235,24,92,"xxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end235
+236,25,92,"xxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end236
+237,26,92,"xxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end237
+238,27,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end238
+239,28,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end239
+240,29,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end240
+241,30,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end241
+242,31,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end242
+243,32,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end243
+244,33,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end244
+245,34,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end245
+246,35,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end246
+247,36,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end247
+248,37,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end248
+249,38,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end249
+250,39,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end250
+251,40,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end251
+252,41,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end252
+253,42,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end253
+254,43,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end254
+255,44,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end255
+256,45,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end256
+257,46,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end257
+258,47,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end258
+259,48,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end259
+260,49,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end260
+261,50,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end261
+262,51,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end262
+263,52,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end263
+264,53,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end264
+265,54,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end265
+266,55,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end266
+267,56,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end267
+268,57,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end268
+269,58,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end269
+270,59,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end270
+271,60,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end271
+272,61,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end272
+273,62,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end273
+274,63,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end274
+275,64,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end275
+276,65,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end276
+277,66,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end277
+278,67,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end278
+279,68,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end279
+280,69,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\yyyyyyyyyyyyyyyy\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end280
+281,0,59,";yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end281
+282,1,59,x;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end282
+283,2,59,"xx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end283
+284,3,59,xxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end284
+285,4,59,"xxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end285
+286,5,59,xxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end286
+287,6,59,"xxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end287
+288,7,59,xxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end288
+289,8,59,"xxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end289
+290,9,59,xxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end290
+291,10,59,"xxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end291
+292,11,59,xxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end292
+293,12,59,"xxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end293
+294,13,59,xxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end294
+295,14,59,"xxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end295
+296,15,59,xxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end296
+297,16,59,"xxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end297
+298,17,59,xxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end298
+299,18,59,"xxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end299
+300,19,59,xxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end300
+301,20,59,"xxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end301
+302,21,59,xxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end302
+303,22,59,"xxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end303
+304,23,59,xxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end304
+305,24,59,"xxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end305
+306,25,59,xxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end306
+307,26,59,"xxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end307
+308,27,59,xxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end308
+309,28,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end309
+310,29,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end310
+311,30,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end311
+312,31,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end312
+313,32,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end313
+314,33,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end314
+315,34,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end315
+316,35,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end316
+317,36,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end317
+318,37,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end318
+319,38,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end319
+320,39,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end320
+321,40,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end321
+322,41,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end322
+323,42,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end323
+324,43,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end324
+325,44,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end325
+326,45,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end326
+327,46,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end327
+328,47,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end328
+329,48,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end329
+330,49,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end330
+331,50,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end331
+332,51,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end332
+333,52,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end333
+334,53,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end334
+335,54,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end335
+336,55,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end336
+337,56,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end337
+338,57,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end338
+339,58,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end339
+340,59,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end340
+341,60,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end341
+342,61,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end342
+343,62,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end343
+344,63,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end344
+345,64,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end345
+346,65,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end346
+347,66,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end347
+348,67,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end348
+349,68,59,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end349
+350,69,59,xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;yyyyyyyyyyyyyyyy;zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz,end350
+\.
+COPY cs_csvesc FROM stdin CSV ESCAPE E'\\';
+0,0,0,,end0
+1,0,34,"\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end1
+2,1,34,"x\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end2
+3,2,34,"xx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end3
+4,3,34,"xxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end4
+5,4,34,"xxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end5
+6,5,34,"xxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end6
+7,6,34,"xxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end7
+8,7,34,"xxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end8
+9,8,34,"xxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end9
+10,9,34,"xxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end10
+11,10,34,"xxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end11
+12,11,34,"xxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end12
+13,12,34,"xxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end13
+14,13,34,"xxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end14
+15,14,34,"xxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end15
+16,15,34,"xxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end16
+17,16,34,"xxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end17
+18,17,34,"xxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end18
+19,18,34,"xxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end19
+20,19,34,"xxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end20
+21,20,34,"xxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end21
+22,21,34,"xxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end22
+23,22,34,"xxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end23
+24,23,34,"xxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end24
+25,24,34,"xxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end25
+26,25,34,"xxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end26
+27,26,34,"xxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end27
+28,27,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end28
+29,28,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end29
+30,29,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end30
+31,30,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end31
+32,31,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end32
+33,32,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end33
+34,33,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end34
+35,34,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end35
+36,35,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end36
+37,36,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end37
+38,37,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end38
+39,38,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end39
+40,39,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end40
+41,40,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end41
+42,41,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end42
+43,42,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end43
+44,43,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end44
+45,44,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end45
+46,45,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end46
+47,46,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end47
+48,47,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end48
+49,48,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end49
+50,49,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end50
+51,50,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end51
+52,51,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end52
+53,52,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end53
+54,53,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end54
+55,54,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end55
+56,55,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end56
+57,56,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end57
+58,57,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end58
+59,58,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end59
+60,59,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end60
+61,60,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end61
+62,61,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end62
+63,62,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end63
+64,63,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end64
+65,64,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end65
+66,65,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end66
+67,66,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end67
+68,67,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end68
+69,68,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end69
+70,69,34,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"yyyyyyyyyyyyyyyy\"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end70
+71,0,92,"\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end71
+72,1,92,"x\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end72
+73,2,92,"xx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end73
+74,3,92,"xxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end74
+75,4,92,"xxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end75
+76,5,92,"xxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end76
+77,6,92,"xxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end77
+78,7,92,"xxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end78
+79,8,92,"xxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end79
+80,9,92,"xxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end80
+81,10,92,"xxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end81
+82,11,92,"xxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end82
+83,12,92,"xxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end83
+84,13,92,"xxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end84
+85,14,92,"xxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end85
+86,15,92,"xxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end86
+87,16,92,"xxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end87
+88,17,92,"xxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end88
+89,18,92,"xxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end89
+90,19,92,"xxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end90
+91,20,92,"xxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end91
+92,21,92,"xxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end92
+93,22,92,"xxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end93
+94,23,92,"xxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end94
+95,24,92,"xxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end95
+96,25,92,"xxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end96
+97,26,92,"xxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end97
+98,27,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end98
+99,28,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end99
+100,29,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end100
+101,30,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end101
+102,31,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end102
+103,32,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end103
+104,33,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end104
+105,34,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end105
+106,35,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end106
+107,36,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end107
+108,37,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end108
+109,38,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end109
+110,39,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end110
+111,40,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end111
+112,41,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end112
+113,42,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end113
+114,43,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end114
+115,44,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end115
+116,45,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end116
+117,46,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end117
+118,47,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end118
+119,48,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end119
+120,49,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end120
+121,50,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end121
+122,51,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end122
+123,52,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end123
+124,53,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end124
+125,54,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end125
+126,55,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end126
+127,56,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end127
+128,57,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end128
+129,58,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end129
+130,59,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end130
+131,60,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end131
+132,61,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end132
+133,62,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end133
+134,63,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end134
+135,64,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end135
+136,65,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end136
+137,66,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end137
+138,67,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end138
+139,68,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end139
+140,69,92,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\\yyyyyyyyyyyyyyyy\\zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end140
+141,0,44,",yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end141
+142,1,44,"x,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end142
+143,2,44,"xx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end143
+144,3,44,"xxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end144
+145,4,44,"xxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end145
+146,5,44,"xxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end146
+147,6,44,"xxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end147
+148,7,44,"xxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end148
+149,8,44,"xxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end149
+150,9,44,"xxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end150
+151,10,44,"xxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end151
+152,11,44,"xxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end152
+153,12,44,"xxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end153
+154,13,44,"xxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end154
+155,14,44,"xxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end155
+156,15,44,"xxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end156
+157,16,44,"xxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end157
+158,17,44,"xxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end158
+159,18,44,"xxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end159
+160,19,44,"xxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end160
+161,20,44,"xxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end161
+162,21,44,"xxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end162
+163,22,44,"xxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end163
+164,23,44,"xxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end164
+165,24,44,"xxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end165
+166,25,44,"xxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end166
+167,26,44,"xxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end167
+168,27,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end168
+169,28,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end169
+170,29,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end170
+171,30,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end171
+172,31,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end172
+173,32,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end173
+174,33,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end174
+175,34,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end175
+176,35,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end176
+177,36,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end177
+178,37,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end178
+179,38,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end179
+180,39,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end180
+181,40,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end181
+182,41,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end182
+183,42,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end183
+184,43,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end184
+185,44,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end185
+186,45,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end186
+187,46,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end187
+188,47,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end188
+189,48,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end189
+190,49,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end190
+191,50,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end191
+192,51,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end192
+193,52,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end193
+194,53,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end194
+195,54,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end195
+196,55,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end196
+197,56,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end197
+198,57,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end198
+199,58,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end199
+200,59,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end200
+201,60,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end201
+202,61,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end202
+203,62,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end203
+204,63,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end204
+205,64,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end205
+206,65,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end206
+207,66,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end207
+208,67,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end208
+209,68,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end209
+210,69,44,"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx,yyyyyyyyyyyyyyyy,zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",end210
+\.
+SELECT count(*), count(a),
+       sum(CASE WHEN a = repeat('x', pos) || chr(code) || repeat('y', 16) || chr(code) || repeat('z', 40)
+                AND b = 'end' || id THEN 1 ELSE 0 END) AS ok
+FROM cs_text;
+SELECT count(*), count(a),
+       sum(CASE WHEN a = repeat('x', pos) || chr(code) || repeat('y', 16) || chr(code) || repeat('z', 40)
+                AND b = 'end' || id THEN 1 ELSE 0 END) AS ok
+FROM cs_pipe;
+SELECT count(*), count(a),
+       sum(CASE WHEN a = repeat('x', pos) || chr(code) || repeat('y', 16) || chr(code) || repeat('z', 40)
+                AND b = 'end' || id THEN 1 ELSE 0 END) AS ok
+FROM cs_csv;
+SELECT count(*), count(a),
+       sum(CASE WHEN a = repeat('x', pos) || chr(code) || repeat('y', 16) || chr(code) || repeat('z', 40)
+                AND b = 'end' || id THEN 1 ELSE 0 END) AS ok
+FROM cs_csvesc;
+DROP TABLE cs_text;
+DROP TABLE cs_pipe;
+DROP TABLE cs_csv;
+DROP TABLE cs_csvesc;
@@ -0,0 +1,77 @@
+--
+-- Plans dispatched again are sent to the QEs that already hold them as
+-- references (gp_dispatch_plan_cache_slots).  Cycle through more distinct
+-- plans than there are slots, so that plans are evicted and sent in full
+-- again, and make a QE fail in between, after which plans it was sent
+-- must not be referenced.
+--
+CREATE TABLE dpc (a int, b int) DISTRIBUTED BY (a);
+INSERT INTO dpc SELECT i, i % 10 FROM generate_series(1, 1000) i;
+SET gp_dispatch_plan_cache_slots = 8;
+PREPARE dpc1 AS SELECT count(*), sum(a) FROM dpc WHERE b = 0;
+PREPARE dpc2 AS SELECT count(*), sum(a) FROM dpc WHERE b = 1;
+PREPARE dpc3 AS SELECT count(*), sum(a) FROM dpc WHERE b = 2;
+PREPARE dpc4 AS SELECT count(*), sum(a) FROM dpc WHERE b = 3;
+PREPARE dpc5 AS SELECT count(*), sum(a) FROM dpc WHERE b = 4;
+PREPARE dpc6 AS SELECT count(*), sum(a) FROM dpc WHERE b = 5;
+PREPARE dpc7 AS SELECT count(*), sum(a) FROM dpc WHERE b = 6;
+PREPARE dpc8 AS SELECT count(*), sum(a) FROM dpc WHERE b = 7;
+PREPARE dpc9 AS SELECT count(*), sum(a) FROM dpc WHERE b = 8;
+PREPARE dpc10 AS SELECT count(*), sum(a) FROM dpc WHERE b = 9;
+PREPARE dpc_err(int) AS SELECT count(*) FROM dpc WHERE 10 / (a - $1) > 0;
+EXECUTE dpc1;
+EXECUTE dpc2;
+EXECUTE dpc3;
+EXECUTE dpc4;
+EXECUTE dpc5;
+EXECUTE dpc6;
+EXECUTE dpc7;
+EXECUTE dpc8;
+EXECUTE dpc9;
+EXECUTE dpc10;
+EXECUTE dpc10;
+EXECUTE dpc9;
+EXECUTE dpc8;
+EXECUTE dpc7;
+EXECUTE dpc6;
+EXECUTE dpc5;
+EXECUTE dpc4;
+EXECUTE dpc3;
+EXECUTE dpc2;
+EXECUTE dpc1;
+EXECUTE dpc_err(0);
+EXECUTE dpc_err(500);
+EXECUTE dpc1;
+EXECUTE dpc2;
+EXECUTE dpc3;
+EXECUTE dpc4;
+EXECUTE dpc5;
+EXECUTE dpc6;
+EXECUTE dpc7;
+EXECUTE dpc8;
+EXECUTE dpc9;
+EXECUTE dpc10;
+EXECUTE dpc_err(0);
+BEGIN;
+EXECUTE dpc1;
+EXECUTE dpc_err(500);
+ROLLBACK;
+EXECUTE dpc1;
+EXECUTE dpc2;
+SET gp_dispatch_plan_cache_slots = 0;
+EXECUTE dpc1;
+EXECUTE dpc1;
+EXECUTE dpc_err(0);
+RESET gp_dispatch_plan_cache_slots;
+DEALLOCATE dpc1;
+DEALLOCATE dpc2;
+DEALLOCATE dpc3;
+DEALLOCATE dpc4;
+DEALLOCATE dpc5;
+DEALLOCATE dpc6;
+DEALLOCATE dpc7;
+DEALLOCATE dpc8;
+DEALLOCATE dpc9;
+DEALLOCATE dpc10;
+DEALLOCATE dpc_err;
+DROP TABLE dpc;
@@ -0,0 +1,92 @@
+--
+-- Quals evaluated by ExecFastQual() must give the same rows as ExecQual().
+-- Every query is run with gp_enable_fast_qual on, then off.
+--
+CREATE TABLE fq_t (i2 int2, i4 int4, i8 int8, f4 float4, f8 float8, t text) DISTRIBUTED BY (i4);
+INSERT INTO fq_t VALUES (1, 1, 1, 1.5, 1.5, 'a');
+INSERT INTO fq_t VALUES (2, 2, 2, 'NaN', 'NaN', 'b');
+INSERT INTO fq_t VALUES (3, 3, 3, 3, 3, 'abc');
+INSERT INTO fq_t VALUES (NULL, 4, NULL, NULL, NULL, NULL);
+INSERT INTO fq_t VALUES (5, 5, 5000000000, 'Infinity', '-Infinity', 'a ');
+INSERT INTO fq_t VALUES (-6, 6, -6, -6.5, -6.5, '');
+CREATE TABLE fq_part (a int, junk int, b int, t text) DISTRIBUTED BY (a)
+PARTITION BY RANGE (b) (START (0) END (20) EVERY (10));
+-- the partition added after the drop has a different column layout
+ALTER TABLE fq_part DROP COLUMN junk;
+ALTER TABLE fq_part ADD PARTITION START (20) END (30);
+INSERT INTO fq_part VALUES (1, 5, 'x'), (2, 15, 'y'), (3, 25, 'x'), (4, 26, NULL), (5, 7, NULL);
+SET gp_enable_fast_qual = on;
+-- NULLs
+SELECT i4 FROM fq_t WHERE i2 IS NULL ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i8 IS NOT NULL AND f8 IS NULL ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i2 IS NULL OR (f8 < 0 AND t <> '') ORDER BY i4;
+SELECT i4 FROM fq_t WHERE NOT (i2 < 3) ORDER BY i4;
+-- integer types, also across widths
+SELECT i4 FROM fq_t WHERE i2 < 3 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i2 >= 2::int8 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i8 > 2147483647 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i2 <> 5::int8 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i8 = 3::int2 ORDER BY i4;
+-- floats: NaN sorts above everything and equals itself
+SELECT i4 FROM fq_t WHERE f8 > 1 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f8 = 'NaN' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f8 <> 'NaN' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f4 = 'NaN'::float8 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f4 < 'Infinity'::float8 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f4 >= 'NaN'::float4 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f4 <= 1.5::float4 ORDER BY i4;
+-- text
+SELECT i4 FROM fq_t WHERE t = 'a' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE t <> 'a' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE t = '' ORDER BY i4;
+-- IN lists with NULL elements
+SELECT i4 FROM fq_t WHERE i4 IN (1, 3, NULL) ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i2 IN (NULL, 2) OR t = 'abc' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i8 IN (5000000000, NULL, -6) ORDER BY i4;
+SELECT i4 FROM fq_t WHERE t IN ('a', NULL, 'b') ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f8 IN ('NaN', 1.5) ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i4 NOT IN (1, NULL) ORDER BY i4;
+-- a partitioned table whose partitions have different layouts
+SELECT a FROM fq_part WHERE t = 'x' ORDER BY a;
+SELECT a FROM fq_part WHERE b >= 5 AND t IS NULL ORDER BY a;
+SELECT a FROM fq_part WHERE b IN (15, 25, NULL) OR t <> 'x' ORDER BY a;
+SELECT a FROM fq_part WHERE a > 1 AND b < 26 ORDER BY a;
+SET gp_enable_fast_qual = off;
+-- NULLs
+SELECT i4 FROM fq_t WHERE i2 IS NULL ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i8 IS NOT NULL AND f8 IS NULL ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i2 IS NULL OR (f8 < 0 AND t <> '') ORDER BY i4;
+SELECT i4 FROM fq_t WHERE NOT (i2 < 3) ORDER BY i4;
+-- integer types, also across widths
+SELECT i4 FROM fq_t WHERE i2 < 3 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i2 >= 2::int8 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i8 > 2147483647 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i2 <> 5::int8 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i8 = 3::int2 ORDER BY i4;
+-- floats: NaN sorts above everything and equals itself
+SELECT i4 FROM fq_t WHERE f8 > 1 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f8 = 'NaN' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f8 <> 'NaN' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f4 = 'NaN'::float8 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f4 < 'Infinity'::float8 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f4 >= 'NaN'::float4 ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f4 <= 1.5::float4 ORDER BY i4;
+-- text
+SELECT i4 FROM fq_t WHERE t = 'a' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE t <> 'a' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE t = '' ORDER BY i4;
+-- IN lists with NULL elements
+SELECT i4 FROM fq_t WHERE i4 IN (1, 3, NULL) ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i2 IN (NULL, 2) OR t = 'abc' ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i8 IN (5000000000, NULL, -6) ORDER BY i4;
+SELECT i4 FROM fq_t WHERE t IN ('a', NULL, 'b') ORDER BY i4;
+SELECT i4 FROM fq_t WHERE f8 IN ('NaN', 1.5) ORDER BY i4;
+SELECT i4 FROM fq_t WHERE i4 NOT IN (1, NULL) ORDER BY i4;
+-- a partitioned table whose partitions have different layouts
+SELECT a FROM fq_part WHERE t = 'x' ORDER BY a;
+SELECT a FROM fq_part WHERE b >= 5 AND t IS NULL ORDER BY a;
+SELECT a FROM fq_part WHERE b IN (15, 25, NULL) OR t <> 'x' ORDER BY a;
+SELECT a FROM fq_part WHERE a > 1 AND b < 26 ORDER BY a;
+RESET gp_enable_fast_qual;
+DROP TABLE fq_t;
+DROP TABLE fq_part;
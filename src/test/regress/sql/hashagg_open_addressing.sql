@@ -0,0 +1,38 @@
+--
+-- Hash aggregates on an open-addressing table (gp_hashagg_open_addressing)
+-- must return what they return on hash chains.  With 2MB of statement_mem
+-- the tables spill and are reloaded.
+--
+CREATE TABLE hao (i int, k int, t text) DISTRIBUTED BY (i);
+INSERT INTO hao
+SELECT i, CASE WHEN i % 1000 = 0 THEN NULL ELSE i % 50000 END,
+       CASE WHEN i % 777 = 0 THEN NULL ELSE 'grp' || (i % 30000) END
+FROM generate_series(1, 200000) i;
+SET enable_groupagg = off;
+SET statement_mem = '2MB';
+SET gp_hashagg_open_addressing = on;
+-- int keys, with a NULL group
+SELECT count(*), sum(c), sum(s) FROM (SELECT k, count(*) AS c, sum(i) AS s FROM hao GROUP BY k) g;
+SELECT c, s FROM (SELECT k, count(*) AS c, sum(i) AS s FROM hao GROUP BY k) g WHERE k IS NULL;
+-- by-reference keys, with a NULL group
+SELECT count(*), sum(c), sum(length(t)) FROM (SELECT t, count(*) AS c FROM hao GROUP BY t) g;
+SELECT c FROM (SELECT t, count(*) AS c FROM hao GROUP BY t) g WHERE t IS NULL;
+-- two keys
+SELECT count(*), sum(c), sum(s) FROM (SELECT k % 100, t, count(*) AS c, sum(i) AS s FROM hao GROUP BY 1, 2) g;
+-- by-reference transition values
+SELECT count(*), count(mt), sum(length(mt)) FROM (SELECT k, max(t) AS mt FROM hao GROUP BY k) g;
+SET gp_hashagg_open_addressing = off;
+-- int keys, with a NULL group
+SELECT count(*), sum(c), sum(s) FROM (SELECT k, count(*) AS c, sum(i) AS s FROM hao GROUP BY k) g;
+SELECT c, s FROM (SELECT k, count(*) AS c, sum(i) AS s FROM hao GROUP BY k) g WHERE k IS NULL;
+-- by-reference keys, with a NULL group
+SELECT count(*), sum(c), sum(length(t)) FROM (SELECT t, count(*) AS c FROM hao GROUP BY t) g;
+SELECT c FROM (SELECT t, count(*) AS c FROM hao GROUP BY t) g WHERE t IS NULL;
+-- two keys
+SELECT count(*), sum(c), sum(s) FROM (SELECT k % 100, t, count(*) AS c, sum(i) AS s FROM hao GROUP BY 1, 2) g;
+-- by-reference transition values
+SELECT count(*), count(mt), sum(length(mt)) FROM (SELECT k, max(t) AS mt FROM hao GROUP BY k) g;
+RESET gp_hashagg_open_addressing;
+RESET statement_mem;
+RESET enable_groupagg;
+DROP TABLE hao;
@@ -0,0 +1,34 @@
+--
+-- The bottom stage of a two stage hashagg that passes its input through
+-- (gp_hashagg_stream_passthrough_ratio) must not change the results.  The
+-- first queries decide after the first 10000 rows of a segment, the last
+-- ones, with 1MB of statement_mem, when the table fills up.
+--
+CREATE TABLE hapt (i int, k int, t text) DISTRIBUTED BY (i);
+INSERT INTO hapt
+SELECT i, i % 90000, CASE WHEN i % 501 = 0 THEN NULL ELSE rpad((i % 90000)::text, 200, 'x') END
+FROM generate_series(1, 100000) i;
+SET enable_groupagg = off;
+SET gp_hashagg_streambottom = on;
+SET gp_hashagg_stream_passthrough_ratio = 0.5;
+SELECT count(*), sum(c), sum(s), sum(mx - mn) FROM
+  (SELECT k, count(*) AS c, sum(i) AS s, min(i) AS mn, max(i) AS mx FROM hapt GROUP BY k) g;
+SELECT k, count(*), sum(i), count(t) FROM hapt WHERE k IN (123, 89999) GROUP BY k ORDER BY k;
+SELECT count(*), sum(c) FROM (SELECT k % 10, count(*) AS c FROM hapt GROUP BY 1) g;
+SET statement_mem = '1MB';
+SELECT count(*), sum(c), sum(s) FROM (SELECT t, count(*) AS c, sum(i) AS s FROM hapt GROUP BY t) g;
+SELECT c, s FROM (SELECT t, count(*) AS c, sum(i) AS s FROM hapt GROUP BY t) g WHERE t IS NULL;
+RESET statement_mem;
+SET gp_hashagg_stream_passthrough_ratio = 0;
+SELECT count(*), sum(c), sum(s), sum(mx - mn) FROM
+  (SELECT k, count(*) AS c, sum(i) AS s, min(i) AS mn, max(i) AS mx FROM hapt GROUP BY k) g;
+SELECT k, count(*), sum(i), count(t) FROM hapt WHERE k IN (123, 89999) GROUP BY k ORDER BY k;
+SELECT count(*), sum(c) FROM (SELECT k % 10, count(*) AS c FROM hapt GROUP BY 1) g;
+SET statement_mem = '1MB';
+SELECT count(*), sum(c), sum(s) FROM (SELECT t, count(*) AS c, sum(i) AS s FROM hapt GROUP BY t) g;
+SELECT c, s FROM (SELECT t, count(*) AS c, sum(i) AS s FROM hapt GROUP BY t) g WHERE t IS NULL;
+RESET statement_mem;
+RESET gp_hashagg_stream_passthrough_ratio;
+RESET gp_hashagg_streambottom;
+RESET enable_groupagg;
+DROP TABLE hapt;
@@ -0,0 +1,39 @@
+--
+-- Hash joins whose buckets are linked by several threads
+-- (gp_hashjoin_build_threads) must return what they return with one.
+-- With 2MB of statement_mem the inner side is split into several
+-- batches, and the subqueries rescan the join, keeping or rebuilding
+-- its inner side.
+--
+CREATE TABLE hjt_outer (k int, g int, pad text) DISTRIBUTED BY (k);
+CREATE TABLE hjt_inner (k int, g int, pad text) DISTRIBUTED BY (k);
+INSERT INTO hjt_outer SELECT i % 60000, i % 11, repeat('x', 50) FROM generate_series(1, 100000) i;
+INSERT INTO hjt_inner SELECT (i * 7) % 50000, i % 13, repeat('y', 50) FROM generate_series(1, 60000) i;
+SET enable_nestloop = off;
+SET enable_mergejoin = off;
+SET statement_mem = '2MB';
+SET gp_hashjoin_radix_partition = 1;
+SET gp_hashjoin_build_threads = 4;
+SELECT count(*), sum(o.g), sum(i.g) FROM hjt_outer o JOIN hjt_inner i ON o.k = i.k;
+SELECT count(*), count(i.k) FROM hjt_outer o LEFT JOIN hjt_inner i ON o.k = i.k;
+SELECT count(*), sum(o.k) FROM hjt_outer o JOIN hjt_inner i ON o.k = i.k AND o.g = i.g;
+SELECT k, (SELECT count(*) FROM hjt_outer o JOIN hjt_inner i ON o.k = i.k WHERE o.g < s.k)
+FROM (SELECT generate_series(0, 8, 4) AS k) s ORDER BY k;
+SELECT k, (SELECT count(*) FROM hjt_outer o JOIN hjt_inner i ON o.k = i.k WHERE i.g < s.k)
+FROM (SELECT generate_series(0, 8, 4) AS k) s ORDER BY k;
+SET gp_hashjoin_build_threads = 0;
+SET gp_hashjoin_radix_partition = 0;
+SELECT count(*), sum(o.g), sum(i.g) FROM hjt_outer o JOIN hjt_inner i ON o.k = i.k;
+SELECT count(*), count(i.k) FROM hjt_outer o LEFT JOIN hjt_inner i ON o.k = i.k;
+SELECT count(*), sum(o.k) FROM hjt_outer o JOIN hjt_inner i ON o.k = i.k AND o.g = i.g;
+SELECT k, (SELECT count(*) FROM hjt_outer o JOIN hjt_inner i ON o.k = i.k WHERE o.g < s.k)
+FROM (SELECT generate_series(0, 8, 4) AS k) s ORDER BY k;
+SELECT k, (SELECT count(*) FROM hjt_outer o JOIN hjt_inner i ON o.k = i.k WHERE i.g < s.k)
+FROM (SELECT generate_series(0, 8, 4) AS k) s ORDER BY k;
+RESET gp_hashjoin_build_threads;
+RESET gp_hashjoin_radix_partition;
+RESET statement_mem;
+RESET enable_mergejoin;
+RESET enable_nestloop;
+DROP TABLE hjt_outer;
+DROP TABLE hjt_inner;
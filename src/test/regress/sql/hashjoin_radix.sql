@@ -0,0 +1,35 @@
+--
+-- Hash joins on a radix-partitioned table (gp_hashjoin_radix_partition)
+-- must return what they return without it.  With 2MB of statement_mem the
+-- inner side is split into several batches, and the subqueries rescan
+-- the join, keeping or rebuilding its inner side.
+--
+CREATE TABLE hjr_outer (k int, g int, pad text) DISTRIBUTED BY (k);
+CREATE TABLE hjr_inner (k int, g int, pad text) DISTRIBUTED BY (k);
+INSERT INTO hjr_outer SELECT i % 60000, i % 11, repeat('x', 50) FROM generate_series(1, 100000) i;
+INSERT INTO hjr_inner SELECT (i * 7) % 50000, i % 13, repeat('y', 50) FROM generate_series(1, 60000) i;
+SET enable_nestloop = off;
+SET enable_mergejoin = off;
+SET statement_mem = '2MB';
+SET gp_hashjoin_radix_partition = 1;
+SELECT count(*), sum(o.g), sum(i.g) FROM hjr_outer o JOIN hjr_inner i ON o.k = i.k;
+SELECT count(*), count(i.k) FROM hjr_outer o LEFT JOIN hjr_inner i ON o.k = i.k;
+SELECT count(*), sum(o.k) FROM hjr_outer o JOIN hjr_inner i ON o.k = i.k AND o.g = i.g;
+SELECT k, (SELECT count(*) FROM hjr_outer o JOIN hjr_inner i ON o.k = i.k WHERE o.g < s.k)
+FROM (SELECT generate_series(0, 8, 4) AS k) s ORDER BY k;
+SELECT k, (SELECT count(*) FROM hjr_outer o JOIN hjr_inner i ON o.k = i.k WHERE i.g < s.k)
+FROM (SELECT generate_series(0, 8, 4) AS k) s ORDER BY k;
+SET gp_hashjoin_radix_partition = 0;
+SELECT count(*), sum(o.g), sum(i.g) FROM hjr_outer o JOIN hjr_inner i ON o.k = i.k;
+SELECT count(*), count(i.k) FROM hjr_outer o LEFT JOIN hjr_inner i ON o.k = i.k;
+SELECT count(*), sum(o.k) FROM hjr_outer o JOIN hjr_inner i ON o.k = i.k AND o.g = i.g;
+SELECT k, (SELECT count(*) FROM hjr_outer o JOIN hjr_inner i ON o.k = i.k WHERE o.g < s.k)
+FROM (SELECT generate_series(0, 8, 4) AS k) s ORDER BY k;
+SELECT k, (SELECT count(*) FROM hjr_outer o JOIN hjr_inner i ON o.k = i.k WHERE i.g < s.k)
+FROM (SELECT generate_series(0, 8, 4) AS k) s ORDER BY k;
+RESET gp_hashjoin_radix_partition;
+RESET statement_mem;
+RESET enable_mergejoin;
+RESET enable_nestloop;
+DROP TABLE hjr_outer;
+DROP TABLE hjr_inner;
@@ -0,0 +1,58 @@
+--
+-- Hash joins with the runtime filter pushed down to the outer scan
+-- (gp_hashjoin_runtime_filter) must return what they return without it.
+--
+CREATE TABLE rf_outer (a int, b int, c text) DISTRIBUTED BY (a);
+CREATE TABLE rf_inner (a int, a8 int8, b int, c text) DISTRIBUTED BY (a);
+INSERT INTO rf_outer
+SELECT CASE WHEN i % 97 = 0 THEN NULL ELSE i % 1000 END, i % 7, 'v' || (i % 13)
+FROM generate_series(1, 10000) i;
+INSERT INTO rf_inner
+SELECT CASE WHEN i % 50 = 0 THEN NULL ELSE i * 3 END,
+       CASE WHEN i % 50 = 0 THEN NULL ELSE i * 3 END, i % 7, 'v' || (i % 17)
+FROM generate_series(1, 200) i;
+SET enable_nestloop = off;
+SET enable_mergejoin = off;
+SET gp_hashjoin_runtime_filter = 1;
+-- NULL keys on both sides never join
+SELECT count(*), count(DISTINCT o.a), sum(o.b) FROM rf_outer o JOIN rf_inner i ON o.a = i.a;
+-- multi-column keys
+SELECT count(*), sum(o.a), sum(o.b) FROM rf_outer o JOIN rf_inner i ON o.a = i.a AND o.b = i.b;
+-- cross-type hash operator, int4 = int8
+SELECT count(*), sum(o.a), sum(i.a8) FROM rf_outer o JOIN rf_inner i ON o.a = i.a8;
+-- an outer key that is an expression over the scan
+SELECT count(*), sum(o.a) FROM rf_outer o JOIN rf_inner i ON o.a + 1 = i.a;
+-- text keys
+SELECT count(*), sum(o.a), sum(i.b) FROM rf_outer o JOIN rf_inner i ON o.c = i.c;
+-- IN join
+SELECT count(*), sum(o.b) FROM rf_outer o WHERE o.a IN (SELECT a FROM rf_inner);
+-- rescans that keep the inner side, and so the filter
+SELECT k, (SELECT count(*) FROM rf_outer o JOIN rf_inner i ON o.a = i.a WHERE o.b < s.k)
+FROM (SELECT generate_series(0, 7) AS k) s ORDER BY k;
+-- rescans that rebuild the inner side, and so the filter
+SELECT k, (SELECT count(*) FROM rf_outer o JOIN rf_inner i ON o.a = i.a WHERE i.b < s.k)
+FROM (SELECT generate_series(0, 7) AS k) s ORDER BY k;
+SET gp_hashjoin_runtime_filter = 0;
+-- NULL keys on both sides never join
+SELECT count(*), count(DISTINCT o.a), sum(o.b) FROM rf_outer o JOIN rf_inner i ON o.a = i.a;
+-- multi-column keys
+SELECT count(*), sum(o.a), sum(o.b) FROM rf_outer o JOIN rf_inner i ON o.a = i.a AND o.b = i.b;
+-- cross-type hash operator, int4 = int8
+SELECT count(*), sum(o.a), sum(i.a8) FROM rf_outer o JOIN rf_inner i ON o.a = i.a8;
+-- an outer key that is an expression over the scan
+SELECT count(*), sum(o.a) FROM rf_outer o JOIN rf_inner i ON o.a + 1 = i.a;
+-- text keys
+SELECT count(*), sum(o.a), sum(i.b) FROM rf_outer o JOIN rf_inner i ON o.c = i.c;
+-- IN join
+SELECT count(*), sum(o.b) FROM rf_outer o WHERE o.a IN (SELECT a FROM rf_inner);
+-- rescans that keep the inner side, and so the filter
+SELECT k, (SELECT count(*) FROM rf_outer o JOIN rf_inner i ON o.a = i.a WHERE o.b < s.k)
+FROM (SELECT generate_series(0, 7) AS k) s ORDER BY k;
+-- rescans that rebuild the inner side, and so the filter
+SELECT k, (SELECT count(*) FROM rf_outer o JOIN rf_inner i ON o.a = i.a WHERE i.b < s.k)
+FROM (SELECT generate_series(0, 7) AS k) s ORDER BY k;
+RESET gp_hashjoin_runtime_filter;
+RESET enable_mergejoin;
+RESET enable_nestloop;
+DROP TABLE rf_outer;
+DROP TABLE rf_inner;
@@ -0,0 +1,33 @@
+--
+-- ORDER BY ... LIMIT on a multi-key sort that spills, with and without
+-- bounded runs (gp_mk_sort_bounded_spill).  The results must not differ.
+-- With 1MB of statement_mem the sorts spill (tested with 2 segments, with
+-- more segments they may not).
+--
+CREATE TABLE mksort_bounded (dkey int, jkey int, grp int, tkey text, pad text) DISTRIBUTED BY (dkey);
+INSERT INTO mksort_bounded
+SELECT i, (i * 7919) % 20000, i % 7, 'k' || lpad(((i * 7919) % 20000 / 4)::text, 5, '0'),
+       rpad(md5(i::text), 400, md5((i + 1)::text))
+FROM generate_series(1, 20000) i;
+SET gp_enable_mk_sort = on;
+SET statement_mem = '1MB';
+SET gp_mk_sort_bounded_spill = on;
+SELECT dkey, jkey FROM mksort_bounded ORDER BY jkey LIMIT 5;
+SELECT dkey, jkey FROM mksort_bounded ORDER BY jkey DESC LIMIT 5;
+SELECT grp, jkey, dkey FROM mksort_bounded ORDER BY grp, jkey DESC LIMIT 5;
+SELECT tkey, dkey FROM mksort_bounded ORDER BY tkey, dkey LIMIT 6;
+SELECT tkey, dkey FROM mksort_bounded ORDER BY tkey DESC, dkey DESC LIMIT 6;
+SELECT dkey, jkey FROM mksort_bounded ORDER BY jkey LIMIT 3 OFFSET 2990;
+SELECT count(*), sum(jkey) FROM (SELECT jkey FROM mksort_bounded ORDER BY jkey LIMIT 3000) s;
+SET gp_mk_sort_bounded_spill = off;
+SELECT dkey, jkey FROM mksort_bounded ORDER BY jkey LIMIT 5;
+SELECT dkey, jkey FROM mksort_bounded ORDER BY jkey DESC LIMIT 5;
+SELECT grp, jkey, dkey FROM mksort_bounded ORDER BY grp, jkey DESC LIMIT 5;
+SELECT tkey, dkey FROM mksort_bounded ORDER BY tkey, dkey LIMIT 6;
+SELECT tkey, dkey FROM mksort_bounded ORDER BY tkey DESC, dkey DESC LIMIT 6;
+SELECT dkey, jkey FROM mksort_bounded ORDER BY jkey LIMIT 3 OFFSET 2990;
+SELECT count(*), sum(jkey) FROM (SELECT jkey FROM mksort_bounded ORDER BY jkey LIMIT 3000) s;
+RESET gp_mk_sort_bounded_spill;
+RESET statement_mem;
+RESET gp_enable_mk_sort;
+DROP TABLE mksort_bounded;
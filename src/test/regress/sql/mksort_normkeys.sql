@@ -0,0 +1,46 @@
+--
+-- Multi-key sorts on normalized keys (gp_mk_sort_normalized_keys) must
+-- order like the sort functions do: NaN above everything, -0 equal to 0,
+-- numerics that share leading digits, and text that shares the first 8
+-- bytes.  Every query is run with the setting on, then off.
+--
+CREATE TABLE mksort_normkeys (id int, f8 float8, f4 float4, n numeric, t text, i8 int8) DISTRIBUTED BY (id);
+INSERT INTO mksort_normkeys VALUES (1, '-Infinity', '-Infinity', -1234567890123456789.2, '', -9223372036854775808);
+INSERT INTO mksort_normkeys VALUES (2, -1.5, -1.5, -1234567890123456789.1, 'abcdefgg', -1);
+INSERT INTO mksort_normkeys VALUES (3, -1e-300, -1e-30, 0.000000000000000001, 'abcdefgh', 0);
+INSERT INTO mksort_normkeys VALUES (4, '-0', '-0', -0.0, 'abcdefgh1', 1);
+INSERT INTO mksort_normkeys VALUES (5, 0, 0, 0, 'abcdefgha', 9223372036854775807);
+INSERT INTO mksort_normkeys VALUES (6, 1e-300, 1e-30, 0.000000000000000002, 'abcdefghaa', 4294967296);
+INSERT INTO mksort_normkeys VALUES (7, 1.5, 1.5, 1234567890123456789.1, 'abcdefghb', -4294967296);
+INSERT INTO mksort_normkeys VALUES (8, 'Infinity', 'Infinity', 1234567890123456789.2, 'abcdefgi', 2);
+INSERT INTO mksort_normkeys VALUES (9, 'NaN', 'NaN', 'NaN', 'abcdefgh', 0);
+INSERT INTO mksort_normkeys VALUES (10, NULL, NULL, NULL, NULL, NULL);
+INSERT INTO mksort_normkeys VALUES (11, 1e300, 3e38, 1234567890123456789, 'abcdefgha', 1);
+SET gp_enable_mk_sort = on;
+SET gp_mk_sort_normalized_keys = on;
+SELECT id FROM mksort_normkeys ORDER BY f8, id;
+SELECT id FROM mksort_normkeys ORDER BY f8 DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY f4, id;
+SELECT id FROM mksort_normkeys ORDER BY f4 DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY n, id;
+SELECT id FROM mksort_normkeys ORDER BY n DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY t, id;
+SELECT id FROM mksort_normkeys ORDER BY t DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY i8, id;
+SELECT id FROM mksort_normkeys ORDER BY i8 DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY t, n DESC, f8;
+SET gp_mk_sort_normalized_keys = off;
+SELECT id FROM mksort_normkeys ORDER BY f8, id;
+SELECT id FROM mksort_normkeys ORDER BY f8 DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY f4, id;
+SELECT id FROM mksort_normkeys ORDER BY f4 DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY n, id;
+SELECT id FROM mksort_normkeys ORDER BY n DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY t, id;
+SELECT id FROM mksort_normkeys ORDER BY t DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY i8, id;
+SELECT id FROM mksort_normkeys ORDER BY i8 DESC, id;
+SELECT id FROM mksort_normkeys ORDER BY t, n DESC, f8;
+RESET gp_mk_sort_normalized_keys;
+RESET gp_enable_mk_sort;
+DROP TABLE mksort_normkeys;
@@ -0,0 +1,36 @@
+--
+-- In-memory multi-key sorts on int4 keys split among several threads
+-- (gp_mksort_threads) must order like a sort in one thread.  The row
+-- numbers sample the order of a sort of every row, the merge join sorts
+-- both sides on two keys.
+--
+CREATE TABLE mkst (id int, a int, b int, c int) DISTRIBUTED BY (id);
+INSERT INTO mkst
+SELECT i, CASE WHEN i % 997 = 0 THEN NULL ELSE (i * 7919) % 1000 END, (i * 31) % 100000, i % 5
+FROM generate_series(1, 300000) i;
+SET gp_enable_mk_sort = on;
+SET enable_hashjoin = off;
+SET enable_nestloop = off;
+SET enable_mergejoin = on;
+SET gp_mksort_threads = 4;
+SELECT rn, a, b FROM
+  (SELECT a, b, row_number() OVER (ORDER BY a, b DESC) AS rn FROM mkst) s
+WHERE rn IN (1, 2, 1000, 150000, 299700, 300000) ORDER BY rn;
+SELECT rn, c, a FROM
+  (SELECT c, a, row_number() OVER (ORDER BY c DESC, a DESC) AS rn FROM mkst) s
+WHERE rn IN (1, 100, 60000, 60001, 299999) ORDER BY rn;
+SELECT count(*), sum(x.b), sum(y.c) FROM mkst x JOIN mkst y ON x.a = y.a AND x.b = y.b;
+SET gp_mksort_threads = 0;
+SELECT rn, a, b FROM
+  (SELECT a, b, row_number() OVER (ORDER BY a, b DESC) AS rn FROM mkst) s
+WHERE rn IN (1, 2, 1000, 150000, 299700, 300000) ORDER BY rn;
+SELECT rn, c, a FROM
+  (SELECT c, a, row_number() OVER (ORDER BY c DESC, a DESC) AS rn FROM mkst) s
+WHERE rn IN (1, 100, 60000, 60001, 299999) ORDER BY rn;
+SELECT count(*), sum(x.b), sum(y.c) FROM mkst x JOIN mkst y ON x.a = y.a AND x.b = y.b;
+RESET gp_mksort_threads;
+RESET enable_mergejoin;
+RESET enable_nestloop;
+RESET enable_hashjoin;
+RESET gp_enable_mk_sort;
+DROP TABLE mkst;
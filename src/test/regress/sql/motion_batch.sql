@@ -0,0 +1,40 @@
+--
+-- Motions that send their tuples in column-wise batches (gp_motion_batch_size)
+-- must deliver what they deliver one tuple at a time: redistribute,
+-- broadcast and order-preserving gather, with NULLs and wide values.
+--
+CREATE TABLE mtb (id int, k int, t text, n numeric, f float8, b bool, w text) DISTRIBUTED BY (id);
+INSERT INTO mtb
+SELECT i, i % 5000, CASE WHEN i % 13 = 0 THEN NULL ELSE 'row' || i END, i % 1000 + 0.25, i * 0.5,
+       CASE WHEN i % 17 = 0 THEN NULL ELSE i % 3 = 0 END,
+       CASE WHEN i % 1000 = 0 THEN repeat(md5(i::text), 100) END
+FROM generate_series(1, 50000) i;
+CREATE TABLE mtb_ranges (lo float8, hi float8) DISTRIBUTED BY (lo);
+INSERT INTO mtb_ranges SELECT i * 2500, i * 2500 + 99 FROM generate_series(0, 9) i;
+SET gp_motion_batch_size = 64;
+-- redistribute
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtb x JOIN mtb y ON x.k = y.id;
+-- broadcast
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtb x JOIN mtb_ranges r ON x.f BETWEEN r.lo AND r.hi;
+-- order-preserving gather
+SELECT id, k, t, n, f, b, length(w) FROM mtb ORDER BY k DESC, id LIMIT 5 OFFSET 30000;
+SELECT id, length(w), md5(w) FROM mtb WHERE w IS NOT NULL ORDER BY id LIMIT 3;
+SET gp_motion_batch_size = 1000;
+-- redistribute
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtb x JOIN mtb y ON x.k = y.id;
+-- broadcast
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtb x JOIN mtb_ranges r ON x.f BETWEEN r.lo AND r.hi;
+-- order-preserving gather
+SELECT id, k, t, n, f, b, length(w) FROM mtb ORDER BY k DESC, id LIMIT 5 OFFSET 30000;
+SELECT id, length(w), md5(w) FROM mtb WHERE w IS NOT NULL ORDER BY id LIMIT 3;
+SET gp_motion_batch_size = 0;
+-- redistribute
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtb x JOIN mtb y ON x.k = y.id;
+-- broadcast
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtb x JOIN mtb_ranges r ON x.f BETWEEN r.lo AND r.hi;
+-- order-preserving gather
+SELECT id, k, t, n, f, b, length(w) FROM mtb ORDER BY k DESC, id LIMIT 5 OFFSET 30000;
+SELECT id, length(w), md5(w) FROM mtb WHERE w IS NOT NULL ORDER BY id LIMIT 3;
+RESET gp_motion_batch_size;
+DROP TABLE mtb;
+DROP TABLE mtb_ranges;
@@ -0,0 +1,44 @@
+--
+-- Motions that compress their chunks (gp_motion_compress_level) must deliver
+-- what they deliver uncompressed, tuple at a time and in batches:
+-- redistribute, broadcast and order-preserving gather, with NULLs and
+-- wide values.
+--
+CREATE TABLE mtc (id int, k int, t text, n numeric, f float8, b bool, w text) DISTRIBUTED BY (id);
+INSERT INTO mtc
+SELECT i, i % 5000, CASE WHEN i % 13 = 0 THEN NULL ELSE 'row' || i END, i % 1000 + 0.25, i * 0.5,
+       CASE WHEN i % 17 = 0 THEN NULL ELSE i % 3 = 0 END,
+       CASE WHEN i % 1000 = 0 THEN repeat(md5(i::text), 100) END
+FROM generate_series(1, 50000) i;
+CREATE TABLE mtc_ranges (lo float8, hi float8) DISTRIBUTED BY (lo);
+INSERT INTO mtc_ranges SELECT i * 2500, i * 2500 + 99 FROM generate_series(0, 9) i;
+SET gp_motion_compress_level = 1;
+-- redistribute
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtc x JOIN mtc y ON x.k = y.id;
+-- broadcast
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtc x JOIN mtc_ranges r ON x.f BETWEEN r.lo AND r.hi;
+-- order-preserving gather
+SELECT id, k, t, n, f, b, length(w) FROM mtc ORDER BY k DESC, id LIMIT 5 OFFSET 30000;
+SELECT id, length(w), md5(w) FROM mtc WHERE w IS NOT NULL ORDER BY id LIMIT 3;
+SET gp_motion_compress_level = 9;
+SET gp_motion_batch_size = 256;
+-- redistribute
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtc x JOIN mtc y ON x.k = y.id;
+-- broadcast
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtc x JOIN mtc_ranges r ON x.f BETWEEN r.lo AND r.hi;
+-- order-preserving gather
+SELECT id, k, t, n, f, b, length(w) FROM mtc ORDER BY k DESC, id LIMIT 5 OFFSET 30000;
+SELECT id, length(w), md5(w) FROM mtc WHERE w IS NOT NULL ORDER BY id LIMIT 3;
+SET gp_motion_compress_level = 0;
+SET gp_motion_batch_size = 0;
+-- redistribute
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtc x JOIN mtc y ON x.k = y.id;
+-- broadcast
+SELECT count(*), count(x.t), sum(length(x.t)), sum(x.n), sum(x.f), count(NULLIF(x.b, false)), sum(length(x.w)) FROM mtc x JOIN mtc_ranges r ON x.f BETWEEN r.lo AND r.hi;
+-- order-preserving gather
+SELECT id, k, t, n, f, b, length(w) FROM mtc ORDER BY k DESC, id LIMIT 5 OFFSET 30000;
+SELECT id, length(w), md5(w) FROM mtc WHERE w IS NOT NULL ORDER BY id LIMIT 3;
+RESET gp_motion_batch_size;
+RESET gp_motion_compress_level;
+DROP TABLE mtc;
+DROP TABLE mtc_ranges;
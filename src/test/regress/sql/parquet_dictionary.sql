@@ -0,0 +1,51 @@
+--
+-- Parquet column chunks written with dictionary encoding
+-- (gp_parquet_dictionary_encoding) must read back like plain ones.  With
+-- 1024-byte pages the dictionary of highc overflows, and the rest of its
+-- chunk falls back to plain encoding; lowc stays dictionary encoded.
+-- pqd_mixed holds row groups of both encodings.
+--
+CREATE TABLE pqd_dict (id int, lowc text, highc text, i4 int, f8 float8, d date, n numeric, b bool) WITH (appendonly=true, orientation=parquet, pagesize=1024) DISTRIBUTED BY (id);
+CREATE TABLE pqd_plain (id int, lowc text, highc text, i4 int, f8 float8, d date, n numeric, b bool) WITH (appendonly=true, orientation=parquet, pagesize=1024) DISTRIBUTED BY (id);
+CREATE TABLE pqd_mixed (id int, lowc text, highc text, i4 int, f8 float8, d date, n numeric, b bool) WITH (appendonly=true, orientation=parquet, pagesize=1024) DISTRIBUTED BY (id);
+SET gp_parquet_dictionary_encoding = on;
+INSERT INTO pqd_dict
+SELECT i, CASE WHEN i % 23 = 0 THEN NULL ELSE 'v' || (i % 10) END, md5(i::text), i % 100,
+       (i % 50) * 1.5, date '2000-01-01' + i % 365, i % 7 + 0.5, i % 2 = 0
+FROM generate_series(1, 20000) i;
+INSERT INTO pqd_mixed
+SELECT i, CASE WHEN i % 23 = 0 THEN NULL ELSE 'v' || (i % 10) END, md5(i::text), i % 100,
+       (i % 50) * 1.5, date '2000-01-01' + i % 365, i % 7 + 0.5, i % 2 = 0
+FROM generate_series(1, 10000) i;
+SET gp_parquet_dictionary_encoding = off;
+INSERT INTO pqd_plain
+SELECT i, CASE WHEN i % 23 = 0 THEN NULL ELSE 'v' || (i % 10) END, md5(i::text), i % 100,
+       (i % 50) * 1.5, date '2000-01-01' + i % 365, i % 7 + 0.5, i % 2 = 0
+FROM generate_series(1, 20000) i;
+INSERT INTO pqd_mixed
+SELECT i, CASE WHEN i % 23 = 0 THEN NULL ELSE 'v' || (i % 10) END, md5(i::text), i % 100,
+       (i % 50) * 1.5, date '2000-01-01' + i % 365, i % 7 + 0.5, i % 2 = 0
+FROM generate_series(10001, 20000) i;
+RESET gp_parquet_dictionary_encoding;
+SELECT count(*), count(lowc), count(DISTINCT lowc), count(DISTINCT highc), sum(i4), sum(f8),
+       max(d) - date '2000-01-01', sum(n), count(NULLIF(b, false)) FROM pqd_dict;
+SELECT id, lowc, highc, i4, f8, d - date '2000-01-01' AS d, n, b FROM pqd_dict
+WHERE id IN (1, 23, 5000, 19999) ORDER BY id;
+SELECT count(*) FROM pqd_dict WHERE lowc = 'v3' AND highc > 'f';
+SELECT count(*), count(lowc), count(DISTINCT lowc), count(DISTINCT highc), sum(i4), sum(f8),
+       max(d) - date '2000-01-01', sum(n), count(NULLIF(b, false)) FROM pqd_plain;
+SELECT id, lowc, highc, i4, f8, d - date '2000-01-01' AS d, n, b FROM pqd_plain
+WHERE id IN (1, 23, 5000, 19999) ORDER BY id;
+SELECT count(*) FROM pqd_plain WHERE lowc = 'v3' AND highc > 'f';
+SELECT count(*), count(lowc), count(DISTINCT lowc), count(DISTINCT highc), sum(i4), sum(f8),
+       max(d) - date '2000-01-01', sum(n), count(NULLIF(b, false)) FROM pqd_mixed;
+SELECT id, lowc, highc, i4, f8, d - date '2000-01-01' AS d, n, b FROM pqd_mixed
+WHERE id IN (1, 23, 5000, 19999) ORDER BY id;
+SELECT count(*) FROM pqd_mixed WHERE lowc = 'v3' AND highc > 'f';
+SELECT count(*) FROM (SELECT * FROM pqd_dict EXCEPT ALL SELECT * FROM pqd_plain) s;
+SELECT count(*) FROM (SELECT * FROM pqd_plain EXCEPT ALL SELECT * FROM pqd_dict) s;
+SELECT count(*) FROM (SELECT * FROM pqd_mixed EXCEPT ALL SELECT * FROM pqd_plain) s;
+SELECT count(*) FROM (SELECT * FROM pqd_plain EXCEPT ALL SELECT * FROM pqd_mixed) s;
+DROP TABLE pqd_dict;
+DROP TABLE pqd_plain;
+DROP TABLE pqd_mixed;
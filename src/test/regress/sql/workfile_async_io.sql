@@ -0,0 +1,38 @@
+--
+-- Hash joins and hash aggregates that spill to work files written and read
+-- in a background thread (gp_workfile_async_io), uncompressed and with
+-- zlib, must return what they return with synchronous work files.
+--
+CREATE TABLE wfa_outer (i int, k int, g int, pad text) DISTRIBUTED BY (i);
+CREATE TABLE wfa_inner (k int, g int, pad text) DISTRIBUTED BY (k);
+INSERT INTO wfa_outer SELECT i, i % 60000, i % 11, rpad((i % 60000)::text, 100, 'x') FROM generate_series(1, 100000) i;
+INSERT INTO wfa_inner SELECT (i * 7) % 50000, i % 13, repeat('y', 100) FROM generate_series(1, 60000) i;
+SET enable_nestloop = off;
+SET enable_mergejoin = off;
+SET enable_groupagg = off;
+SET statement_mem = '2MB';
+SET gp_workfile_async_io = on;
+SET gp_workfile_compress_algorithm = none;
+SELECT count(*), sum(o.g), sum(i.g) FROM wfa_outer o JOIN wfa_inner i ON o.k = i.k;
+SELECT count(*), count(i.k) FROM wfa_outer o LEFT JOIN wfa_inner i ON o.k = i.k;
+SELECT count(*), sum(c), sum(s) FROM (SELECT k, count(*) AS c, sum(i) AS s FROM wfa_outer GROUP BY k) g;
+SELECT count(*), sum(c) FROM (SELECT pad, count(*) AS c FROM wfa_outer GROUP BY pad) g;
+SET gp_workfile_compress_algorithm = zlib;
+SELECT count(*), sum(o.g), sum(i.g) FROM wfa_outer o JOIN wfa_inner i ON o.k = i.k;
+SELECT count(*), count(i.k) FROM wfa_outer o LEFT JOIN wfa_inner i ON o.k = i.k;
+SELECT count(*), sum(c), sum(s) FROM (SELECT k, count(*) AS c, sum(i) AS s FROM wfa_outer GROUP BY k) g;
+SELECT count(*), sum(c) FROM (SELECT pad, count(*) AS c FROM wfa_outer GROUP BY pad) g;
+SET gp_workfile_async_io = off;
+SET gp_workfile_compress_algorithm = none;
+SELECT count(*), sum(o.g), sum(i.g) FROM wfa_outer o JOIN wfa_inner i ON o.k = i.k;
+SELECT count(*), count(i.k) FROM wfa_outer o LEFT JOIN wfa_inner i ON o.k = i.k;
+SELECT count(*), sum(c), sum(s) FROM (SELECT k, count(*) AS c, sum(i) AS s FROM wfa_outer GROUP BY k) g;
+SELECT count(*), sum(c) FROM (SELECT pad, count(*) AS c FROM wfa_outer GROUP BY pad) g;
+RESET gp_workfile_compress_algorithm;
+RESET gp_workfile_async_io;
+RESET statement_mem;
+RESET enable_groupagg;
+RESET enable_mergejoin;
+RESET enable_nestloop;
+DROP TABLE wfa_outer;
+DROP TABLE wfa_inner;